@@ -3,8 +3,22 @@
 #include "ga/signature.h"
 #include "ga/algebra.h"
 #include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/reducedBatch.h"
 #include "ga/versor.h"
 #include "ga/rotor.h"
+#include "ga/pga.h"
+#include "ga/graded.h"
+#include "ga/frame.h"
+#include "ga/spline.h"
+#include "ga/metrics.h"
+#include "ga/random.h"
+#include "ga/field.h"
+#include "ga/cfft.h"
+#include "ga/cliffordMatrix.h"
+#include "ga/nn.h"
+#include "ga/hierarchy.h"
+#include "ga/spinor.h"
 
 // Operations
 #include "ga/ops/blade.h"
@@ -13,7 +27,15 @@
 #include "ga/ops/wedge.h"
 #include "ga/ops/inner.h"
 #include "ga/ops/dual.h"
+#include "ga/ops/selective.h"
+#include "ga/ops/kernels.h"
+#include "ga/ops/reflect.h"
 
 // Utilities
 #include "ga/linearMap.h"
+#include "ga/productMatrix.h"
 #include "ga/policies.h"
+#include "ga/registration.h"
+#include "ga/parallel.h"
+#include "ga/checkpoint.h"
+#include "ga/autotune.h"
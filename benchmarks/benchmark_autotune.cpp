@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/autotune.h"
+#include "ga/ops/kernels.h"
+
+using namespace ga;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        m.storage[i] = std::sin(seed + 0.61f * static_cast<float>(i));
+    }
+    return m;
+}
+
+// -----------------------------------------------------------------------------
+// Dense x dense product per kernel; range(0) = kernel, range(1) = p in Cl(p,0,1)
+// -----------------------------------------------------------------------------
+
+static void BM_ProductKernel(benchmark::State& state) {
+    const auto kernel = static_cast<autotune::Kernel>(state.range(0));
+    const Algebra alg(Signature(static_cast<int>(state.range(1)), 0, 1, true));
+    const Multivector A = dense(alg, 0.3f);
+    const Multivector B = dense(alg, 1.7f);
+    const ops::ProductKernel fn = autotune::kernelFunction(kernel);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fn(A, B, nullptr));
+    }
+    state.SetLabel(autotune::kernelName(kernel));
+}
+BENCHMARK(BM_ProductKernel)->ArgsProduct({{0, 1, 2, 3}, {2, 3, 4, 7}});
+
+// -----------------------------------------------------------------------------
+// One full tuning pass (what GASMITH_AUTOTUNE=on costs per metric on first use)
+// -----------------------------------------------------------------------------
+
+static void BM_TunePass(benchmark::State& state) {
+    autotune::setMode(autotune::Mode::Off);
+    const Algebra alg(Signature(static_cast<int>(state.range(0)), 0, 1, true));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(autotune::tune(alg, false));
+    }
+    autotune::reset();
+}
+BENCHMARK(BM_TunePass)->Arg(3)->Arg(4)->Unit(benchmark::kMillisecond);
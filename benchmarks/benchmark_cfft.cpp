@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/field.h"
+#include "ga/cfft.h"
+#include "ga/tables.h"
+
+using namespace ga;
+using ga::field::MultivectorField;
+
+static const Algebra& e3() {
+    static const Algebra alg(Signature(3, 0, 0, true));
+    return alg;
+}
+
+static MultivectorField smoothField(std::size_t n) {
+    MultivectorField F(e3(), n, n, n);
+    for (std::size_t m = 0; m < F.bladeCount(); ++m) {
+        float* col = F.column(static_cast<BladeMask>(m));
+        for (std::size_t i = 0; i < F.cells(); ++i) col[i] = std::sin(0.37f * i + 1.1f * m);
+    }
+    return F;
+}
+
+// Textbook in-place radix-2 FFT of one strided line of std::complex
+static void lineFft(std::complex<float>* a, std::size_t n, std::size_t stride) {
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i * stride], a[j * stride]);
+    }
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+        const float ang = -2.0f * float(M_PI) / float(len);
+        const std::complex<float> wl(std::cos(ang), std::sin(ang));
+        for (std::size_t i = 0; i < n; i += len) {
+            std::complex<float> w(1.0f, 0.0f);
+            for (std::size_t j = 0; j < len / 2; ++j) {
+                const std::complex<float> u = a[(i + j) * stride], v = w * a[(i + j + len / 2) * stride];
+                a[(i + j) * stride] = u + v;
+                a[(i + j + len / 2) * stride] = u - v;
+                w *= wl;
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// 3D Clifford FFT of a dense E3 field: copying blade pairs out to complex arrays
+// by hand vs the in-place SoA transform
+// -----------------------------------------------------------------------------
+
+static void BM_CfftCopyToComplex(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    MultivectorField F = smoothField(n);
+    const ProductTables& tables = productTables(e3());
+    std::vector<std::complex<float>> z(F.cells());
+    for (auto _ : state) {
+        for (BladeMask B = 0; B < 4; ++B) {
+            const BladeMask C = static_cast<BladeMask>(B ^ 7);
+            const float s = static_cast<float>(tables.productSign(7, B));
+            float* re = F.column(B);
+            float* im = F.column(C);
+            for (std::size_t i = 0; i < F.cells(); ++i) z[i] = {re[i], s * im[i]};
+            for (std::size_t q = 0; q < n * n; ++q) lineFft(z.data() + q * n, n, 1);
+            for (std::size_t q = 0; q < n * n; ++q) lineFft(z.data() + (q / n) * n * n + q % n, n, n);
+            for (std::size_t q = 0; q < n * n; ++q) lineFft(z.data() + q, n, n * n);
+            for (std::size_t i = 0; i < F.cells(); ++i) {
+                re[i] = z[i].real();
+                im[i] = s * z[i].imag();
+            }
+        }
+        benchmark::DoNotOptimize(F.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(F.cells()));
+}
+BENCHMARK(BM_CfftCopyToComplex)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_CfftForward(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    MultivectorField F = smoothField(n);
+    for (auto _ : state) {
+        cfft::forward(F);
+        benchmark::DoNotOptimize(F.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(F.cells()));
+}
+BENCHMARK(BM_CfftForward)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
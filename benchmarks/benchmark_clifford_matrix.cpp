@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/cliffordMatrix.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static const Algebra& algebraOf(int which) {
+    static const Algebra e3(Signature(3, 0, 0, true));
+    static const Algebra cga(Signature(4, 1, 0, true));
+    return which == 0 ? e3 : cga;
+}
+
+static CliffordMatrix filled(const Algebra& alg, std::size_t rows, std::size_t cols, float seed) {
+    CliffordMatrix M(alg, rows, cols);
+    for (std::size_t i = 0; i < M.data.size(); ++i) M.data[i] = std::sin(seed + 0.61f * i);
+    return M;
+}
+
+// -----------------------------------------------------------------------------
+// Square n x n product: nested loops of geometricProduct on Multivector entries
+// vs the blocked per-blade GEMM. Items are multivector multiply-adds (n^3).
+// -----------------------------------------------------------------------------
+
+static void BM_CliffordMatrixNestedLoops(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const std::size_t n = static_cast<std::size_t>(state.range(1));
+    const CliffordMatrix A = filled(alg, n, n, 0.3f), B = filled(alg, n, n, 1.9f);
+    std::vector<Multivector> a, b, c;
+    for (std::size_t i = 0; i < n * n; ++i) {
+        a.push_back(A.get(i / n, i % n));
+        b.push_back(B.get(i / n, i % n));
+    }
+    c = a;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                Multivector sum(alg);
+                for (std::size_t k = 0; k < n; ++k) sum = sum + geometricProduct(a[i * n + k], b[k * n + j]);
+                c[i * n + j] = sum;
+            }
+        }
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n * n));
+}
+BENCHMARK(BM_CliffordMatrixNestedLoops)->Args({0, 32})->Args({1, 32})->Unit(benchmark::kMillisecond);
+
+static void BM_CliffordMatrixMultiply(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const std::size_t n = static_cast<std::size_t>(state.range(1));
+    const CliffordMatrix A = filled(alg, n, n, 0.3f), B = filled(alg, n, n, 1.9f);
+    CliffordMatrix C(alg, n, n);
+    for (auto _ : state) {
+        multiply(A, B, C);
+        benchmark::DoNotOptimize(C.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n * n));
+    // Real flops: 2 per term, 4^dims terms per multivector multiply-add
+    state.counters["GFLOP/s"] = benchmark::Counter(
+            2.0 * double(n * n * n) * double(std::size_t(1) << (2 * alg.dimensions)) * state.iterations(),
+            benchmark::Counter::kIsRate, benchmark::Counter::kIs1000);
+}
+BENCHMARK(BM_CliffordMatrixMultiply)->Args({0, 32})->Args({0, 256})->Args({1, 32})->Args({1, 128})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/field.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+using ga::field::Boundary;
+using ga::field::MultivectorField;
+using ga::field::Stencil;
+
+// Spacetime algebra, spatial grid along e1, e2, e3, holding a bivector (electromagnetic) field
+static const Algebra& sta() {
+    static const Algebra alg(Signature(1, 3, 0, true));
+    return alg;
+}
+
+static const Stencil spatial{{1, 2, 3}, {1.0f, 1.0f, 1.0f}, Boundary::Periodic, 1u << 2};
+
+static MultivectorField bivectorField(std::size_t n) {
+    MultivectorField F(sta(), n, n, n);
+    for (BladeMask m : {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100}) {
+        float* col = F.column(m);
+        for (std::size_t i = 0; i < F.cells(); ++i) col[i] = std::sin(0.01f * i + m);
+    }
+    return F;
+}
+
+// -----------------------------------------------------------------------------
+// Vector derivative of an STA bivector field: one Multivector per cell with
+// per-cell geometric products vs the SoA field and row stencils
+// -----------------------------------------------------------------------------
+
+static void BM_FieldDerivativePerCell(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const MultivectorField F = bivectorField(n);
+    std::vector<Multivector> cells, out;
+    for (std::size_t z = 0; z < n; ++z)
+        for (std::size_t y = 0; y < n; ++y)
+            for (std::size_t x = 0; x < n; ++x) cells.push_back(F.get(x, y, z));
+    out = cells;
+    Multivector recip[3] = {Multivector(sta()), Multivector(sta()), Multivector(sta())};
+    for (int d = 0; d < 3; ++d) recip[d].setComponent(Blade::getBasis(d + 1), -0.5f);
+    const std::size_t stride[3] = {1, n, n * n};
+
+    for (auto _ : state) {
+        for (std::size_t z = 0; z < n; ++z) {
+            for (std::size_t y = 0; y < n; ++y) {
+                for (std::size_t x = 0; x < n; ++x) {
+                    const std::size_t c[3] = {x, y, z}, i = (z * n + y) * n + x;
+                    Multivector sum(sta());
+                    for (int d = 0; d < 3; ++d) {
+                        const std::size_t p = i + (c[d] + 1 < n ? stride[d] : 0) - (c[d] + 1 < n ? 0 : (n - 1) * stride[d]);
+                        const std::size_t m = c[d] > 0 ? i - stride[d] : i + (n - 1) * stride[d];
+                        sum = sum + geometricProduct(recip[d], cells[p] + -1.0f * cells[m]);
+                    }
+                    out[i] = sum;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n * n));
+}
+BENCHMARK(BM_FieldDerivativePerCell)->Arg(32)->Unit(benchmark::kMillisecond);
+
+static void BM_FieldDerivative(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const MultivectorField F = bivectorField(n);
+    MultivectorField out(sta(), n, n, n);
+    for (auto _ : state) {
+        field::derivative(F, out, spatial);
+        benchmark::DoNotOptimize(out.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n * n));
+}
+BENCHMARK(BM_FieldDerivative)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond);
+
+static void BM_FieldLaplacian(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const MultivectorField F = bivectorField(n);
+    MultivectorField out(sta(), n, n, n);
+    for (auto _ : state) {
+        field::laplacian(F, out, spatial);
+        benchmark::DoNotOptimize(out.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n * n));
+}
+BENCHMARK(BM_FieldLaplacian)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond);
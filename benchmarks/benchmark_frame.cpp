@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/frame.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/wedge.h"
+#include "ga/versor.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector vec(const Algebra& alg, float seed) {
+    Multivector v(alg);
+    for (int k = 0; k < alg.dimensions; ++k) v.setComponent(Blade::getBasis(k), std::sin(seed * (k + 1) + 1.7f * k) + (k == 0 ? 1.5f : 0.0f));
+    return v;
+}
+
+// -----------------------------------------------------------------------------
+// Full reciprocal frame in CGA: Gram inverse vs a^i = (-1)^i (a_1 ^ .. ^ a_i-hat ^ .. ^ a_n) I^{-1}
+// -----------------------------------------------------------------------------
+
+static void BM_FrameReciprocal_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    std::vector<Multivector> vs;
+    for (int i = 0; i < alg.dimensions; ++i) vs.push_back(vec(alg, 0.9f * i));
+    for (auto _ : state) {
+        const Frame F(alg, vs);
+        benchmark::DoNotOptimize(F.reciprocal(0));
+    }
+}
+BENCHMARK(BM_FrameReciprocal_CGA);
+
+static void BM_FrameReciprocalWedge_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    std::vector<Multivector> vs;
+    for (int i = 0; i < alg.dimensions; ++i) vs.push_back(vec(alg, 0.9f * i));
+    const int n = alg.dimensions;
+    for (auto _ : state) {
+        Multivector I = vs[0];
+        for (int i = 1; i < n; ++i) I = wedge(I, vs[i]);
+        const Multivector Iinv = Versor(I).inverse();
+        for (int i = 0; i < n; ++i) {
+            Multivector B(alg);
+            B.setComponent(0, (i % 2 == 0) ? 1.0f : -1.0f);
+            for (int j = 0; j < n; ++j) {
+                if (j != i) B = wedge(B, vs[j]);
+            }
+            benchmark::DoNotOptimize(geometricProduct(B, Iinv));
+        }
+    }
+}
+BENCHMARK(BM_FrameReciprocalWedge_CGA);
+
+// -----------------------------------------------------------------------------
+// Many small frames (3 vectors in Cl(4,1)) per element (items/s)
+// -----------------------------------------------------------------------------
+
+static void BM_FrameBatchReciprocal_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    FrameBatch frames(alg, 3, count);
+    for (std::size_t e = 0; e < count; ++e) {
+        for (int i = 0; i < 3; ++i) {
+            // Perturbed Euclidean axes, so no element spans a near-null subspace
+            Multivector a = 0.3f * vec(alg, 0.013f * static_cast<float>(e) + 1.3f * i);
+            a.setComponent(Blade::getBasis(i), a.storage[Blade::getBasis(i)] + 1.0f);
+            frames.setVector(e, i, a);
+        }
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frames.reciprocal());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_FrameBatchReciprocal_CGA)->Arg(1 << 14);
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/wedge.h"
+#include "ga/ops/involutions.h"
+#include "ga/graded.h"
+
+using namespace ga;
+using namespace ga::graded;
+
+using E3 = StaticAlgebra<3>;
+
+static Vector<E3> vec(float x, float y, float z) { return Vector<E3>{{x, y, z}}; }
+
+static Even<E3> rotorE3() {
+    Even<E3> R;
+    R.setComponent(0b000, std::cos(0.3f));
+    R.setComponent(0b011, -std::sin(0.3f));
+    return R;
+}
+
+// -----------------------------------------------------------------------------
+// Vector wedge: grade-typed vs dense Multivector
+// -----------------------------------------------------------------------------
+
+static void BM_GradedWedge_E3(benchmark::State& state) {
+    Vector<E3> a = vec(1.0f, 2.0f, 3.0f);
+    Vector<E3> b = vec(-0.5f, 0.25f, 4.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(a ^ b);
+    }
+}
+BENCHMARK(BM_GradedWedge_E3);
+
+static void BM_DenseWedge_E3(benchmark::State& state) {
+    Multivector a = vec(1.0f, 2.0f, 3.0f).toMultivector();
+    Multivector b = vec(-0.5f, 0.25f, 4.0f).toMultivector();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ops::wedge(a, b));
+    }
+}
+BENCHMARK(BM_DenseWedge_E3);
+
+// -----------------------------------------------------------------------------
+// Rotor sandwich R v ~R
+// -----------------------------------------------------------------------------
+
+static void BM_GradedSandwich_E3(benchmark::State& state) {
+    Even<E3> R = rotorE3();
+    Vector<E3> v = vec(1.0f, 2.0f, 3.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        benchmark::DoNotOptimize(R * v * ~R);
+    }
+}
+BENCHMARK(BM_GradedSandwich_E3);
+
+static void BM_DenseSandwich_E3(benchmark::State& state) {
+    Multivector R = rotorE3().toMultivector();
+    Multivector Rrev = ops::reverse(R);
+    Multivector v = vec(1.0f, 2.0f, 3.0f).toMultivector();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ops::geometricProduct(ops::geometricProduct(R, v), Rrev));
+    }
+}
+BENCHMARK(BM_DenseSandwich_E3);
+
+// End benchmark file
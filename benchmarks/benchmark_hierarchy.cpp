@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/hierarchy.h"
+#include "ga/pga.h"
+#include "ga/spline.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector motor(float seed) {
+    static constexpr BladeMask masks[] = {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100};
+    Multivector B(pga::algebra);
+    for (int k = 0; k < 6; ++k) B.setComponent(masks[k], 0.4f * std::sin(seed + 1.3f * k));
+    return spline::motorExp(B);
+}
+
+// Scene-graph-like tree: node i hangs off one of the previous nodes, every 17th is a root
+static TransformHierarchy makeTree(std::size_t n) {
+    TransformHierarchy h(pga::algebra);
+    h.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::uint32_t parent = (i == 0 || i % 17 == 0) ? TransformHierarchy::NO_PARENT
+                                                             : static_cast<std::uint32_t>((i * 7919u) % i);
+        (void)h.add(parent, motor(0.37f * i));
+    }
+    (void)h.update();
+    return h;
+}
+
+// -----------------------------------------------------------------------------
+// Per-frame cost: every world transform recomputed vs only the changed subtrees
+// -----------------------------------------------------------------------------
+
+// Baseline: dense geometricProduct down the tree for every node
+static void BM_HierarchyDenseRecompute(benchmark::State& state) {
+    const TransformHierarchy h = makeTree(static_cast<std::size_t>(state.range(0)));
+    std::vector<Multivector> local, world(h.size(), Multivector(pga::algebra));
+    for (std::size_t i = 0; i < h.size(); ++i) local.push_back(h.local(i));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < h.size(); ++i) {
+            const std::uint32_t p = h.parent(i);
+            world[i] = p == TransformHierarchy::NO_PARENT ? local[i] : geometricProduct(world[p], local[i]);
+        }
+        benchmark::DoNotOptimize(world.back());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(h.size()));
+}
+BENCHMARK(BM_HierarchyDenseRecompute)->Arg(1 << 10)->Arg(1 << 14);
+
+// Every node changed: compact products, level by level
+static void BM_HierarchyUpdateAll(benchmark::State& state) {
+    TransformHierarchy h = makeTree(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < h.size(); ++i) {
+            if (h.parent(i) == TransformHierarchy::NO_PARENT) h.setLocal(i, h.localMotor(i));
+        }
+        benchmark::DoNotOptimize(h.update());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(h.size()));
+}
+BENCHMARK(BM_HierarchyUpdateAll)->Arg(1 << 10)->Arg(1 << 14);
+
+// 16 leaf-side nodes animated per frame
+static void BM_HierarchyUpdateSparse(benchmark::State& state) {
+    TransformHierarchy h = makeTree(static_cast<std::size_t>(state.range(0)));
+    std::size_t recomputed = 0;
+    for (auto _ : state) {
+        for (std::size_t k = 0; k < 16; ++k) {
+            const std::size_t i = h.size() - 1 - k * (h.size() / 64);
+            h.setLocal(i, h.localMotor(i));
+        }
+        recomputed += h.update();
+    }
+    state.counters["nodes/frame"] = static_cast<double>(recomputed) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_HierarchyUpdateSparse)->Arg(1 << 10)->Arg(1 << 14);
+
+static void BM_HierarchyWorldMatrices(benchmark::State& state) {
+    const TransformHierarchy h = makeTree(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(16 * h.size());
+    for (auto _ : state) {
+        h.worldMatrices(out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(h.size()));
+}
+BENCHMARK(BM_HierarchyWorldMatrices)->Arg(1 << 14);
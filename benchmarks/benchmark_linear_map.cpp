@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/linearMap.h"
+
+using namespace ga;
+
+static LinearMap benchMap(const Algebra& alg) {
+    LinearMap L(alg);
+    const int dims = alg.dimensions;
+    for (int r = 0; r < dims; ++r)
+        for (int c = 0; c < dims; ++c)
+            L.set(r, c, (r == c ? 1.0f : 0.0f) + 0.1f * static_cast<float>(r - c));
+    return L;
+}
+
+// -----------------------------------------------------------------------------
+// Outermorphism on a single bivector (E3 normal)
+// -----------------------------------------------------------------------------
+
+static void BM_LinearMapApply_Bivector_E3(benchmark::State& state) {
+    Signature sig(3,0,0,true);
+    Algebra alg(sig);
+    LinearMap L = benchMap(alg);
+
+    Multivector n(alg);
+    n.setComponent(0b011, 1.0f);
+    n.setComponent(0b110, 0.5f);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(L.apply(n));
+    }
+}
+BENCHMARK(BM_LinearMapApply_Bivector_E3);
+
+static void BM_CompoundApply_Bivector_E3(benchmark::State& state) {
+    Signature sig(3,0,0,true);
+    Algebra alg(sig);
+    CompoundMap normals = benchMap(alg).compound(2);
+
+    Multivector n(alg);
+    n.setComponent(0b011, 1.0f);
+    n.setComponent(0b110, 0.5f);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(normals.apply(n));
+    }
+}
+BENCHMARK(BM_CompoundApply_Bivector_E3);
+
+static void BM_CompoundApplyBatch_Bivector_E3(benchmark::State& state) {
+    Signature sig(3,0,0,true);
+    Algebra alg(sig);
+    CompoundMap normals = benchMap(alg).compound(2);
+
+    MultivectorBatch batch(alg, static_cast<std::size_t>(state.range(0)));
+    for (float& c : batch.data) c = 0.5f;
+
+    for (auto _ : state) {
+        normals.apply(batch, batch);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompoundApplyBatch_Bivector_E3)->Arg(1024)->Arg(65536);
+
+// End benchmark file
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/metrics.h"
+#include "ga/productMatrix.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) m.storage[i] = std::sin(seed + 0.37f * static_cast<float>(i));
+    return m;
+}
+
+// -----------------------------------------------------------------------------
+// Recording overhead: a small product with metrics off and on
+// -----------------------------------------------------------------------------
+
+static void productWithMetrics(benchmark::State& state, const bool on) {
+    const bool previous = metrics::enabled();
+    metrics::setEnabled(on);
+    Algebra alg(Signature(3, 0, 0, true));
+    const Multivector A = dense(alg, 0.3f), B = dense(alg, 1.1f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geometricProduct(A, B));
+    }
+    metrics::setEnabled(previous);
+}
+
+static void BM_MetricsProductE3_Off(benchmark::State& state) { productWithMetrics(state, false); }
+BENCHMARK(BM_MetricsProductE3_Off);
+
+static void BM_MetricsProductE3_On(benchmark::State& state) { productWithMetrics(state, true); }
+BENCHMARK(BM_MetricsProductE3_On);
+
+static void BM_MetricsCounterAdd(benchmark::State& state) {
+    const bool previous = metrics::enabled();
+    metrics::setEnabled(true);
+    for (auto _ : state) {
+        metrics::add(metrics::Counter::BatchCalls);
+    }
+    metrics::setEnabled(previous);
+}
+BENCHMARK(BM_MetricsCounterAdd);
+
+static void BM_MetricsSnapshot(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(metrics::snapshot());
+    }
+}
+BENCHMARK(BM_MetricsSnapshot);
+
+// Batch apply with metrics on: per-call cost is amortised over the batch
+static void BM_MetricsBatchApply(benchmark::State& state) {
+    const bool previous = metrics::enabled();
+    metrics::setEnabled(state.range(0) != 0);
+    Algebra alg(Signature(3, 0, 0, true));
+    MultivectorBatch in(alg, 4096), out(alg, 4096);
+    const ProductMatrix pm = ProductMatrix::left(dense(alg, 0.5f));
+    for (auto _ : state) {
+        pm.apply(in, out);
+        benchmark::ClobberMemory();
+    }
+    metrics::setEnabled(previous);
+}
+BENCHMARK(BM_MetricsBatchApply)->Arg(0)->Arg(1);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/cliffordMatrix.h"
+#include "ga/nn.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static const Algebra& algebraOf(int which) {
+    static const Algebra e3(Signature(3, 0, 0, true));
+    static const Algebra cga(Signature(4, 1, 0, true));
+    return which == 0 ? e3 : cga;
+}
+
+static CliffordMatrix filled(const Algebra& alg, std::size_t rows, std::size_t cols, float seed) {
+    CliffordMatrix M(alg, rows, cols);
+    for (std::size_t i = 0; i < M.data.size(); ++i) M.data[i] = 0.3f * std::sin(seed + 0.61f * i);
+    return M;
+}
+
+// -----------------------------------------------------------------------------
+// One layer block per inference batch of 64 samples x 32 channels:
+//   H = normalize(gate(X W + b)),  Y = H * (H W2)   (geometric-product layer)
+// built from Multivector ops one element at a time vs the nn kernels
+// -----------------------------------------------------------------------------
+
+static constexpr std::size_t SAMPLES = 64, CHANNELS = 32;
+
+static void BM_NnBlockPerElement(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    const CliffordMatrix Xm = filled(alg, SAMPLES, CHANNELS, 0.1f), Wm = filled(alg, CHANNELS, CHANNELS, 0.7f),
+                         W2m = filled(alg, CHANNELS, CHANNELS, 1.4f), bm = filled(alg, 1, CHANNELS, 2.0f);
+    auto unpack = [](const CliffordMatrix& M) {
+        std::vector<Multivector> v;
+        for (std::size_t i = 0; i < M.entries(); ++i) v.push_back(M.get(i / M.cols, i % M.cols));
+        return v;
+    };
+    const std::vector<Multivector> X = unpack(Xm), W = unpack(Wm), W2 = unpack(W2m), b = unpack(bm);
+    std::vector<Multivector> H(SAMPLES * CHANNELS, Multivector(alg)), Y = H;
+
+    for (auto _ : state) {
+        for (std::size_t s = 0; s < SAMPLES; ++s) {
+            float norm = 0.0f;
+            for (std::size_t o = 0; o < CHANNELS; ++o) {
+                Multivector h = b[o];
+                for (std::size_t i = 0; i < CHANNELS; ++i) h = h + geometricProduct(X[s * CHANNELS + i], W[i * CHANNELS + o]);
+                float q[6] = {};
+                for (std::size_t m = 0; m < N; ++m) q[Blade::getGrade(static_cast<BladeMask>(m))] += h.storage[m] * h.storage[m];
+                for (std::size_t m = 0; m < N; ++m) {
+                    const int k = Blade::getGrade(static_cast<BladeMask>(m));
+                    const float g = k == 0 ? h.storage[0] : std::sqrt(q[k]);
+                    h.storage[m] *= 1.0f / (1.0f + std::exp(-g));
+                    norm += h.storage[m] * h.storage[m];
+                }
+                H[s * CHANNELS + o] = h;
+            }
+            const float inv = 1.0f / std::sqrt(norm / CHANNELS + 1e-6f);
+            for (std::size_t o = 0; o < CHANNELS; ++o) H[s * CHANNELS + o] = inv * H[s * CHANNELS + o];
+            for (std::size_t o = 0; o < CHANNELS; ++o) {
+                Multivector r(alg);
+                for (std::size_t i = 0; i < CHANNELS; ++i) r = r + geometricProduct(H[s * CHANNELS + i], W2[i * CHANNELS + o]);
+                Y[s * CHANNELS + o] = geometricProduct(H[s * CHANNELS + o], r);
+            }
+        }
+        benchmark::DoNotOptimize(Y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(SAMPLES));
+}
+BENCHMARK(BM_NnBlockPerElement)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_NnBlockKernels(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const CliffordMatrix X = filled(alg, SAMPLES, CHANNELS, 0.1f), W = filled(alg, CHANNELS, CHANNELS, 0.7f),
+                         W2 = filled(alg, CHANNELS, CHANNELS, 1.4f), b = filled(alg, 1, CHANNELS, 2.0f);
+    CliffordMatrix H(alg, SAMPLES, CHANNELS), R(alg, SAMPLES, CHANNELS);
+    for (auto _ : state) {
+        nn::linear(X, W, &b, H);
+        nn::gate(H, H);
+        nn::normalize(H, H);
+        nn::linear(H, W2, nullptr, R);
+        nn::product(H, R, R);
+        benchmark::DoNotOptimize(R.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(SAMPLES));
+}
+BENCHMARK(BM_NnBlockKernels)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_NnGradeLinear(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const CliffordMatrix X = filled(alg, SAMPLES, CHANNELS, 0.1f);
+    nn::GradeWeights W(alg, CHANNELS, CHANNELS);
+    for (std::size_t i = 0; i < W.w.size(); ++i) W.w[i] = std::cos(0.37f * i);
+    CliffordMatrix Y(alg, SAMPLES, CHANNELS);
+    for (auto _ : state) {
+        nn::gradeLinear(X, W, Y);
+        benchmark::DoNotOptimize(Y.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(SAMPLES));
+}
+BENCHMARK(BM_NnGradeLinear)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
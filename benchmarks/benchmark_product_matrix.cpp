@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/selective.h"
+#include "ga/productMatrix.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) m.storage[i] = std::sin(seed + 1.3f * static_cast<float>(i));
+    return m;
+}
+
+// -----------------------------------------------------------------------------
+// One fixed CGA multivector times a batch (32 x 32 matrix per element)
+// -----------------------------------------------------------------------------
+
+static void BM_FixedLeftProduct_PerElement_CGA(benchmark::State& state) {
+    Signature sig(4,1,0,true);
+    Algebra alg(sig);
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const Multivector F = dense(alg, 0.3f);
+    MultivectorBatch in(alg, n), out(alg, n);
+    for (std::size_t i = 0; i < n; ++i) in.set(i, dense(alg, 0.001f * i));
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n; ++i) out.set(i, geometricProduct(F, in.get(i)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_FixedLeftProduct_PerElement_CGA)->Arg(4096);
+
+static void BM_FixedLeftProduct_Matrix_CGA(benchmark::State& state) {
+    Signature sig(4,1,0,true);
+    Algebra alg(sig);
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const ProductMatrix L = ProductMatrix::left(dense(alg, 0.3f));
+    MultivectorBatch in(alg, n), out(alg, n);
+    for (std::size_t i = 0; i < n; ++i) in.set(i, dense(alg, 0.001f * i));
+
+    for (auto _ : state) {
+        L.apply(in, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_FixedLeftProduct_Matrix_CGA)->Arg(4096)->Arg(1 << 16);
+
+// End benchmark file
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/random.h"
+#include "ga/rotor.h"
+
+using namespace ga;
+
+// -----------------------------------------------------------------------------
+// Baseline: std::mt19937 through setComponent and Rotor::fromPlaneAngle (items/s)
+// -----------------------------------------------------------------------------
+
+static void BM_RandomRotorsMt19937_E3(benchmark::State& state) {
+    Algebra alg(Signature(3, 0, 0, true));
+    std::mt19937 rng(1);
+    std::normal_distribution<float> normal;
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    for (auto _ : state) {
+        Multivector a(alg), b(alg);
+        for (int k = 0; k < 3; ++k) {
+            a.setComponent(Blade::getBasis(k), normal(rng));
+            b.setComponent(Blade::getBasis(k), normal(rng));
+        }
+        benchmark::DoNotOptimize(Rotor::fromPlaneAngle(a, b, angle(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomRotorsMt19937_E3);
+
+static void BM_RandomDenseMt19937_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    for (auto _ : state) {
+        Multivector m(alg);
+        for (int k = 0; k < 32; ++k) m.setComponent(static_cast<BladeMask>(k), uniform(rng));
+        benchmark::DoNotOptimize(m);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomDenseMt19937_CGA);
+
+// -----------------------------------------------------------------------------
+// ga::random batch fills (items/s)
+// -----------------------------------------------------------------------------
+
+static void batchFill(benchmark::State& state, const Signature& sig, void (*fill)(MultivectorBatch&, std::uint64_t)) {
+    Algebra alg(sig);
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    MultivectorBatch out(alg, count);
+    std::uint64_t seed = 0;
+    for (auto _ : state) {
+        fill(out, ++seed);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(count));
+}
+
+static void BM_RandomRotors_E3(benchmark::State& state) {
+    batchFill(state, Signature(3, 0, 0, true), [](MultivectorBatch& b, std::uint64_t s) { random::rotors(b, s); });
+}
+BENCHMARK(BM_RandomRotors_E3)->Arg(1 << 16);
+
+static void BM_RandomRotors_CGA(benchmark::State& state) {
+    batchFill(state, Signature(4, 1, 0, true), [](MultivectorBatch& b, std::uint64_t s) { random::rotors(b, s); });
+}
+BENCHMARK(BM_RandomRotors_CGA)->Arg(1 << 16);
+
+static void BM_RandomUnitVectors_CGA(benchmark::State& state) {
+    batchFill(state, Signature(4, 1, 0, true), [](MultivectorBatch& b, std::uint64_t s) { random::unitVectors(b, s); });
+}
+BENCHMARK(BM_RandomUnitVectors_CGA)->Arg(1 << 16);
+
+static void BM_RandomBlades2_CGA(benchmark::State& state) {
+    batchFill(state, Signature(4, 1, 0, true), [](MultivectorBatch& b, std::uint64_t s) { random::blades(b, 2, s); });
+}
+BENCHMARK(BM_RandomBlades2_CGA)->Arg(1 << 16);
+
+static void BM_RandomUniformDense_CGA(benchmark::State& state) {
+    batchFill(state, Signature(4, 1, 0, true), [](MultivectorBatch& b, std::uint64_t s) { random::uniform(b, s); });
+}
+BENCHMARK(BM_RandomUniformDense_CGA)->Arg(1 << 16);
+
+static void BM_RandomGaussianDense_CGA(benchmark::State& state) {
+    batchFill(state, Signature(4, 1, 0, true), [](MultivectorBatch& b, std::uint64_t s) { random::gaussian(b, s); });
+}
+BENCHMARK(BM_RandomGaussianDense_CGA)->Arg(1 << 16);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/rotor.h"
+#include "ga/reducedBatch.h"
+
+using namespace ga;
+
+static Rotor benchRotor(const Algebra& alg) {
+    Multivector a(alg), b(alg);
+    a.setComponent(Blade::getBasis(0), 1.0f);
+    b.setComponent(Blade::getBasis(1), 1.0f);
+    return Rotor::fromPlaneAngle(a, b, 0.3f);
+}
+
+// -----------------------------------------------------------------------------
+// Streaming vector rotation: float vs 16-bit storage
+// -----------------------------------------------------------------------------
+
+static void BM_RotateVectors_Float(benchmark::State& state) {
+    Signature sig(3,0,0,true);
+    Algebra alg(sig);
+    const LinearMap L = benchRotor(alg).toLinearMap();
+    CompoundMap vectors = L.compound(1);
+
+    MultivectorBatch batch(alg, static_cast<std::size_t>(state.range(0)));
+    for (float& c : batch.data) c = 0.25f;
+
+    for (auto _ : state) {
+        vectors.apply(batch, batch);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RotateVectors_Float)->Arg(1 << 20);
+
+template <class Format>
+static void BM_RotateVectors_Reduced(benchmark::State& state) {
+    Signature sig(3,0,0,true);
+    Algebra alg(sig);
+    const Rotor R = benchRotor(alg);
+
+    ReducedBatch<Format> batch(alg, static_cast<std::size_t>(state.range(0)));
+    for (auto& c : batch.data) c = Format::fromFloat(0.25f);
+
+    for (auto _ : state) {
+        applyRotor(R, batch, batch);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RotateVectors_Reduced, Fp16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_RotateVectors_Reduced, BFloat16)->Arg(1 << 20);
+
+// End benchmark file
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/reflect.h"
+#include "ga/versor.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector vec(const Algebra& alg, float seed) {
+    Multivector v(alg);
+    for (int k = 0; k < alg.dimensions; ++k) v.setComponent(Blade::getBasis(k), std::sin(seed + 1.1f * k));
+    return v;
+}
+
+// -----------------------------------------------------------------------------
+// One vector in one hyperplane: closed form vs inverse + two products
+// -----------------------------------------------------------------------------
+
+static void BM_ReflectVector_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const Multivector n = vec(alg, 0.3f), v = vec(alg, 1.9f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reflectVector(v, n));
+    }
+}
+BENCHMARK(BM_ReflectVector_CGA);
+
+static void BM_ReflectVectorSandwich_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const Multivector n = vec(alg, 0.3f), v = vec(alg, 1.9f);
+    for (auto _ : state) {
+        const Multivector inv = Versor(n).inverse();
+        benchmark::DoNotOptimize(geometricProduct(geometricProduct(n, v), inv));
+    }
+}
+BENCHMARK(BM_ReflectVectorSandwich_CGA);
+
+// -----------------------------------------------------------------------------
+// Batches: many vectors / one mirror, one vector / many mirrors (items/s)
+// -----------------------------------------------------------------------------
+
+static void BM_ReflectVectorsBatch_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    MultivectorBatch in(alg, n), out(alg, n);
+    for (std::size_t i = 0; i < n; ++i) in.set(i, vec(alg, 0.01f * static_cast<float>(i)));
+    const Multivector mirror = vec(alg, 0.3f);
+    for (auto _ : state) {
+        reflectVectors(in, mirror, out);
+        benchmark::DoNotOptimize(out.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ReflectVectorsBatch_CGA)->Arg(1 << 16);
+
+static void BM_ReflectManyMirrors_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    MultivectorBatch mirrors(alg, n), out(alg, n);
+    for (std::size_t i = 0; i < n; ++i) mirrors.set(i, vec(alg, 0.5f + 0.01f * static_cast<float>(i)));
+    const Multivector v = vec(alg, 1.9f);
+    for (auto _ : state) {
+        reflectVectors(v, mirrors, out);
+        benchmark::DoNotOptimize(out.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ReflectManyMirrors_CGA)->Arg(1 << 16);
+
+static void BM_ReflectBatchGeneral_CGA(benchmark::State& state) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    MultivectorBatch in(alg, n), out(alg, n);
+    for (std::size_t i = 0; i < n; ++i) in.set(i, vec(alg, 0.01f * static_cast<float>(i)));
+    const Multivector mirror = vec(alg, 0.3f);
+    for (auto _ : state) {
+        reflect(in, mirror, out);
+        benchmark::DoNotOptimize(out.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ReflectBatchGeneral_CGA)->Arg(1 << 16);
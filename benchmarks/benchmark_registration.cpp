@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/pga.h"
+#include "ga/registration.h"
+
+using namespace ga;
+using namespace ga::registration;
+
+// Two clouds related by a small rigid motion, stored SoA
+struct BenchClouds {
+    std::vector<float> sx, sy, sz, tx, ty, tz;
+
+    explicit BenchClouds(std::size_t n) {
+        const float c = std::cos(0.1f), s = std::sin(0.1f);
+        for (std::size_t i = 0; i < n; ++i) {
+            const float t = static_cast<float>(i);
+            const float x = std::sin(0.7f * t) * 2.0f, y = std::cos(1.3f * t), z = 0.01f * t;
+            sx.push_back(x); sy.push_back(y); sz.push_back(z);
+            tx.push_back(c * x - s * y + 0.2f); ty.push_back(s * x + c * y); tz.push_back(z - 0.1f);
+        }
+    }
+
+    PointSetView source() const { return {sx.data(), sy.data(), sz.data(), sx.size()}; }
+    PointSetView target() const { return {tx.data(), ty.data(), tz.data(), tx.size()}; }
+};
+
+// -----------------------------------------------------------------------------
+// Registration benchmarks
+// -----------------------------------------------------------------------------
+
+static void BM_FitMotor_PGA(benchmark::State& state) {
+    BenchClouds clouds(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitMotor(pga::algebra, clouds.source(), clouds.target()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FitMotor_PGA)->Arg(256)->Arg(4096);
+
+static void BM_Icp_PGA(benchmark::State& state) {
+    BenchClouds clouds(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(icp(pga::algebra, clouds.source(), clouds.target()));
+    }
+}
+BENCHMARK(BM_Icp_PGA)->Arg(256);
+
+// End benchmark file
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/random.h"
+#include "ga/spinor.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static const Algebra& algebraOf(int which) {
+    static const Algebra pauli(Signature(3, 0, 0, true));
+    static const Algebra dirac(Signature(1, 3, 0, true));
+    return which == 0 ? pauli : dirac;
+}
+
+static unsigned evenGrades(const Algebra& alg) { return alg.dimensions == 3 ? 0b0101u : 0b10101u; }
+
+static spinor::Ensemble makeEnsemble(const Algebra& alg, std::size_t n) {
+    spinor::Ensemble e(alg, n);
+    random::Stream rng(1);
+    for (std::size_t i = 0; i < n; ++i) e.set(i, rng.multivector(alg, evenGrades(alg)));
+    spinor::normalize(e);
+    return e;
+}
+
+static spinor::Fields makeFields(const Algebra& alg, std::size_t n) {
+    spinor::Fields f(alg, n);
+    random::Stream rng(2);
+    for (float& x : f.data) x = rng.uniform(-1.0f, 1.0f);
+    return f;
+}
+
+// -----------------------------------------------------------------------------
+// One time step per particle with a per-particle field: dense Multivector
+// exp + product + normalize vs the fused ensemble kernel. Arg 0: Pauli, 1: Dirac.
+// -----------------------------------------------------------------------------
+
+static void BM_SpinorStepDense(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const std::size_t n = 1 << 14;
+    const spinor::Ensemble e = makeEnsemble(alg, n);
+    const spinor::Fields f = makeFields(alg, n);
+    std::vector<Multivector> psi, field;
+    for (std::size_t i = 0; i < n; ++i) {
+        psi.push_back(e.get(i));
+        Multivector B(alg);
+        for (std::size_t k = 0; k < f.bivectors(); ++k) B.setComponent(f.mask(k), f.column(k)[i]);
+        field.push_back(B);
+    }
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n; ++i) {
+            psi[i] = geometricProduct(spinor::exp(0.01f * field[i]), psi[i]);
+            const float norm2 = geometricProduct(psi[i], reverse(psi[i])).component(0);
+            psi[i] = (1.0f / std::sqrt(norm2)) * psi[i];
+        }
+        benchmark::DoNotOptimize(psi.back());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_SpinorStepDense)->Arg(0)->Arg(1);
+
+static void BM_SpinorStepFields(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const std::size_t n = 1 << 14;
+    spinor::Ensemble e = makeEnsemble(alg, n);
+    const spinor::Fields f = makeFields(alg, n);
+    for (auto _ : state) {
+        spinor::evolve(e, f, 0.01f);
+        benchmark::DoNotOptimize(e.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_SpinorStepFields)->Arg(0)->Arg(1);
+
+// Uniform field: one K x K product per spinor
+static void BM_SpinorStepUniform(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const std::size_t n = 1 << 20;
+    spinor::Ensemble e = makeEnsemble(alg, n);
+    const Multivector B = random::Stream(4).multivector(alg, 0b100);
+    for (auto _ : state) {
+        spinor::evolve(e, B, 0.01f);
+        benchmark::DoNotOptimize(e.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_SpinorStepUniform)->Arg(0)->Arg(1);
+
+static void BM_SpinorNormalize(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    spinor::Ensemble e = makeEnsemble(alg, 1 << 20);
+    for (auto _ : state) {
+        spinor::normalize(e);
+        benchmark::DoNotOptimize(e.data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(e.count));
+}
+BENCHMARK(BM_SpinorNormalize)->Arg(0)->Arg(1);
+
+static void BM_SpinorMoments(benchmark::State& state) {
+    const Algebra& alg = algebraOf(static_cast<int>(state.range(0)));
+    const spinor::Ensemble e = makeEnsemble(alg, 1 << 20);
+    for (auto _ : state) benchmark::DoNotOptimize(spinor::moments(e));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(e.count));
+}
+BENCHMARK(BM_SpinorMoments)->Arg(0)->Arg(1);
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/pga.h"
+#include "ga/spline.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static std::vector<Multivector> motorKeys(int n) {
+    static constexpr BladeMask masks[] = {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100};
+    std::vector<Multivector> keys;
+    for (int i = 0; i < n; ++i) {
+        Multivector B(pga::algebra);
+        for (int k = 0; k < 6; ++k) B.setComponent(masks[k], 0.6f * std::sin(0.7f * i + 1.3f * k));
+        keys.push_back(spline::motorExp(B));
+    }
+    return keys;
+}
+
+static std::vector<float> samples(float duration, std::size_t count) {
+    std::vector<float> t(count);
+    for (std::size_t i = 0; i < count; ++i) t[i] = duration * static_cast<float>(i) / static_cast<float>(count);
+    return t;
+}
+
+// -----------------------------------------------------------------------------
+// Single evaluation: compact spline vs a dense slerp built from Multivector products
+// -----------------------------------------------------------------------------
+
+static void BM_SplineSquadEvaluate(benchmark::State& state) {
+    const spline::Squad s(motorKeys(16));
+    float t = 0.0f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(s.evaluate(t));
+        t = t > 14.0f ? 0.0f : t + 0.013f;
+    }
+}
+BENCHMARK(BM_SplineSquadEvaluate);
+
+static void BM_SplineBSplineEvaluate(benchmark::State& state) {
+    const spline::BSpline b(motorKeys(16));
+    float t = 0.0f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(b.evaluate(t));
+        t = t > 16.0f ? 0.0f : t + 0.013f;
+    }
+}
+BENCHMARK(BM_SplineBSplineEvaluate);
+
+static void BM_SplineDenseSlerp(benchmark::State& state) {
+    const std::vector<Multivector> keys = motorKeys(16);
+    const Multivector L = spline::motorLog(geometricProduct(reverse(keys[3]), keys[4]));
+    float u = 0.0f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geometricProduct(keys[3], spline::motorExp(u * L)));
+        u = u > 1.0f ? 0.0f : u + 0.013f;
+    }
+}
+BENCHMARK(BM_SplineDenseSlerp);
+
+// -----------------------------------------------------------------------------
+// Batched plans: samples/s into SoA batches
+// -----------------------------------------------------------------------------
+
+static void BM_SplineBSplineBatch(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const spline::BSpline b(motorKeys(64));
+    const std::vector<float> t = samples(b.duration(), count);
+    MultivectorBatch out(pga::algebra, count);
+    for (auto _ : state) {
+        b.evaluate(t.data(), count, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(count));
+}
+BENCHMARK(BM_SplineBSplineBatch)->Arg(1 << 14)->Arg(1 << 20);
+
+static void BM_SplineBSplineVelocityBatch(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const spline::BSpline b(motorKeys(64));
+    const std::vector<float> t = samples(b.duration(), count);
+    MultivectorBatch out(pga::algebra, count);
+    for (auto _ : state) {
+        b.velocity(t.data(), count, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(count));
+}
+BENCHMARK(BM_SplineBSplineVelocityBatch)->Arg(1 << 20);
+
+static void BM_SplineSquadBatch(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const spline::Squad s(motorKeys(64));
+    const std::vector<float> t = samples(s.duration(), count);
+    MultivectorBatch out(pga::algebra, count);
+    for (auto _ : state) {
+        s.evaluate(t.data(), count, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(count));
+}
+BENCHMARK(BM_SplineSquadBatch)->Arg(1 << 14)->Arg(1 << 20);
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+#include "ga/signature.h"
+#include "ga/tables.h"
+
+using namespace ga;
+
+static std::string benchPath(int dims) {
+    return (std::filesystem::temp_directory_path() / ("gasmith-bench-tables-" + std::to_string(dims) + ".bin")).string();
+}
+
+// -----------------------------------------------------------------------------
+// Cold start of one metric's tables: building them vs mapping a table file
+// (open + mmap + header check + payload checksum)
+// -----------------------------------------------------------------------------
+
+static void BM_TablesBuild(benchmark::State& state) {
+    const Signature sig(static_cast<int>(state.range(0)), 0, 0, true);
+    for (auto _ : state) {
+        ProductTables t(sig);
+        benchmark::DoNotOptimize(t.sign);
+    }
+}
+BENCHMARK(BM_TablesBuild)->DenseRange(6, 8)->Unit(benchmark::kMicrosecond);
+
+static void BM_TablesLoad(benchmark::State& state) {
+    const int dims = static_cast<int>(state.range(0));
+    const Signature sig(dims, 0, 0, true);
+    const std::string path = benchPath(dims);
+    if (!saveTables(ProductTables(sig), sig, path)) {
+        state.SkipWithError("cannot write table file");
+        return;
+    }
+    for (auto _ : state) {
+        auto t = loadTables(sig, path);
+        benchmark::DoNotOptimize(t);
+    }
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_TablesLoad)->DenseRange(6, 8)->Unit(benchmark::kMicrosecond);
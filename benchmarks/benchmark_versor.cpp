@@ -1,9 +1,13 @@
 #include <benchmark/benchmark.h>
 
+#include <cmath>
+
 #include "ga/signature.h"
 #include "ga/algebra.h"
 #include "ga/multivector.h"
 #include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/selective.h"
 #include "ga/versor.h"
 #include "ga/rotor.h"
 
@@ -108,4 +112,85 @@ static void BM_RotorApply_STA(benchmark::State& state) {
 }
 BENCHMARK(BM_RotorApply_STA);
 
+// -----------------------------------------------------------------------------
+// Norm of a dense multivector: full product vs output-selective scalar part
+// -----------------------------------------------------------------------------
+
+static Multivector denseMv(const Algebra& alg) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        m.storage[i] = 0.01f * static_cast<float>(i + 1);
+    }
+    return m;
+}
+
+static void BM_NormFullProduct_Cl6(benchmark::State& state) {
+    Signature sig(6,0,0,true);
+    Algebra alg(sig);
+    Multivector A = denseMv(alg);
+    Multivector Arev = reverse(A);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geometricProduct(A, Arev).component(0));
+    }
+}
+BENCHMARK(BM_NormFullProduct_Cl6);
+
+static void BM_NormScalarProduct_Cl6(benchmark::State& state) {
+    Signature sig(6,0,0,true);
+    Algebra alg(sig);
+    Multivector A = denseMv(alg);
+    Multivector Arev = reverse(A);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scalarProduct(A, Arev));
+    }
+}
+BENCHMARK(BM_NormScalarProduct_Cl6);
+
+// -----------------------------------------------------------------------------
+// Classified apply paths vs the generic V X V^{-1} (range(0): 0 = generic)
+// -----------------------------------------------------------------------------
+
+static Multivector genericApply(const Versor& V, const Multivector& X) {
+    return geometricProduct(geometricProduct(V.value(), X), V.inverse());
+}
+
+static void BM_VersorReflect_E3(benchmark::State& state) {
+    Algebra alg(Signature(3, 0, 0, true));
+    const Versor n(basisVec(alg, 0) * 0.6f + basisVec(alg, 2) * -1.1f);
+    const Multivector x = basisVec(alg, 0) * 0.3f + basisVec(alg, 1) * -1.2f;
+    const bool generic = state.range(0) == 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generic ? genericApply(n, x) : n.apply(x));
+    }
+}
+BENCHMARK(BM_VersorReflect_E3)->Arg(0)->Arg(1);
+
+static void BM_VersorMotorPoint_PGA(benchmark::State& state) {
+    Algebra alg(Signature(3, 0, 1, true));
+    // Translator * rotor; both factors are unit so M ~M = 1
+    Multivector rot(alg);
+    rot.setComponent(0b0000, std::cos(0.4f));
+    rot.setComponent(0b0011, -std::sin(0.4f));
+    Multivector trans(alg);
+    trans.setComponent(0b0000, 1.0f);
+    trans.setComponent(0b1001, -0.75f);
+    trans.setComponent(0b1010, 0.35f);
+    const Versor V(geometricProduct(trans, rot));
+
+    Multivector P(alg);
+    P.setComponent(0b0111, 1.0f);
+    P.setComponent(0b1110, -0.2f);
+    P.setComponent(0b1101, 1.4f);
+    P.setComponent(0b1011, -0.9f);
+    const bool generic = state.range(0) == 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generic ? genericApply(V, P) : V.apply(P));
+    }
+    state.SetLabel(V.path() == VersorPath::UnitEven ? "unit-even" : "general");
+}
+BENCHMARK(BM_VersorMotorPoint_PGA)->Arg(0)->Arg(1);
+
 // End benchmark file
@@ -0,0 +1,303 @@
+#pragma once
+
+// Per-call latency measurement for GASmith_latency.
+//
+// Google Benchmark reports the mean over a timed loop, which hides the rare
+// slow call (a page fault, a mispredicted branch, a cold cache line). Here
+// every call is timed on its own with the time-stamp counter:
+//
+//   lfence; rdtsc; lfence   call   rdtscp; lfence
+//
+// The counter is calibrated against steady_clock, the cost of an empty timed
+// region is subtracted, and the samples go into a log-linear histogram
+// (HdrHistogram layout, 32 sub-buckets per power of two, < 3.2% relative
+// error) from which any percentile can be read. Without a TSC the harness
+// falls back to steady_clock.
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GA_LATENCY_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace ga_latency {
+
+    // -------------------------------------------------------------------------
+    // Tick source
+    // -------------------------------------------------------------------------
+
+    // Start of a timed region: earlier instructions retire before the read,
+    // later ones do not start before it.
+    inline std::uint64_t ticksBegin() {
+#if GA_LATENCY_TSC
+        _mm_lfence();
+        const std::uint64_t t = __rdtsc();
+        _mm_lfence();
+        return t;
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // End of a timed region: rdtscp waits for the call to retire.
+    inline std::uint64_t ticksEnd() {
+#if GA_LATENCY_TSC
+        unsigned aux = 0;
+        const std::uint64_t t = __rdtscp(&aux);
+        _mm_lfence();
+        return t;
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Keep `value` (and the work that produced it) alive without a store
+    template <class T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    // True when the TSC runs at a constant rate across P-states and C-states
+    inline bool invariantTsc() {
+#if GA_LATENCY_TSC && !defined(_MSC_VER)
+        unsigned a = 0, b = 0, c = 0, d = 0;
+        if (!__get_cpuid(0x80000007u, &a, &b, &c, &d)) return false;
+        return (d >> 8) & 1u;
+#else
+        return false;
+#endif
+    }
+
+    struct Clock {
+        double nsPerTick = 1.0;
+        std::uint64_t overheadTicks = 0;  ///< smallest empty timed region
+        bool tsc = false;
+        bool invariant = false;
+
+        [[nodiscard]] std::uint64_t toNs(const std::uint64_t ticks) const {
+            const std::uint64_t t = ticks > overheadTicks ? ticks - overheadTicks : 0;
+            return static_cast<std::uint64_t>(static_cast<double>(t) * nsPerTick + 0.5);
+        }
+
+        // Median of three ~20 ms spins against steady_clock, then the timer overhead
+        static Clock calibrate() {
+            Clock c;
+#if GA_LATENCY_TSC
+            c.tsc = true;
+            c.invariant = invariantTsc();
+            double rates[3];
+            for (double& rate : rates) {
+                const auto w0 = std::chrono::steady_clock::now();
+                const std::uint64_t t0 = ticksBegin();
+                auto w1 = w0;
+                while (w1 - w0 < std::chrono::milliseconds(20)) w1 = std::chrono::steady_clock::now();
+                const std::uint64_t t1 = ticksEnd();
+                rate = std::chrono::duration<double, std::nano>(w1 - w0).count() / static_cast<double>(t1 - t0);
+            }
+            std::sort(rates, rates + 3);
+            c.nsPerTick = rates[1];
+#endif
+            std::uint64_t best = ~std::uint64_t{0};
+            for (int i = 0; i < 20000; ++i) {
+                const std::uint64_t t0 = ticksBegin();
+                const std::uint64_t t1 = ticksEnd();
+                best = std::min(best, t1 - t0);
+            }
+            c.overheadTicks = best;
+            return c;
+        }
+    };
+
+    // -------------------------------------------------------------------------
+    // Histogram
+    // -------------------------------------------------------------------------
+
+    // Values below 2 * SUB are exact; above, each power of two [2^k, 2^(k+1))
+    // splits into SUB equal buckets.
+    class Histogram {
+    public:
+        static constexpr int SUB_BITS = 5;
+        static constexpr std::uint64_t SUB = std::uint64_t{1} << SUB_BITS;
+
+        Histogram() : counts_(index(~std::uint64_t{0}) + 1, 0) {}
+
+        static std::size_t index(const std::uint64_t v) {
+            if (v < 2 * SUB) return static_cast<std::size_t>(v);
+            const int e = std::bit_width(v) - (SUB_BITS + 1);  // >= 1
+            return static_cast<std::size_t>(2 * SUB + (e - 1) * SUB + ((v >> e) - SUB));
+        }
+
+        static std::uint64_t lowest(const std::size_t i) {
+            if (i < 2 * SUB) return i;
+            const std::size_t e = (i - 2 * SUB) / SUB + 1;
+            const std::uint64_t m = SUB + (i - 2 * SUB) % SUB;
+            return m << e;
+        }
+
+        static std::uint64_t highest(const std::size_t i) {
+            if (i < 2 * SUB) return i;
+            const std::size_t e = (i - 2 * SUB) / SUB + 1;
+            return lowest(i) + ((std::uint64_t{1} << e) - 1);
+        }
+
+        void record(const std::uint64_t v) {
+            ++counts_[index(v)];
+            ++count_;
+            sum_ += static_cast<double>(v);
+            min_ = std::min(min_, v);
+            max_ = std::max(max_, v);
+        }
+
+        [[nodiscard]] std::uint64_t count() const { return count_; }
+        [[nodiscard]] std::uint64_t min() const { return count_ ? min_ : 0; }
+        [[nodiscard]] std::uint64_t max() const { return max_; }
+        [[nodiscard]] double mean() const { return count_ ? sum_ / static_cast<double>(count_) : 0.0; }
+        [[nodiscard]] const std::vector<std::uint64_t>& counts() const { return counts_; }
+
+        // Upper edge of the bucket holding the sample of rank ceil(p / 100 * count)
+        [[nodiscard]] std::uint64_t percentile(const double p) const {
+            if (count_ == 0) return 0;
+            const double want = p / 100.0 * static_cast<double>(count_);
+            const std::uint64_t rank = std::clamp<std::uint64_t>(static_cast<std::uint64_t>(want + 0.999999), 1, count_);
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < counts_.size(); ++i) {
+                seen += counts_[i];
+                if (seen >= rank) return std::min(highest(i), max_);
+            }
+            return max_;
+        }
+
+    private:
+        std::vector<std::uint64_t> counts_;
+        std::uint64_t count_ = 0;
+        std::uint64_t min_ = ~std::uint64_t{0};
+        std::uint64_t max_ = 0;
+        double sum_ = 0.0;
+    };
+
+    // -------------------------------------------------------------------------
+    // Runner
+    // -------------------------------------------------------------------------
+
+    struct Options {
+        std::size_t samples = 200000;
+        std::size_t warmup = 10000;
+        std::uint64_t seed = 1;
+    };
+
+    /**
+     * Time `samples` calls of fn(input), each on its own, after `warmup`
+     * untimed calls. Inputs are visited in a shuffled order so consecutive
+     * calls see different shapes (blade sparsity, versor paths) and the branch
+     * predictor cannot learn the sequence.
+     */
+    template <class Input, class Fn>
+    Histogram measure(const Clock& clock, const std::vector<Input>& inputs, const Options& opt, Fn&& fn) {
+        std::vector<std::uint32_t> order(inputs.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::uint64_t state = opt.seed * 0x9E3779B97F4A7C15ull + 1;
+        const auto nextRandom = [&state] {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        };
+        for (std::size_t i = order.size(); i > 1; --i) std::swap(order[i - 1], order[nextRandom() % i]);
+
+        std::size_t at = 0;
+        const auto next = [&]() -> const Input& {
+            if (at == order.size()) {
+                at = 0;
+                // Rotate by a random offset so the sequence does not repeat with period |inputs|
+                std::rotate(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(nextRandom() % order.size()), order.end());
+            }
+            return inputs[order[at++]];
+        };
+
+        for (std::size_t i = 0; i < opt.warmup; ++i) doNotOptimize(fn(next()));
+
+        Histogram h;
+        for (std::size_t i = 0; i < opt.samples; ++i) {
+            const Input& x = next();
+            const std::uint64_t t0 = ticksBegin();
+            const auto r = fn(x);
+            const std::uint64_t t1 = ticksEnd();
+            doNotOptimize(r);
+            h.record(clock.toNs(t1 - t0));
+        }
+        return h;
+    }
+
+    // -------------------------------------------------------------------------
+    // JSON
+    // -------------------------------------------------------------------------
+
+    inline constexpr double PERCENTILES[] = {50.0, 90.0, 99.0, 99.9, 99.99, 99.999};
+
+    inline std::string jsonString(const std::string& s) {
+        std::string out = "\"";
+        for (const char ch : s) {
+            if (ch == '"' || ch == '\\') {
+                out += '\\';
+                out += ch;
+            } else if (static_cast<unsigned char>(ch) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof buf, "\\u%04x", ch);
+                out += buf;
+            } else {
+                out += ch;
+            }
+        }
+        return out + "\"";
+    }
+
+    // One result object: summary, percentiles and the non-empty buckets as [low, high, count]
+    inline std::string toJson(const std::string& name, const std::size_t inputs, const Histogram& h) {
+        char buf[128];
+        std::string out = "    {\n      \"name\": " + jsonString(name) + ",\n";
+        std::snprintf(buf, sizeof buf, "      \"samples\": %llu,\n      \"inputs\": %zu,\n      \"unit\": \"ns\",\n",
+                      static_cast<unsigned long long>(h.count()), inputs);
+        out += buf;
+        std::snprintf(buf, sizeof buf, "      \"min\": %llu,\n      \"mean\": %.2f,\n      \"max\": %llu,\n",
+                      static_cast<unsigned long long>(h.min()), h.mean(), static_cast<unsigned long long>(h.max()));
+        out += buf;
+        out += "      \"percentiles\": {";
+        for (std::size_t i = 0; i < std::size(PERCENTILES); ++i) {
+            std::snprintf(buf, sizeof buf, "%s\"%g\": %llu", i ? ", " : "", PERCENTILES[i],
+                          static_cast<unsigned long long>(h.percentile(PERCENTILES[i])));
+            out += buf;
+        }
+        out += "},\n      \"histogram\": [";
+        bool first = true;
+        for (std::size_t i = 0; i < h.counts().size(); ++i) {
+            if (!h.counts()[i]) continue;
+            std::snprintf(buf, sizeof buf, "%s[%llu, %llu, %llu]", first ? "" : ", ",
+                          static_cast<unsigned long long>(Histogram::lowest(i)),
+                          static_cast<unsigned long long>(Histogram::highest(i)),
+                          static_cast<unsigned long long>(h.counts()[i]));
+            out += buf;
+            first = false;
+        }
+        return out + "]\n    }";
+    }
+
+} // namespace ga_latency
@@ -0,0 +1,232 @@
+// Per-call latency percentiles of single GASmith operations.
+//
+//   GASmith_latency [--samples=N] [--inputs=K] [--seed=S] [--filter=substr] [--out=file.json]
+//
+// Every case draws K inputs that mix sparsity patterns (random grade sets,
+// randomly zeroed coefficients, axis-aligned and general versors), times N
+// calls one at a time in a shuffled input order (see ga_latency.h) and
+// reports min / mean / max, the 50 ... 99.999th percentiles and the full
+// histogram in nanoseconds. JSON goes to --out (or stdout); a summary table
+// goes to stderr.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "ga_latency.h"
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/random.h"
+#include "ga/rotor.h"
+#include "ga/versor.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+namespace {
+
+    std::string getenv_or(const char* key, const char* fallback) {
+        if (const char* v = std::getenv(key)) return v;
+        return fallback;
+    }
+
+    // Coefficients on a random non-empty set of grades; half the time each coefficient is also dropped with p = 1/2
+    Multivector sparseMultivector(const Algebra& alg, random::Stream& rng) {
+        const unsigned all = (1u << (alg.dimensions + 1)) - 1;
+        unsigned grades = 0;
+        while (grades == 0) grades = rng.next() & all;
+        Multivector m = rng.multivector(alg, grades);
+        if (rng.next() & 1u) {
+            const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (rng.next() & 1u) m.storage[i] = 0.0f;
+            }
+        }
+        return m;
+    }
+
+    // Haar rotor, single-plane rotor or identity
+    Rotor mixedRotor(const Algebra& alg, const Signature& sig, random::Stream& rng) {
+        switch (rng.next() % 3) {
+            case 0: return rng.rotor(alg);
+            case 1: {
+                const int i = static_cast<int>(rng.next() % sig.p());
+                const int j = (i + 1 + static_cast<int>(rng.next() % (sig.p() - 1))) % sig.p();
+                Multivector B(alg);
+                B.setComponent(static_cast<BladeMask>(Blade::getBasis(i) | Blade::getBasis(j)), 1.0f);
+                return Rotor::fromBivectorAngle(B, rng.uniform(-3.0f, 3.0f));
+            }
+            default: {
+                Multivector one(alg);
+                one.setComponent(0, 1.0f);
+                return Rotor(one);
+            }
+        }
+    }
+
+    // Product of 1..4 unit vectors on positive axes, each axis-aligned or general
+    Versor mixedVersor(const Algebra& alg, const Signature& sig, random::Stream& rng) {
+        const int k = 1 + static_cast<int>(rng.next() % 4);
+        Multivector v(alg);
+        v.setComponent(0, 1.0f);
+        for (int i = 0; i < k; ++i) {
+            Multivector a(alg);
+            if (rng.next() & 1u) {
+                a.setComponent(Blade::getBasis(static_cast<int>(rng.next() % sig.p())), 1.0f);
+            } else {
+                a = rng.unitVector(alg);
+            }
+            v = geometricProduct(v, a);
+        }
+        return Versor(alg, v);
+    }
+
+    struct Case {
+        std::string name;
+        // Draws `k` inputs, then measures
+        std::function<ga_latency::Histogram(const ga_latency::Clock&, std::size_t k, const ga_latency::Options&)> run;
+    };
+
+    struct RotorInput { Rotor R; Multivector X; };
+    struct VersorInput { Versor V; Multivector X; };
+    struct PairInput { Multivector A, B; };
+
+    Case rotorApply(const std::string& label, const Signature sig) {
+        return {"Rotor::apply/" + label, [sig](const ga_latency::Clock& clock, const std::size_t k,
+                                               const ga_latency::Options& opt) {
+            const Algebra alg(sig);
+            random::Stream rng(opt.seed, 1);
+            std::vector<RotorInput> in;
+            for (std::size_t i = 0; i < k; ++i) in.push_back({mixedRotor(alg, sig, rng), sparseMultivector(alg, rng)});
+            return ga_latency::measure(clock, in, opt, [](const RotorInput& x) { return x.R.apply(x.X); });
+        }};
+    }
+
+    Case versorInverse(const std::string& label, const Signature sig) {
+        return {"Versor::inverse/" + label, [sig](const ga_latency::Clock& clock, const std::size_t k,
+                                                  const ga_latency::Options& opt) {
+            const Algebra alg(sig);
+            random::Stream rng(opt.seed, 2);
+            std::vector<VersorInput> in;
+            for (std::size_t i = 0; i < k; ++i) in.push_back({mixedVersor(alg, sig, rng), Multivector(alg)});
+            return ga_latency::measure(clock, in, opt, [](const VersorInput& x) { return x.V.inverse(); });
+        }};
+    }
+
+    Case versorApply(const std::string& label, const Signature sig) {
+        return {"Versor::apply/" + label, [sig](const ga_latency::Clock& clock, const std::size_t k,
+                                                const ga_latency::Options& opt) {
+            const Algebra alg(sig);
+            random::Stream rng(opt.seed, 3);
+            std::vector<VersorInput> in;
+            for (std::size_t i = 0; i < k; ++i) in.push_back({mixedVersor(alg, sig, rng), sparseMultivector(alg, rng)});
+            return ga_latency::measure(clock, in, opt, [](const VersorInput& x) { return x.V.apply(x.X); });
+        }};
+    }
+
+    Case product(const std::string& label, const Signature sig) {
+        return {"geometricProduct/" + label, [sig](const ga_latency::Clock& clock, const std::size_t k,
+                                                   const ga_latency::Options& opt) {
+            const Algebra alg(sig);
+            random::Stream rng(opt.seed, 4);
+            std::vector<PairInput> in;
+            for (std::size_t i = 0; i < k; ++i) in.push_back({sparseMultivector(alg, rng), sparseMultivector(alg, rng)});
+            return ga_latency::measure(clock, in, opt, [](const PairInput& x) { return geometricProduct(x.A, x.B); });
+        }};
+    }
+
+    bool option(const char* arg, const char* name, std::string& value) {
+        const std::size_t n = std::strlen(name);
+        if (std::strncmp(arg, name, n) != 0 || arg[n] != '=') return false;
+        value = arg + n + 1;
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ga_latency::Options opt;
+    std::size_t inputs = 1024;
+    std::string filter, out, value;
+    for (int i = 1; i < argc; ++i) {
+        if (option(argv[i], "--samples", value)) opt.samples = std::strtoull(value.c_str(), nullptr, 10);
+        else if (option(argv[i], "--inputs", value)) inputs = std::strtoull(value.c_str(), nullptr, 10);
+        else if (option(argv[i], "--seed", value)) opt.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (option(argv[i], "--filter", value)) filter = value;
+        else if (option(argv[i], "--out", value)) out = value;
+        else {
+            std::fprintf(stderr, "usage: %s [--samples=N] [--inputs=K] [--seed=S] [--filter=substr] [--out=file.json]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (opt.samples == 0 || inputs == 0) {
+        std::fprintf(stderr, "%s: --samples and --inputs must be positive\n", argv[0]);
+        return 2;
+    }
+    opt.warmup = std::min<std::size_t>(opt.samples / 10, 10000);
+
+    const std::vector<Case> cases = {
+        rotorApply("E3", Signature(3, 0, 0, true)),
+        rotorApply("CGA", Signature(4, 1, 0, true)),
+        versorInverse("E3", Signature(3, 0, 0, true)),
+        versorInverse("CGA", Signature(4, 1, 0, true)),
+        versorApply("E3", Signature(3, 0, 0, true)),
+        versorApply("CGA", Signature(4, 1, 0, true)),
+        product("E3", Signature(3, 0, 0, true)),
+        product("CGA", Signature(4, 1, 0, true)),
+    };
+
+    const ga_latency::Clock clock = ga_latency::Clock::calibrate();
+
+    char buf[256];
+    std::string json = "{\n  \"context\": {\n";
+    std::snprintf(buf, sizeof buf,
+                  "    \"clock\": \"%s\",\n    \"tsc_invariant\": %s,\n    \"ns_per_tick\": %.6f,\n"
+                  "    \"timer_overhead_ns\": %.2f,\n    \"samples\": %zu,\n    \"warmup\": %zu,\n    \"seed\": %llu,\n",
+                  clock.tsc ? "tsc" : "steady_clock", clock.invariant ? "true" : "false", clock.nsPerTick,
+                  static_cast<double>(clock.overheadTicks) * clock.nsPerTick, opt.samples, opt.warmup,
+                  static_cast<unsigned long long>(opt.seed));
+    json += buf;
+    json += "    \"build_type\": " + ga_latency::jsonString(getenv_or("GA_BENCH_BUILD_TYPE", "unknown")) + ",\n";
+    json += "    \"compiler\": " + ga_latency::jsonString(getenv_or("GA_BENCH_COMPILER", "unknown")) + ",\n";
+    json += "    \"git_sha\": " + ga_latency::jsonString(getenv_or("GA_BENCH_GIT_SHA", "unknown")) + ",\n";
+    json += "    \"run_id\": " + ga_latency::jsonString(getenv_or("GA_BENCH_RUN_ID", "unknown")) + "\n";
+    json += "  },\n  \"benchmarks\": [\n";
+
+    if (clock.tsc && !clock.invariant) {
+        std::fprintf(stderr, "warning: TSC is not invariant; latencies may drift with frequency scaling\n");
+    }
+    std::fprintf(stderr, "%-26s %8s %8s %8s %8s %8s   (ns)\n", "case", "p50", "p99", "p99.9", "p99.99", "max");
+
+    bool first = true;
+    for (const Case& c : cases) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+        const ga_latency::Histogram h = c.run(clock, inputs, opt);
+        json += (first ? "" : ",\n") + ga_latency::toJson(c.name, inputs, h);
+        first = false;
+        std::fprintf(stderr, "%-26s %8llu %8llu %8llu %8llu %8llu\n", c.name.c_str(),
+                     static_cast<unsigned long long>(h.percentile(50.0)), static_cast<unsigned long long>(h.percentile(99.0)),
+                     static_cast<unsigned long long>(h.percentile(99.9)), static_cast<unsigned long long>(h.percentile(99.99)),
+                     static_cast<unsigned long long>(h.max()));
+    }
+    json += "\n  ]\n}\n";
+
+    if (out.empty()) {
+        std::fputs(json.c_str(), stdout);
+        return 0;
+    }
+    std::FILE* f = std::fopen(out.c_str(), "w");
+    if (!f) {
+        std::fprintf(stderr, "%s: cannot write %s\n", argv[0], out.c_str());
+        return 1;
+    }
+    std::fputs(json.c_str(), f);
+    std::fclose(f);
+    return 0;
+}
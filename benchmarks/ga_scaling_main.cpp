@@ -0,0 +1,324 @@
+// Thread scaling of the batch and parallel kernels.
+//
+//   GASmith_scaling [--threads=1,2,4] [--sizes=KiB,KiB,...] [--min-time=seconds] [--filter=substr] [--out=file.json]
+//
+// Every kernel runs at each thread count (ga::parallel::setThreadCount) and at
+// each working-set size. The default sizes are 256 KiB (L2-resident), 8 MiB
+// (last-level cache) and 256 MiB (DRAM-bound). A STREAM triad over the largest
+// size is measured at the same thread counts in the same run and serves as the
+// bandwidth baseline.
+//
+// Each row reports the best of at least three runs, plus:
+//   speedup      time at 1 thread / time at t threads (same size)
+//   efficiency   speedup / t
+//   GB/s         the minimum bytes the kernel must move, divided by its time
+//   utilization  GB/s over the triad GB/s at the same thread count
+// JSON goes to --out (or stdout); a table goes to stderr.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ga_latency.h"
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/field.h"
+#include "ga/linearMap.h"
+#include "ga/parallel.h"
+#include "ga/productMatrix.h"
+#include "ga/random.h"
+#include "ga/ops/reflect.h"
+
+using namespace ga;
+
+namespace {
+
+    std::string getenv_or(const char* key, const char* fallback) {
+        if (const char* v = std::getenv(key)) return v;
+        return fallback;
+    }
+
+    // Best wall time of fn() over at least three runs and `minTime` seconds, after one warm-up run
+    double bestSeconds(const double minTime, const std::function<void()>& fn) {
+        using clock = std::chrono::steady_clock;
+        fn();
+        double best = 1e30, total = 0.0;
+        for (int reps = 0; reps < 3 || total < minTime; ++reps) {
+            const auto t0 = clock::now();
+            fn();
+            const double s = std::chrono::duration<double>(clock::now() - t0).count();
+            best = std::min(best, s);
+            total += s;
+        }
+        return best;
+    }
+
+    // A kernel prepared for one working-set size
+    struct Prepared {
+        std::size_t elements = 0;
+        double bytes = 0.0;          ///< minimum traffic of one run
+        std::function<void()> run;
+    };
+
+    struct Kernel {
+        std::string name;
+        std::function<Prepared(std::size_t workingSetBytes)> prepare;
+    };
+
+    const Algebra& e3() {
+        static const Algebra alg(Signature(3, 0, 0, true));
+        return alg;
+    }
+
+    MultivectorBatch filledBatch(const std::size_t n) {
+        MultivectorBatch b(e3(), n);
+        random::uniform(b, 7);
+        return b;
+    }
+
+    Multivector sample(const unsigned grades, const std::uint64_t seed) {
+        random::Stream rng(seed);
+        return rng.multivector(e3(), grades);
+    }
+
+    // Sum of squared coefficients over the batch: per-tile partials, then a serial sum
+    double sumSquares(const MultivectorBatch& b) {
+        static constexpr std::size_t TILE = 4096;
+        const std::size_t tiles = (b.count + TILE - 1) / TILE;
+        const std::size_t N = b.bladeCount();
+        std::vector<double> partial(tiles, 0.0);
+        ga::parallel::parallelFor(tiles, 1, [&](const std::size_t t0, const std::size_t t1) {
+            for (std::size_t t = t0; t < t1; ++t) {
+                const std::size_t base = t * TILE, len = std::min(TILE, b.count - base);
+                float acc = 0.0f;
+                for (std::size_t m = 0; m < N; ++m) {
+                    const float* x = b.column(static_cast<BladeMask>(m)) + base;
+                    for (std::size_t i = 0; i < len; ++i) acc += x[i] * x[i];
+                }
+                partial[t] = acc;
+            }
+        });
+        double sum = 0.0;
+        for (const double p : partial) sum += p;
+        return sum;
+    }
+
+    // In + out columns of an E3 batch: 2 * 8 floats per element
+    constexpr std::size_t FULL_IN_OUT = 2 * 8 * sizeof(float);
+
+    std::vector<Kernel> kernels() {
+        std::vector<Kernel> k;
+
+        k.push_back({"product/E3", [](const std::size_t bytes) {
+            const std::size_t n = std::max<std::size_t>(1, bytes / FULL_IN_OUT);
+            auto in = std::make_shared<MultivectorBatch>(filledBatch(n));
+            auto out = std::make_shared<MultivectorBatch>(e3(), n);
+            auto P = std::make_shared<ProductMatrix>(ProductMatrix::left(sample(~0u, 3)));
+            return Prepared{n, double(n * FULL_IN_OUT), [=] { P->apply(*in, *out); }};
+        }});
+
+        k.push_back({"sandwich/E3", [](const std::size_t bytes) {
+            const std::size_t n = std::max<std::size_t>(1, bytes / FULL_IN_OUT);
+            auto in = std::make_shared<MultivectorBatch>(filledBatch(n));
+            auto out = std::make_shared<MultivectorBatch>(e3(), n);
+            const Multivector mirror = random::Stream(5).unitVector(e3());
+            return Prepared{n, double(n * FULL_IN_OUT), [=] { ops::reflect(*in, mirror, *out); }};
+        }});
+
+        k.push_back({"linear_map/E3", [](const std::size_t bytes) {
+            // Sized by the two full batches that are allocated; only the 3 grade-1
+            // columns of each are touched, so the traffic is 3 in + 3 out
+            constexpr std::size_t perElement = 2 * 3 * sizeof(float);
+            const std::size_t n = std::max<std::size_t>(1, bytes / FULL_IN_OUT);
+            auto in = std::make_shared<MultivectorBatch>(filledBatch(n));
+            auto out = std::make_shared<MultivectorBatch>(e3(), n);
+            auto C = std::make_shared<CompoundMap>(random::Stream(9).rotor(e3()).toLinearMap().compound(1));
+            return Prepared{n, double(n * perElement), [=] { C->apply(*in, *out); }};
+        }});
+
+        k.push_back({"reduction/E3", [](const std::size_t bytes) {
+            constexpr std::size_t perElement = 8 * sizeof(float);
+            const std::size_t n = std::max<std::size_t>(1, bytes / perElement);
+            auto in = std::make_shared<MultivectorBatch>(filledBatch(n));
+            return Prepared{n, double(n * perElement), [=] { ga_latency::doNotOptimize(sumSquares(*in)); }};
+        }});
+
+        k.push_back({"laplacian/E3", [](const std::size_t bytes) {
+            const std::size_t cells = std::max<std::size_t>(8, bytes / FULL_IN_OUT);
+            const auto side = static_cast<std::size_t>(std::max(2.0, std::cbrt(double(cells))));
+            const std::size_t nz = std::max<std::size_t>(1, cells / (side * side));
+            auto F = std::make_shared<field::MultivectorField>(e3(), side, side, nz);
+            for (std::size_t i = 0; i < F->data.size(); ++i) F->data[i] = std::sin(0.01f * float(i));
+            auto out = std::make_shared<field::MultivectorField>(e3(), side, side, nz);
+            const std::size_t n = F->cells();
+            return Prepared{n, double(n * FULL_IN_OUT), [=] { field::laplacian(*F, *out); }};
+        }});
+
+        k.push_back({"random_rotors/E3", [](const std::size_t bytes) {
+            constexpr std::size_t perElement = 8 * sizeof(float);  // output only
+            const std::size_t n = std::max<std::size_t>(1, bytes / perElement);
+            auto out = std::make_shared<MultivectorBatch>(e3(), n);
+            return Prepared{n, double(n * perElement), [=] { random::rotors(*out, 11); }};
+        }});
+
+        return k;
+    }
+
+    // STREAM triad a = b + s c over floats; 12 bytes per element
+    double triadGBs(const std::size_t bytes, const double minTime) {
+        const std::size_t n = std::max<std::size_t>(1, bytes / (3 * sizeof(float)));
+        std::vector<float> a(n, 0.0f), b(n, 1.0f), c(n, 2.0f);
+        static constexpr std::size_t TILE = 1 << 14;
+        const double s = bestSeconds(minTime, [&] {
+            ga::parallel::parallelFor((n + TILE - 1) / TILE, 1, [&](const std::size_t t0, const std::size_t t1) {
+                const std::size_t i0 = t0 * TILE, i1 = std::min(n, t1 * TILE);
+                for (std::size_t i = i0; i < i1; ++i) a[i] = b[i] + 3.0f * c[i];
+            });
+            ga_latency::doNotOptimize(a[n / 2]);
+        });
+        return double(n * 3 * sizeof(float)) / s * 1e-9;
+    }
+
+    std::vector<std::size_t> parseList(const std::string& s) {
+        std::vector<std::size_t> out;
+        for (const char* p = s.c_str(); *p;) {
+            char* end = nullptr;
+            const unsigned long long v = std::strtoull(p, &end, 10);
+            if (end == p) return {};
+            out.push_back(static_cast<std::size_t>(v));
+            p = *end == ',' ? end + 1 : end;
+        }
+        return out;
+    }
+
+    bool option(const char* arg, const char* name, std::string& value) {
+        const std::size_t n = std::strlen(name);
+        if (std::strncmp(arg, name, n) != 0 || arg[n] != '=') return false;
+        value = arg + n + 1;
+        return true;
+    }
+
+    std::string sizeLabel(const std::size_t bytes) {
+        char buf[32];
+        if (bytes >= (1u << 20)) std::snprintf(buf, sizeof buf, "%zuMiB", bytes >> 20);
+        else std::snprintf(buf, sizeof buf, "%zuKiB", bytes >> 10);
+        return buf;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> threads;
+    for (unsigned t = 1; t < hw; t *= 2) threads.push_back(t);
+    threads.push_back(hw);
+    std::vector<std::size_t> sizes = {256u << 10, 8u << 20, 256u << 20};
+    double minTime = 0.2;
+    std::string filter, out, value;
+
+    for (int i = 1; i < argc; ++i) {
+        if (option(argv[i], "--threads", value)) threads = parseList(value);
+        else if (option(argv[i], "--sizes", value)) {
+            sizes = parseList(value);
+            for (std::size_t& s : sizes) s <<= 10;
+        }
+        else if (option(argv[i], "--min-time", value)) minTime = std::strtod(value.c_str(), nullptr);
+        else if (option(argv[i], "--filter", value)) filter = value;
+        else if (option(argv[i], "--out", value)) out = value;
+        else {
+            threads.clear();
+            break;
+        }
+    }
+    if (threads.empty() || sizes.empty() || std::count(threads.begin(), threads.end(), 0u) != 0) {
+        std::fprintf(stderr,
+                     "usage: %s [--threads=1,2,4] [--sizes=KiB,KiB,...] [--min-time=seconds] [--filter=substr] [--out=file.json]\n",
+                     argv[0]);
+        return 2;
+    }
+    threads.push_back(1);  // speedup is relative to one thread
+    std::sort(threads.begin(), threads.end());
+    threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+    const unsigned previousThreads = ga::parallel::threadCount();
+
+    char buf[512];
+    std::string json = "{\n  \"context\": {\n";
+    std::snprintf(buf, sizeof buf, "    \"hardware_concurrency\": %u,\n    \"min_time\": %.3f,\n", hw, minTime);
+    json += buf;
+    json += "    \"build_type\": " + ga_latency::jsonString(getenv_or("GA_BENCH_BUILD_TYPE", "unknown")) + ",\n";
+    json += "    \"compiler\": " + ga_latency::jsonString(getenv_or("GA_BENCH_COMPILER", "unknown")) + ",\n";
+    json += "    \"git_sha\": " + ga_latency::jsonString(getenv_or("GA_BENCH_GIT_SHA", "unknown")) + ",\n";
+    json += "    \"run_id\": " + ga_latency::jsonString(getenv_or("GA_BENCH_RUN_ID", "unknown")) + "\n  },\n";
+
+    // Bandwidth baseline over the largest working set
+    const std::size_t streamBytes = *std::max_element(sizes.begin(), sizes.end());
+    std::map<std::size_t, double> stream;
+    json += "  \"stream_triad\": [\n";
+    std::fprintf(stderr, "STREAM triad over %s\n", sizeLabel(streamBytes).c_str());
+    for (const std::size_t t : threads) {
+        ga::parallel::setThreadCount(static_cast<unsigned>(t));
+        stream[t] = triadGBs(streamBytes, minTime);
+        std::snprintf(buf, sizeof buf, "%s    {\"threads\": %zu, \"size_bytes\": %zu, \"gbs\": %.3f}",
+                      t == threads.front() ? "" : ",\n", t, streamBytes, stream[t]);
+        json += buf;
+        std::fprintf(stderr, "  %3zu threads %8.2f GB/s\n", t, stream[t]);
+    }
+    json += "\n  ],\n  \"benchmarks\": [\n";
+
+    std::fprintf(stderr, "%-18s %7s %4s %11s %8s %6s %8s %6s\n", "kernel", "size", "thr", "time(ms)", "speedup",
+                 "eff", "GB/s", "util");
+    bool first = true;
+    for (const Kernel& k : kernels()) {
+        if (!filter.empty() && k.name.find(filter) == std::string::npos) continue;
+        for (const std::size_t bytes : sizes) {
+            const Prepared p = k.prepare(bytes);
+            double base = 0.0;
+            for (const std::size_t t : threads) {
+                ga::parallel::setThreadCount(static_cast<unsigned>(t));
+                const double s = bestSeconds(minTime, p.run);
+                if (t == 1) base = s;
+                const double speedup = base / s;
+                const double efficiency = speedup / static_cast<double>(t);
+                const double gbs = p.bytes / s * 1e-9;
+                const double utilization = gbs / stream[t];
+                std::snprintf(buf, sizeof buf,
+                              "%s    {\"name\": %s, \"size_bytes\": %zu, \"elements\": %zu, \"threads\": %zu, "
+                              "\"seconds\": %.6e, \"speedup\": %.3f, \"efficiency\": %.3f, \"gbs\": %.3f, "
+                              "\"bandwidth_utilization\": %.3f}",
+                              first ? "" : ",\n", ga_latency::jsonString(k.name).c_str(), bytes, p.elements, t, s,
+                              speedup, efficiency, gbs, utilization);
+                json += buf;
+                first = false;
+                std::fprintf(stderr, "%-18s %7s %4zu %11.3f %8.2f %6.2f %8.2f %6.2f\n", k.name.c_str(),
+                             sizeLabel(bytes).c_str(), t, s * 1e3, speedup, efficiency, gbs, utilization);
+            }
+        }
+    }
+    json += "\n  ]\n}\n";
+    ga::parallel::setThreadCount(previousThreads);
+
+    if (out.empty()) {
+        std::fputs(json.c_str(), stdout);
+        return 0;
+    }
+    std::FILE* f = std::fopen(out.c_str(), "w");
+    if (!f) {
+        std::fprintf(stderr, "%s: cannot write %s\n", argv[0], out.c_str());
+        return 1;
+    }
+    std::fputs(json.c_str(), f);
+    std::fclose(f);
+    return 0;
+}
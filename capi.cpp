@@ -0,0 +1,311 @@
+// Implementation of the C ABI declared in ga/capi.h.
+//
+// Every entry point validates its arguments, then runs a per-item kernel over
+// the strided arrays with ga::parallel::parallelFor. Items are gathered into a
+// Multivector, computed with the normal C++ API and scattered back, so inputs
+// may alias the output. C++ exceptions are translated to status codes here and
+// never reach the caller.
+
+#include "ga/capi.h"
+
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/signature.h"
+#include "ga/multivector.h"
+#include "ga/linearMap.h"
+#include "ga/versor.h"
+#include "ga/rotor.h"
+#include "ga/parallel.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/wedge.h"
+#include "ga/ops/inner.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/dual.h"
+
+struct gasmith_algebra {
+    ga::Algebra alg;
+};
+
+namespace {
+
+    using ga::Multivector;
+
+    thread_local std::string lastError;
+
+    // Items per parallel chunk; a product is O(4^n) so small chunks are fine
+    constexpr std::size_t GRAIN = 256;
+
+    gasmith_status fail(const gasmith_status status, const char* message) {
+        lastError = message;
+        return status;
+    }
+
+    // Run fn() and map any exception to a status code
+    template <class Fn>
+    gasmith_status guarded(Fn&& fn) {
+        try {
+            return fn();
+        } catch (const std::bad_alloc&) {
+            return fail(GASMITH_ERROR_OUT_OF_MEMORY, "out of memory");
+        } catch (const std::invalid_argument& e) {
+            return fail(GASMITH_ERROR_INVALID_ARGUMENT, e.what());
+        } catch (const std::out_of_range& e) {
+            return fail(GASMITH_ERROR_INVALID_ARGUMENT, e.what());
+        } catch (const std::runtime_error& e) {
+            // Versor::inverse / Rotor::normalize on a null multivector
+            return fail(GASMITH_ERROR_DOMAIN, e.what());
+        } catch (const std::exception& e) {
+            return fail(GASMITH_ERROR_INTERNAL, e.what());
+        } catch (...) {
+            return fail(GASMITH_ERROR_INTERNAL, "unknown error");
+        }
+    }
+
+    bool validArray(const gasmith_array* a, const std::size_t count, const bool output) {
+        if (!a || (count > 0 && !a->data)) return false;
+        if (a->item_stride % static_cast<std::ptrdiff_t>(sizeof(float)) != 0 ||
+            a->blade_stride % static_cast<std::ptrdiff_t>(sizeof(float)) != 0) return false;
+        if (reinterpret_cast<std::uintptr_t>(a->data) % alignof(float) != 0) return false;
+        // Broadcasting an output would make every item race on one slot
+        if (output && count > 1 && a->item_stride == 0) return false;
+        return true;
+    }
+
+    gasmith_status checkArrays(const gasmith_algebra* alg, const std::size_t count,
+                               std::initializer_list<const gasmith_array*> inputs,
+                               const gasmith_array* out) {
+        if (!alg) return fail(GASMITH_ERROR_NULL_POINTER, "gasmith: algebra handle is NULL");
+        for (const gasmith_array* a : inputs) {
+            if (!a) return fail(GASMITH_ERROR_NULL_POINTER, "gasmith: input array is NULL");
+            if (!validArray(a, count, false))
+                return fail(GASMITH_ERROR_INVALID_ARGUMENT, "gasmith: input array has a NULL pointer or misaligned stride");
+        }
+        if (!out) return fail(GASMITH_ERROR_NULL_POINTER, "gasmith: output array is NULL");
+        if (!validArray(out, count, true))
+            return fail(GASMITH_ERROR_INVALID_ARGUMENT, "gasmith: output array has a NULL pointer, misaligned or zero item stride");
+        return GASMITH_OK;
+    }
+
+    void load(const gasmith_array& a, const std::size_t i, Multivector& mv) {
+        const char* base = reinterpret_cast<const char*>(a.data) + static_cast<std::ptrdiff_t>(i) * a.item_stride;
+        const std::size_t N = mv.storage.size();
+        for (std::size_t m = 0; m < N; ++m) {
+            mv.storage[m] = *reinterpret_cast<const float*>(base + static_cast<std::ptrdiff_t>(m) * a.blade_stride);
+        }
+    }
+
+    void store(const gasmith_array& a, const std::size_t i, const Multivector& mv) {
+        char* base = reinterpret_cast<char*>(a.data) + static_cast<std::ptrdiff_t>(i) * a.item_stride;
+        const std::size_t N = mv.storage.size();
+        for (std::size_t m = 0; m < N; ++m) {
+            *reinterpret_cast<float*>(base + static_cast<std::ptrdiff_t>(m) * a.blade_stride) = mv.storage[m];
+        }
+    }
+
+    template <class Op>
+    gasmith_status binary(const gasmith_algebra* alg, const std::size_t count, const gasmith_array* a,
+                          const gasmith_array* b, const gasmith_array* out, Op op) {
+        if (const gasmith_status s = checkArrays(alg, count, {a, b}, out); s != GASMITH_OK) return s;
+        return guarded([&] {
+            ga::parallel::parallelFor(count, GRAIN, [&](const std::size_t begin, const std::size_t end) {
+                Multivector A(alg->alg), B(alg->alg);
+                for (std::size_t i = begin; i < end; ++i) {
+                    load(*a, i, A);
+                    load(*b, i, B);
+                    store(*out, i, op(A, B));
+                }
+            });
+            return GASMITH_OK;
+        });
+    }
+
+    template <class Op>
+    gasmith_status unary(const gasmith_algebra* alg, const std::size_t count, const gasmith_array* a,
+                         const gasmith_array* out, Op op) {
+        if (const gasmith_status s = checkArrays(alg, count, {a}, out); s != GASMITH_OK) return s;
+        return guarded([&] {
+            ga::parallel::parallelFor(count, GRAIN, [&](const std::size_t begin, const std::size_t end) {
+                Multivector A(alg->alg);
+                for (std::size_t i = begin; i < end; ++i) {
+                    load(*a, i, A);
+                    store(*out, i, op(A));
+                }
+            });
+            return GASMITH_OK;
+        });
+    }
+
+} // namespace
+
+extern "C" {
+
+int gasmith_abi_version(void) {
+    return GASMITH_ABI_VERSION;
+}
+
+const char* gasmith_status_string(const gasmith_status status) {
+    switch (status) {
+        case GASMITH_OK: return "ok";
+        case GASMITH_ERROR_NULL_POINTER: return "null pointer";
+        case GASMITH_ERROR_INVALID_ARGUMENT: return "invalid argument";
+        case GASMITH_ERROR_DOMAIN: return "domain error";
+        case GASMITH_ERROR_OUT_OF_MEMORY: return "out of memory";
+        case GASMITH_ERROR_INTERNAL: return "internal error";
+    }
+    return "unknown status";
+}
+
+const char* gasmith_last_error(void) {
+    return lastError.c_str();
+}
+
+gasmith_status gasmith_algebra_create(const int p, const int q, const int r, gasmith_algebra** out) {
+    if (!out) return fail(GASMITH_ERROR_NULL_POINTER, "gasmith_algebra_create: out is NULL");
+    *out = nullptr;
+    if (p < 0 || q < 0 || r < 0 || p + q + r > ga::MAX_DIMENSIONS)
+        return fail(GASMITH_ERROR_INVALID_ARGUMENT, "gasmith_algebra_create: need p, q, r >= 0 and p + q + r <= 8");
+    return guarded([&] {
+        *out = new gasmith_algebra{ga::Algebra(ga::Signature(p, q, r, true))};
+        return GASMITH_OK;
+    });
+}
+
+void gasmith_algebra_destroy(gasmith_algebra* alg) {
+    delete alg;
+}
+
+int gasmith_algebra_dimensions(const gasmith_algebra* alg) {
+    return alg ? alg->alg.dimensions : 0;
+}
+
+size_t gasmith_algebra_blade_count(const gasmith_algebra* alg) {
+    return alg ? (static_cast<size_t>(1) << alg->alg.dimensions) : 0;
+}
+
+gasmith_status gasmith_geometric_product(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                                         const gasmith_array* b, const gasmith_array* out) {
+    return binary(alg, count, a, b, out, [](const Multivector& A, const Multivector& B) {
+        return ga::ops::geometricProduct(A, B);
+    });
+}
+
+gasmith_status gasmith_wedge(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                             const gasmith_array* b, const gasmith_array* out) {
+    return binary(alg, count, a, b, out, [](const Multivector& A, const Multivector& B) {
+        return ga::ops::wedge(A, B);
+    });
+}
+
+gasmith_status gasmith_inner(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                             const gasmith_array* b, const gasmith_array* out) {
+    return binary(alg, count, a, b, out, [](const Multivector& A, const Multivector& B) {
+        return ga::ops::inner(A, B);
+    });
+}
+
+gasmith_status gasmith_left_contraction(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                                        const gasmith_array* b, const gasmith_array* out) {
+    return binary(alg, count, a, b, out, [](const Multivector& A, const Multivector& B) {
+        return ga::ops::leftContraction(A, B);
+    });
+}
+
+gasmith_status gasmith_right_contraction(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                                         const gasmith_array* b, const gasmith_array* out) {
+    return binary(alg, count, a, b, out, [](const Multivector& A, const Multivector& B) {
+        return ga::ops::rightContraction(A, B);
+    });
+}
+
+gasmith_status gasmith_sandwich(const gasmith_algebra* alg, const size_t count, const gasmith_array* versors,
+                                const gasmith_array* x, const gasmith_array* out) {
+    if (const gasmith_status s = checkArrays(alg, count, {versors, x}, out); s != GASMITH_OK) return s;
+    if (versors->item_stride != 0 || count == 0) {
+        return binary(alg, count, versors, x, out, [](const Multivector& V, const Multivector& X) {
+            return ga::Versor(V).apply(X);
+        });
+    }
+
+    // One versor for every item: invert it once
+    return guarded([&] {
+        Multivector V(alg->alg);
+        load(*versors, 0, V);
+        const Multivector inv = ga::Versor(V).inverse();
+        ga::parallel::parallelFor(count, GRAIN, [&](const std::size_t begin, const std::size_t end) {
+            Multivector X(alg->alg);
+            for (std::size_t i = begin; i < end; ++i) {
+                load(*x, i, X);
+                store(*out, i, ga::ops::geometricProduct(ga::ops::geometricProduct(V, X), inv));
+            }
+        });
+        return GASMITH_OK;
+    });
+}
+
+gasmith_status gasmith_reverse(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                               const gasmith_array* out) {
+    return unary(alg, count, a, out, [](const Multivector& A) { return ga::ops::reverse(A); });
+}
+
+gasmith_status gasmith_dual(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                            const gasmith_array* out) {
+    return unary(alg, count, a, out, [](const Multivector& A) { return ga::ops::dual(A); });
+}
+
+gasmith_status gasmith_normalize(const gasmith_algebra* alg, const size_t count, const gasmith_array* a,
+                                 const gasmith_array* out) {
+    return unary(alg, count, a, out, [](const Multivector& A) {
+        ga::Rotor R(A);
+        R.normalize();
+        return R.value();
+    });
+}
+
+gasmith_status gasmith_linear_map_apply(const gasmith_algebra* alg, const float* matrix, const size_t count,
+                                        const gasmith_array* a, const gasmith_array* out) {
+    if (const gasmith_status s = checkArrays(alg, count, {a}, out); s != GASMITH_OK) return s;
+    if (!matrix) return fail(GASMITH_ERROR_NULL_POINTER, "gasmith_linear_map_apply: matrix is NULL");
+
+    return guarded([&] {
+        const int dims = alg->alg.dimensions;
+        ga::LinearMap L(alg->alg);
+        for (int r = 0; r < dims; ++r)
+            for (int c = 0; c < dims; ++c)
+                L.set(r, c, matrix[r * dims + c]);
+
+        // The outermorphism is block diagonal by grade: build every compound once
+        std::vector<ga::CompoundMap> grades;
+        for (int k = 0; k <= dims; ++k) {
+            grades.push_back(L.compound(k));
+        }
+
+        ga::parallel::parallelFor(count, GRAIN, [&](const std::size_t begin, const std::size_t end) {
+            Multivector A(alg->alg), B(alg->alg);
+            for (std::size_t i = begin; i < end; ++i) {
+                load(*a, i, A);
+                for (const ga::CompoundMap& cm : grades) {
+                    const std::size_t C = cm.size();
+                    for (std::size_t r = 0; r < C; ++r) {
+                        const float* row = &cm.m[r * C];
+                        float sum = 0.0f;
+                        for (std::size_t c = 0; c < C; ++c) {
+                            sum += row[c] * A.storage[cm.masks[c]];
+                        }
+                        B.storage[cm.masks[r]] = sum;
+                    }
+                }
+                store(*out, i, B);
+            }
+        });
+        return GASMITH_OK;
+    });
+}
+
+} // extern "C"
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/metrics.h"
+#include "ga/multivector.h"
+#include "ga/tables.h"
+#include "ga/ops/kernels.h"
+
+// Per-algebra selection of the geometric product kernel.
+//
+// Which of the kernels in ops/kernels.h is fastest depends on the metric, the
+// dimension and the machine (cache sizes, branch predictor, popcount cost).
+// ga::autotune keeps one choice per metric and geometricProductFiltered (and
+// therefore geometricProduct, wedge, inner, ...) calls through it at runtime.
+// Every kernel produces bitwise identical results, so the choice only affects
+// speed.
+//
+// A choice comes from, in order: an explicit select(), a previous tune() in
+// this process, the on-disk cache, or a tuning run on first use. The cache is
+// a small text file keyed by CPU model and metric; writing it is best effort
+// and never throws. The behaviour on first use is set by GASMITH_AUTOTUNE:
+//
+//   off     never read or write the cache; use the default kernel
+//   cache   use cached choices, otherwise the default kernel (default)
+//   on      use cached choices, otherwise tune and record the result
+//   force   tune every metric on first use and overwrite the cache
+//
+// The cache file is $GASMITH_AUTOTUNE_CACHE if set, otherwise autotune.tsv in
+// $GASMITH_CACHE_DIR, $XDG_CACHE_HOME/gasmith or ~/.cache/gasmith.
+
+namespace ga::autotune {
+
+    using ga::Algebra;
+    using ga::Multivector;
+    using ga::ops::ProductKernel;
+
+    enum class Kernel : std::uint8_t { Dense, Table, BitParallel, Sparse };
+    inline constexpr int KERNEL_COUNT = 4;
+
+    enum class Mode : std::uint8_t { Off, Cache, On, Force };
+
+    // ga::metrics keeps one product counter and timing histogram per kernel, in this order
+    static_assert(static_cast<int>(ga::metrics::Counter::ProductsSparse) -
+                      static_cast<int>(ga::metrics::Counter::ProductsDense) + 1 == KERNEL_COUNT);
+
+    inline const char* kernelName(const Kernel k) {
+        switch (k) {
+            case Kernel::Dense: return "dense";
+            case Kernel::Table: return "table";
+            case Kernel::BitParallel: return "bitparallel";
+            case Kernel::Sparse: return "sparse";
+        }
+        return "unknown";
+    }
+
+    inline bool parseKernel(const std::string_view name, Kernel& out) {
+        for (int k = 0; k < KERNEL_COUNT; ++k) {
+            if (name == kernelName(static_cast<Kernel>(k))) {
+                out = static_cast<Kernel>(k);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline ProductKernel kernelFunction(const Kernel k) {
+        switch (k) {
+            case Kernel::Dense: return &ga::ops::productDense;
+            case Kernel::Table: return &ga::ops::productTable;
+            case Kernel::BitParallel: return &ga::ops::productBitParallel;
+            case Kernel::Sparse: return &ga::ops::productSparse;
+        }
+        return &ga::ops::productDense;
+    }
+
+    /// Inverse of kernelFunction (Dense for an unknown function).
+    inline Kernel kernelOf(const ProductKernel fn) {
+        for (int k = 0; k < KERNEL_COUNT; ++k) {
+            if (kernelFunction(static_cast<Kernel>(k)) == fn) return static_cast<Kernel>(k);
+        }
+        return Kernel::Dense;
+    }
+
+    /// Kernel used when nothing has been tuned or cached for a metric.
+    inline Kernel defaultKernel(const Algebra&) {
+        return Kernel::Table;
+    }
+
+    /// Metric key used in the cache file, e.g. "4:+++0".
+    inline std::string metricKey(const Signature& sig) {
+        const int dims = sig.dimensionsUsed();
+        std::string key = std::to_string(dims) + ":";
+        for (int i = 0; i < dims; ++i) {
+            const int g = sig.getSign(i);
+            key += g > 0 ? '+' : (g < 0 ? '-' : '0');
+        }
+        return key;
+    }
+
+    /// CPU model string the cache is keyed by ("unknown" when unavailable).
+    inline const std::string& cpuModel() {
+        static const std::string model = [] {
+            std::string name;
+            std::ifstream in("/proc/cpuinfo");
+            for (std::string line; std::getline(in, line);) {
+                if (line.rfind("model name", 0) == 0 || line.rfind("Processor", 0) == 0) {
+                    const auto colon = line.find(':');
+                    if (colon != std::string::npos) {
+                        name = line.substr(line.find_first_not_of(" \t", colon + 1));
+                        break;
+                    }
+                }
+            }
+            for (char& c : name) {
+                if (c == '\t' || c == '\n' || c == '\r') c = ' ';
+            }
+            return name.empty() ? std::string("unknown") : name;
+        }();
+        return model;
+    }
+
+    struct TuneResult {
+        Kernel best = Kernel::Table;
+        double nanos[KERNEL_COUNT]{};  ///< best time per kernel over the tuning workload
+    };
+
+    namespace detail {
+
+        inline Mode modeFromEnvironment() {
+            const char* env = std::getenv("GASMITH_AUTOTUNE");
+            if (!env) return Mode::Cache;
+            const std::string_view v(env);
+            if (v == "off" || v == "0") return Mode::Off;
+            if (v == "on" || v == "1") return Mode::On;
+            if (v == "force") return Mode::Force;
+            return Mode::Cache;
+        }
+
+        inline std::string pathFromEnvironment() {
+            if (const char* file = std::getenv("GASMITH_AUTOTUNE_CACHE")) return file;
+            if (const char* dir = std::getenv("GASMITH_CACHE_DIR")) return std::string(dir) + "/autotune.tsv";
+            if (const char* xdg = std::getenv("XDG_CACHE_HOME")) return std::string(xdg) + "/gasmith/autotune.tsv";
+            if (const char* home = std::getenv("HOME")) return std::string(home) + "/.cache/gasmith/autotune.tsv";
+            return {};
+        }
+
+        struct State {
+            std::mutex mutex;
+            Mode mode = modeFromEnvironment();
+            std::string path = pathFromEnvironment();
+            bool cacheLoaded = false;
+            std::map<std::string, Kernel> cached;        ///< this CPU's entries from the cache file
+            std::map<std::uint32_t, Kernel> selected;    ///< resolved choice per metric (ga::detail::tableKey)
+            std::atomic<std::uint32_t> generation{1};    ///< bumped whenever a choice may change
+
+            static State& instance() {
+                static State state;
+                return state;
+            }
+        };
+
+        // Cache file: one "cpu model<TAB>metric<TAB>kernel" entry per line
+        inline void loadCache(State& s) {
+            if (s.cacheLoaded) return;
+            s.cacheLoaded = true;
+            if (s.path.empty()) return;
+            std::ifstream in(s.path);
+            for (std::string line; std::getline(in, line);) {
+                const auto t1 = line.find('\t');
+                const auto t2 = t1 == std::string::npos ? t1 : line.find('\t', t1 + 1);
+                if (t2 == std::string::npos || line.compare(0, t1, cpuModel()) != 0) continue;
+                Kernel k;
+                if (parseKernel(std::string_view(line).substr(t2 + 1), k)) {
+                    s.cached[line.substr(t1 + 1, t2 - t1 - 1)] = k;
+                }
+            }
+        }
+
+        inline void storeCache(State& s, const std::string& metric, const Kernel k) {
+            s.cached[metric] = k;
+            if (s.path.empty()) return;
+
+            // Keep other CPUs' and metrics' entries; replace this one
+            std::vector<std::string> lines;
+            {
+                std::ifstream in(s.path);
+                const std::string prefix = cpuModel() + "\t" + metric + "\t";
+                for (std::string line; std::getline(in, line);) {
+                    if (!line.empty() && line.rfind(prefix, 0) != 0) lines.push_back(line);
+                }
+            }
+            lines.push_back(cpuModel() + "\t" + metric + "\t" + kernelName(k));
+
+            std::error_code ec;
+            const std::filesystem::path file(s.path);
+            if (file.has_parent_path()) std::filesystem::create_directories(file.parent_path(), ec);
+            const std::filesystem::path tmp = ga::detail::tempPath(s.path);
+            {
+                std::ofstream out(tmp, std::ios::trunc);
+                if (!out) return;
+                for (const auto& line : lines) out << line << '\n';
+                if (!out) {
+                    out.close();
+                    std::filesystem::remove(tmp, ec);
+                    return;
+                }
+            }
+            std::filesystem::rename(tmp, file, ec);
+            if (ec) std::filesystem::remove(tmp, ec);
+        }
+
+        inline Multivector workload(const Algebra& alg, const float seed, const unsigned gradeMask) {
+            Multivector m(alg);
+            const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+            for (std::size_t i = 0; i < N; ++i) {
+                if ((gradeMask >> ga::Blade::getGrade(static_cast<BladeMask>(i))) & 1u) {
+                    m.storage[i] = std::sin(seed + 0.61f * static_cast<float>(i));
+                }
+            }
+            return m;
+        }
+
+        // Best of a few trials, each long enough to rise above timer resolution
+        inline double timeKernel(const ProductKernel fn, const Multivector& A, const Multivector& B) {
+            using Clock = std::chrono::steady_clock;
+            volatile float sink = 0.0f;
+
+            auto t0 = Clock::now();
+            sink = sink + fn(A, B, nullptr).storage[0];
+            const double once = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+            const int reps = std::max(1, static_cast<int>(50000.0 / std::max(once, 1.0)));
+
+            double best = 1e300;
+            for (int trial = 0; trial < 3; ++trial) {
+                t0 = Clock::now();
+                for (int r = 0; r < reps; ++r) sink = sink + fn(A, B, nullptr).storage[0];
+                best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / reps);
+            }
+            return best;
+        }
+
+    } // namespace detail
+
+    /// Current first-use policy (initially from GASMITH_AUTOTUNE).
+    inline Mode mode() {
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        return s.mode;
+    }
+
+    /// Change the first-use policy. Choices already made are kept.
+    inline void setMode(const Mode m) {
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.mode = m;
+    }
+
+    /// Cache file in use (empty if there is nowhere to persist).
+    inline std::string cachePath() {
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        return s.path;
+    }
+
+    /// Use a different cache file; its entries are read on the next lookup.
+    inline void setCachePath(std::string path) {
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.path = std::move(path);
+        s.cacheLoaded = false;
+        s.cached.clear();
+    }
+
+    /// Drop every choice made in this process so the next use resolves again.
+    inline void reset() {
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.selected.clear();
+        s.generation.fetch_add(1, std::memory_order_release);
+    }
+
+    /// Pin `alg`'s metric to kernel `k` for this process (not persisted).
+    inline void select(const Algebra& alg, const Kernel k) {
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.selected[ga::detail::tableKey(alg.signature)] = k;
+        s.generation.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Time every kernel on `alg` and select the fastest.
+     *
+     * The workload is a dense x dense product plus a vector x even product, so
+     * both the full loops and the zero skipping count. Takes a few
+     * milliseconds per kernel at 8 dimensions. With `persist` the choice is
+     * written to the cache file (unless the mode is Off).
+     */
+    inline TuneResult tune(const Algebra& alg, const bool persist = true) {
+        const Multivector denseA = detail::workload(alg, 0.3f, ~0u);
+        const Multivector denseB = detail::workload(alg, 1.7f, ~0u);
+        const Multivector vec = detail::workload(alg, 0.9f, 0b10u);
+        const Multivector even = detail::workload(alg, 2.3f, 0b101010101u);
+
+        // Build the shared tables before timing the kernels that use them
+        (void)productTables(alg);
+        ga::metrics::add(ga::metrics::Counter::AutotuneRuns);
+
+        TuneResult result;
+        for (int k = 0; k < KERNEL_COUNT; ++k) {
+            const ProductKernel fn = kernelFunction(static_cast<Kernel>(k));
+            result.nanos[k] = detail::timeKernel(fn, denseA, denseB) + detail::timeKernel(fn, vec, even);
+            if (k == 0 || result.nanos[k] < result.nanos[static_cast<int>(result.best)]) {
+                result.best = static_cast<Kernel>(k);
+            }
+        }
+
+        auto& s = detail::State::instance();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.selected[ga::detail::tableKey(alg.signature)] = result.best;
+        s.generation.fetch_add(1, std::memory_order_release);
+        if (persist && s.mode != Mode::Off) {
+            detail::storeCache(s, metricKey(alg.signature), result.best);
+        }
+        return result;
+    }
+
+    /// Kernel currently chosen for `alg`'s metric, resolving it (cache / tuning) on first use.
+    inline Kernel selected(const Algebra& alg) {
+        auto& s = detail::State::instance();
+        const std::uint32_t key = ga::detail::tableKey(alg.signature);
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (const auto it = s.selected.find(key); it != s.selected.end()) return it->second;
+
+            if (s.mode == Mode::Off) {
+                return s.selected[key] = defaultKernel(alg);
+            }
+            if (s.mode != Mode::Force) {
+                detail::loadCache(s);
+                if (const auto it = s.cached.find(metricKey(alg.signature)); it != s.cached.end()) {
+                    return s.selected[key] = it->second;
+                }
+                if (s.mode == Mode::Cache) {
+                    return s.selected[key] = defaultKernel(alg);
+                }
+            }
+        }
+        // Tuning calls the kernels directly, so it can run without the lock
+        return tune(alg).best;
+    }
+
+    /// Product kernel for `alg`; the hot path is a thread-local last-hit check.
+    inline ProductKernel kernelFor(const Algebra& alg) {
+        struct LastHit {
+            std::uint32_t key = ~0u;
+            std::uint32_t generation = 0;
+            ProductKernel fn = nullptr;
+        };
+        thread_local LastHit last;
+
+        const std::uint32_t key = ga::detail::tableKey(alg.signature);
+        const std::uint32_t gen = detail::State::instance().generation.load(std::memory_order_acquire);
+        if (last.fn && last.key == key && last.generation == gen) {
+            return last.fn;
+        }
+        const ProductKernel fn = kernelFunction(selected(alg));
+        last = {key, gen, fn};
+        return fn;
+    }
+
+} // namespace ga::autotune
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/metrics.h"
+#include "ga/multivector.h"
+
+// A batch holds many multivectors of one algebra in structure-of-arrays form.
+// Coefficient `mask` of element `i` lives at data[mask * count + i], so every
+// blade is one contiguous column. Kernels that touch a fixed set of blades
+// (a grade, the even part, ...) stream only those columns, and loops over the
+// elements of a column vectorise naturally.
+
+namespace ga {
+
+    struct MultivectorBatch {
+        const Algebra* alg = nullptr;
+        std::size_t count = 0;
+        std::vector<float> data;  // blade-major, (1 << dims) columns of `count` floats
+
+        MultivectorBatch() = default;
+
+        MultivectorBatch(const Algebra& a, const std::size_t n)
+            : alg(&a), count(n), data((static_cast<std::size_t>(1) << a.dimensions) * n, 0.0f) {
+            ga::metrics::peak(ga::metrics::Gauge::BatchBytesPeak, data.size() * sizeof(float));
+        }
+
+        [[nodiscard]] std::size_t bladeCount() const {
+            return alg ? (static_cast<std::size_t>(1) << alg->dimensions) : 0;
+        }
+
+        // Contiguous column of coefficient `mask` for every element
+        [[nodiscard]] float* column(const BladeMask mask) { return data.data() + static_cast<std::size_t>(mask) * count; }
+        [[nodiscard]] const float* column(const BladeMask mask) const { return data.data() + static_cast<std::size_t>(mask) * count; }
+
+        [[nodiscard]] float& at(const std::size_t i, const BladeMask mask) { return column(mask)[i]; }
+        [[nodiscard]] float at(const std::size_t i, const BladeMask mask) const { return column(mask)[i]; }
+
+        // Gather element i into a Multivector
+        [[nodiscard]] Multivector get(const std::size_t i) const {
+            if (!alg) {
+                throw std::invalid_argument("ga::MultivectorBatch::get: batch has no Algebra");
+            }
+            if (i >= count) {
+                throw std::out_of_range("ga::MultivectorBatch::get: index out of range");
+            }
+            Multivector mv(*alg);
+            const std::size_t N = bladeCount();
+            for (std::size_t m = 0; m < N; ++m) {
+                mv.storage[m] = data[m * count + i];
+            }
+            return mv;
+        }
+
+        // Scatter a Multivector into element i
+        void set(const std::size_t i, const Multivector& mv) {
+            if (!alg || mv.alg != alg) {
+                throw std::invalid_argument("ga::MultivectorBatch::set: Algebra mismatch or null");
+            }
+            if (i >= count) {
+                throw std::out_of_range("ga::MultivectorBatch::set: index out of range");
+            }
+            const std::size_t N = bladeCount();
+            for (std::size_t m = 0; m < N; ++m) {
+                data[m * count + i] = mv.storage[m];
+            }
+        }
+    };
+
+} // namespace ga
@@ -0,0 +1,118 @@
+/*
+ * GASmith C ABI.
+ *
+ * A small, stable C interface for foreign callers (ctypes/cffi, numpy, Rust
+ * FFI, ...). Algebras are opaque handles and every operation works on a whole
+ * batch of multivectors in caller-owned memory, so one call processes a full
+ * foreign array in place with no marshalling.
+ *
+ * Arrays are described like a PEP 3118 / numpy buffer of float32:
+ *
+ *   coefficient `mask` of item `i` lives at
+ *       (char*)data + i * item_stride + mask * blade_stride
+ *
+ * Strides are in bytes and may be any multiple of sizeof(float):
+ *
+ *   - array-of-structs, numpy shape (count, 2^n) C-contiguous:
+ *         item_stride = 4 * 2^n, blade_stride = 4
+ *   - structure-of-arrays (ga::MultivectorBatch), shape (2^n, count):
+ *         item_stride = 4, blade_stride = 4 * count
+ *   - item_stride = 0 broadcasts one multivector to every item (inputs only).
+ *
+ * Outputs may alias an input exactly (same data and strides); any other
+ * overlap is undefined. Errors are reported as gasmith_status codes and never
+ * cross the ABI as C++ exceptions; gasmith_last_error() gives the message of
+ * the most recent failure on the calling thread.
+ */
+
+#ifndef GASMITH_CAPI_H
+#define GASMITH_CAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GASMITH_ABI_VERSION 1
+
+#if defined(_WIN32)
+#  define GASMITH_API
+#else
+#  define GASMITH_API __attribute__((visibility("default")))
+#endif
+
+typedef enum gasmith_status {
+    GASMITH_OK = 0,
+    GASMITH_ERROR_NULL_POINTER = 1,  /* a required handle or pointer was NULL */
+    GASMITH_ERROR_INVALID_ARGUMENT = 2,  /* bad signature, stride or matrix */
+    GASMITH_ERROR_DOMAIN = 3,  /* e.g. normalising or inverting a null multivector */
+    GASMITH_ERROR_OUT_OF_MEMORY = 4,
+    GASMITH_ERROR_INTERNAL = 5
+} gasmith_status;
+
+/* Opaque algebra handle. */
+typedef struct gasmith_algebra gasmith_algebra;
+
+/* Strided view of `count` float32 multivectors (count is passed per call). */
+typedef struct gasmith_array {
+    float* data;
+    ptrdiff_t item_stride;   /* bytes between consecutive multivectors */
+    ptrdiff_t blade_stride;  /* bytes between consecutive coefficients of one multivector */
+} gasmith_array;
+
+GASMITH_API int gasmith_abi_version(void);
+GASMITH_API const char* gasmith_status_string(gasmith_status status);
+GASMITH_API const char* gasmith_last_error(void);
+
+/* Cl(p, q, r) with axes ordered positive, negative, null; p + q + r <= 8. */
+GASMITH_API gasmith_status gasmith_algebra_create(int p, int q, int r, gasmith_algebra** out);
+GASMITH_API void gasmith_algebra_destroy(gasmith_algebra* alg);
+GASMITH_API int gasmith_algebra_dimensions(const gasmith_algebra* alg);
+GASMITH_API size_t gasmith_algebra_blade_count(const gasmith_algebra* alg);
+
+/* Binary products: out[i] = a[i] op b[i]. */
+GASMITH_API gasmith_status gasmith_geometric_product(const gasmith_algebra* alg, size_t count,
+                                                     const gasmith_array* a, const gasmith_array* b,
+                                                     const gasmith_array* out);
+GASMITH_API gasmith_status gasmith_wedge(const gasmith_algebra* alg, size_t count,
+                                         const gasmith_array* a, const gasmith_array* b,
+                                         const gasmith_array* out);
+GASMITH_API gasmith_status gasmith_inner(const gasmith_algebra* alg, size_t count,
+                                         const gasmith_array* a, const gasmith_array* b,
+                                         const gasmith_array* out);
+GASMITH_API gasmith_status gasmith_left_contraction(const gasmith_algebra* alg, size_t count,
+                                                    const gasmith_array* a, const gasmith_array* b,
+                                                    const gasmith_array* out);
+GASMITH_API gasmith_status gasmith_right_contraction(const gasmith_algebra* alg, size_t count,
+                                                     const gasmith_array* a, const gasmith_array* b,
+                                                     const gasmith_array* out);
+
+/* Sandwich product out[i] = V[i] X[i] V[i]^-1 (ga::Versor::apply). */
+GASMITH_API gasmith_status gasmith_sandwich(const gasmith_algebra* alg, size_t count,
+                                            const gasmith_array* versors, const gasmith_array* x,
+                                            const gasmith_array* out);
+
+/* Unary operations: out[i] = op(a[i]). */
+GASMITH_API gasmith_status gasmith_reverse(const gasmith_algebra* alg, size_t count,
+                                           const gasmith_array* a, const gasmith_array* out);
+GASMITH_API gasmith_status gasmith_dual(const gasmith_algebra* alg, size_t count,
+                                        const gasmith_array* a, const gasmith_array* out);
+/* Scale each item to |V ~V| = 1 (ga::Rotor::normalize). */
+GASMITH_API gasmith_status gasmith_normalize(const gasmith_algebra* alg, size_t count,
+                                             const gasmith_array* a, const gasmith_array* out);
+
+/*
+ * Outermorphism of the linear map with row-major n x n matrix `matrix`
+ * (L(e_col) = sum_row matrix[row * n + col] e_row), applied to every grade.
+ */
+GASMITH_API gasmith_status gasmith_linear_map_apply(const gasmith_algebra* alg, const float* matrix,
+                                                    size_t count, const gasmith_array* a,
+                                                    const gasmith_array* out);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* GASMITH_CAPI_H */
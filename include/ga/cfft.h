@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/field.h"
+#include "ga/parallel.h"
+#include "ga/tables.h"
+
+// Clifford Fourier transform of multivector fields.
+//
+// With the pseudoscalar I of the algebra as imaginary unit,
+//
+//   forward:  F^(u) = sum_x exp(-I 2 pi u.x / n) F(x)
+//   inverse:  F(x)  = (1 / |grid|) sum_u exp(+I 2 pi u.x / n) F^(u)
+//
+// where u.x = ux x / nx + uy y / ny + uz z / nz. The kernel multiplies from the
+// left, which matters only when I is not central (even dimension).
+//
+// This needs I^2 = -1 (E2, E3, STA, CGA, ...). Left multiplication by I maps
+// blade e_B to s_B e_{B^c}, where B^c = B ^ I is the complementary blade, so the
+// coefficients split into 2^(n-1) pairs. Each pair is one complex number:
+//
+//   F_B e_B + F_{B^c} e_{B^c} = (F_B + I s_B F_{B^c}) e_B
+//
+// The transform is therefore an ordinary complex FFT of every pair. Column B is
+// the real part and s_B times column B^c is the imaginary part. It runs in place
+// on the field's columns, with no copies and no external FFT library.
+//
+// Each axis is transformed in turn with a radix-2 FFT, so extents must be powers
+// of two (1 is allowed). LANES lines along the axis are gathered into a small
+// scratch tile, transformed together with the butterfly loops running across the
+// lanes (unit stride, vectorised), and scattered back. Tiles are spread across
+// threads with ga::parallel.
+
+namespace ga::cfft {
+
+    using ga::Algebra;
+    using ga::BladeMask;
+    using ga::field::MultivectorField;
+
+    namespace detail {
+
+        // Lines transformed together per tile
+        inline constexpr std::size_t LANES = 16;
+
+        struct Pair {
+            BladeMask re = 0, im = 0;
+            float sign = 1.0f;  ///< s_B in I e_B = s_B e_{B^c}
+        };
+
+        inline bool isPowerOfTwo(const std::size_t n) { return n != 0 && (n & (n - 1)) == 0; }
+
+        inline std::vector<Pair> pairs(const Algebra& alg, const char* fn) {
+            const ProductTables& tables = productTables(alg);
+            const BladeMask I = static_cast<BladeMask>(tables.bladeCount() - 1);
+            if (alg.dimensions == 0 || tables.productSign(I, I) != -1) {
+                throw std::invalid_argument(std::string("ga::cfft::") + fn + ": pseudoscalar must square to -1");
+            }
+            std::vector<Pair> out;
+            for (std::size_t m = 0; m < tables.bladeCount(); ++m) {
+                const BladeMask B = static_cast<BladeMask>(m);
+                const BladeMask C = static_cast<BladeMask>(B ^ I);
+                if (B < C) out.push_back(Pair{B, C, static_cast<float>(tables.productSign(I, B))});
+            }
+            return out;
+        }
+
+        // Twiddles and bit reversal for one transform length
+        struct Plan {
+            std::size_t n = 1;
+            std::vector<float> cosine, sine;      ///< cos, sin of 2 pi k / n for k < n / 2
+            std::vector<std::size_t> reversed;    ///< bit-reversed index
+
+            explicit Plan(const std::size_t len) : n(len), cosine(len / 2), sine(len / 2), reversed(len) {
+                for (std::size_t k = 0; k < n / 2; ++k) {
+                    const double a = 6.283185307179586476925 * static_cast<double>(k) / static_cast<double>(n);
+                    cosine[k] = static_cast<float>(std::cos(a));
+                    sine[k] = static_cast<float>(std::sin(a));
+                }
+                int bits = 0;
+                while ((static_cast<std::size_t>(1) << bits) < n) ++bits;
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::size_t r = 0;
+                    for (int b = 0; b < bits; ++b) r |= ((i >> b) & 1u) << (bits - 1 - b);
+                    reversed[i] = r;
+                }
+            }
+        };
+
+        // In-place FFT of `lanes` interleaved lines: element j of lane l at re/im[j * LANES + l],
+        // already in bit-reversed order. sign = -1 forward, +1 inverse.
+        inline void butterflies(const Plan& plan, float* re, float* im, const std::size_t lanes, const float sign) {
+            const std::size_t n = plan.n;
+            for (std::size_t half = 1; half < n; half <<= 1) {
+                const std::size_t step = n / (2 * half);
+                for (std::size_t start = 0; start < n; start += 2 * half) {
+                    for (std::size_t j = 0; j < half; ++j) {
+                        const float wr = plan.cosine[j * step], wi = sign * plan.sine[j * step];
+                        float* ar = re + (start + j) * LANES;
+                        float* ai = im + (start + j) * LANES;
+                        float* br = re + (start + j + half) * LANES;
+                        float* bi = im + (start + j + half) * LANES;
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            const float tr = wr * br[l] - wi * bi[l];
+                            const float ti = wr * bi[l] + wi * br[l];
+                            br[l] = ar[l] - tr;
+                            bi[l] = ai[l] - ti;
+                            ar[l] += tr;
+                            ai[l] += ti;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Transform every pair along one axis (0 = x, 1 = y, 2 = z)
+        inline void transformAxis(MultivectorField& F, const std::vector<Pair>& pairs, const int axis, const float sign,
+                                  const float scale) {
+            const std::size_t ext[3] = {F.nx, F.ny, F.nz};
+            const std::size_t n = ext[axis];
+            if (n <= 1 && scale == 1.0f) return;
+            const std::size_t stride = axis == 0 ? 1 : axis == 1 ? F.nx : F.nx * F.ny;
+            const std::size_t lines = F.cells() / n;
+            const std::size_t blocks = (lines + LANES - 1) / LANES;
+            const Plan plan(n);
+
+            // Offset of the first element of line q
+            auto base = [&](const std::size_t q) -> std::size_t {
+                if (axis == 0) return q * F.nx;
+                if (axis == 1) return (q / F.nx) * F.nx * F.ny + q % F.nx;
+                return q;
+            };
+
+            ga::parallel::parallelFor(blocks * pairs.size(), 1, [&](const std::size_t t0, const std::size_t t1) {
+                std::vector<float> re(n * LANES), im(n * LANES);
+                std::size_t offsets[LANES];
+                for (std::size_t t = t0; t < t1; ++t) {
+                    const Pair& p = pairs[t / blocks];
+                    const std::size_t q0 = (t % blocks) * LANES;
+                    const std::size_t lanes = std::min(LANES, lines - q0);
+                    float* cr = F.column(p.re);
+                    float* ci = F.column(p.im);
+                    for (std::size_t l = 0; l < lanes; ++l) offsets[l] = base(q0 + l);
+
+                    for (std::size_t j = 0; j < n; ++j) {
+                        const std::size_t at = plan.reversed[j] * LANES;
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            re[at + l] = cr[offsets[l] + j * stride];
+                            im[at + l] = p.sign * ci[offsets[l] + j * stride];
+                        }
+                    }
+                    butterflies(plan, re.data(), im.data(), lanes, sign);
+                    const float si = p.sign * scale;
+                    for (std::size_t j = 0; j < n; ++j) {
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            cr[offsets[l] + j * stride] = scale * re[j * LANES + l];
+                            ci[offsets[l] + j * stride] = si * im[j * LANES + l];
+                        }
+                    }
+                }
+            });
+        }
+
+        inline void transform(MultivectorField& F, const bool inverse, const char* fn) {
+            if (!F.alg) {
+                throw std::invalid_argument(std::string("ga::cfft::") + fn + ": field has no Algebra");
+            }
+            if (!isPowerOfTwo(F.nx) || !isPowerOfTwo(F.ny) || !isPowerOfTwo(F.nz)) {
+                throw std::invalid_argument(std::string("ga::cfft::") + fn + ": extents must be powers of two");
+            }
+            const std::vector<Pair> p = pairs(*F.alg, fn);
+            const std::size_t ext[3] = {F.nx, F.ny, F.nz};
+            for (int axis = 0; axis < 3; ++axis) {
+                const float scale = inverse ? 1.0f / static_cast<float>(ext[axis]) : 1.0f;
+                transformAxis(F, p, axis, inverse ? 1.0f : -1.0f, scale);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Forward Clifford Fourier transform, F <- F^, in place on F's columns.
+     *
+     * Uses the pseudoscalar I as imaginary unit, multiplied from the left:
+     * F^(u) = sum_x exp(-I 2 pi u.x / n) F(x), unnormalised. Requires I^2 = -1
+     * and nx, ny, nz all powers of two (1 allowed); otherwise throws
+     * std::invalid_argument before F is touched. No scratch field is
+     * allocated, so keep a copy if the spatial values are still needed.
+     */
+    inline void forward(MultivectorField& F) { detail::transform(F, false, "forward"); }
+
+    /**
+     * @brief Inverse Clifford Fourier transform, F <- F(x) from its spectrum, in place.
+     *
+     * Applies exp(+I 2 pi u.x / n) and the 1 / |grid| normalisation, so
+     * inverse(forward(F)) == F up to rounding. Same preconditions as forward():
+     * I^2 = -1 and power-of-two extents, otherwise std::invalid_argument with F
+     * unchanged.
+     */
+    inline void inverse(MultivectorField& F) { detail::transform(F, true, "inverse"); }
+
+    /**
+     * @brief Signed frequency of spectral index k on an axis of n cells.
+     *
+     * Maps k in [0, n) to 0, 1, .., n/2 - 1, -n/2, .., -1, the order forward()
+     * leaves the spectrum in along each axis. k is not range-checked.
+     */
+    [[nodiscard]] inline long frequency(const std::size_t k, const std::size_t n) {
+        return k < (n + 1) / 2 ? static_cast<long>(k) : static_cast<long>(k) - static_cast<long>(n);
+    }
+
+} // namespace ga::cfft
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/parallel.h"
+
+// Compressed checkpoint streams for MultivectorBatch frames.
+//
+// A stream is a header followed by frames. Each frame stores one batch and is
+// coded against the previous frame of the same stream:
+//
+//   1. Grade-aware layout. Columns are visited in (grade, mask) order and a
+//      per-frame presence bitmap drops columns that are zero in both this frame
+//      and the previous one, so e.g. rotors only pay for their even grades.
+//   2. Per-blade delta. Lossless mode XORs the float bits with the previous
+//      frame's bits; quantised mode rounds to a grid of step 2*errorBound and
+//      stores the zig-zagged integer difference from the previous grid value.
+//      Slowly changing coefficients give words whose high bytes are zero.
+//   3. Byte planes + zero-run coding. Each chunk's words are split into four
+//      byte planes and every plane is run-length coded for zero bytes.
+//      There is no further entropy stage.
+//
+// Elements are split into fixed-size chunks that are coded independently, so
+// both writing and reading run in parallel across chunks, and the reader
+// decodes straight into the columns of a MultivectorBatch.
+//
+// All integers are little-endian. Layout:
+//   header: "GACK" u16 version u8 dims u8 flags u64 count u32 chunkSize f32 errorBound
+//   frame:  "GAFR" u32 index u8 keyframe u8[32] presence u32 chunks
+//           { u32 bytes, payload }*
+
+namespace ga::checkpoint {
+
+    using ga::Algebra;
+    using ga::MultivectorBatch;
+
+    struct Options {
+        std::size_t chunkSize = 16384;      ///< elements per independently coded chunk
+        float errorBound = 0.0f;            ///< 0 = lossless, otherwise max absolute error per coefficient
+        std::uint32_t keyframeInterval = 0; ///< code every N-th frame against zero (0 = only the first)
+    };
+
+    namespace detail {
+
+        static constexpr std::uint32_t STREAM_MAGIC = 0x4b434147u; // "GACK"
+        static constexpr std::uint32_t FRAME_MAGIC  = 0x52464147u; // "GAFR"
+        static constexpr std::uint16_t VERSION = 1;
+        static constexpr std::uint8_t FLAG_QUANTIZED = 1;
+
+        inline void putU8(std::vector<std::uint8_t>& b, const std::uint8_t v) { b.push_back(v); }
+        inline void putU16(std::vector<std::uint8_t>& b, const std::uint16_t v) {
+            b.push_back(static_cast<std::uint8_t>(v));
+            b.push_back(static_cast<std::uint8_t>(v >> 8));
+        }
+        inline void putU32(std::vector<std::uint8_t>& b, const std::uint32_t v) {
+            for (int i = 0; i < 4; ++i) b.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+        }
+        inline void putU64(std::vector<std::uint8_t>& b, const std::uint64_t v) {
+            for (int i = 0; i < 8; ++i) b.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+        }
+
+        inline void readExact(std::istream& in, void* dst, const std::size_t n) {
+            in.read(static_cast<char*>(dst), static_cast<std::streamsize>(n));
+            if (static_cast<std::size_t>(in.gcount()) != n) {
+                throw std::runtime_error("ga::checkpoint: truncated stream");
+            }
+        }
+        inline std::uint64_t getLE(const std::uint8_t* p, const int bytes) {
+            std::uint64_t v = 0;
+            for (int i = 0; i < bytes; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+            return v;
+        }
+        inline std::uint32_t readU32(std::istream& in) {
+            std::uint8_t b[4];
+            readExact(in, b, 4);
+            return static_cast<std::uint32_t>(getLE(b, 4));
+        }
+
+        inline std::uint32_t zigzag(const std::int32_t v) {
+            return (static_cast<std::uint32_t>(v) << 1) ^ static_cast<std::uint32_t>(v >> 31);
+        }
+        inline std::int32_t unzigzag(const std::uint32_t v) {
+            return static_cast<std::int32_t>(v >> 1) ^ -static_cast<std::int32_t>(v & 1u);
+        }
+
+        // Zero-run coding: control c < 128 -> c+1 literal bytes follow,
+        // c >= 128 -> a run of (c - 126) zero bytes (2..129).
+        inline void encodeZeroRuns(const std::uint8_t* src, const std::size_t n, std::vector<std::uint8_t>& out) {
+            std::size_t i = 0;
+            while (i < n) {
+                std::size_t zeros = 0;
+                while (i + zeros < n && src[i + zeros] == 0 && zeros < 129) ++zeros;
+                if (zeros >= 2) {
+                    out.push_back(static_cast<std::uint8_t>(zeros + 126));
+                    i += zeros;
+                    continue;
+                }
+                std::size_t lit = 0;
+                while (i + lit < n && lit < 128) {
+                    if (src[i + lit] == 0 && i + lit + 1 < n && src[i + lit + 1] == 0) break;
+                    ++lit;
+                }
+                out.push_back(static_cast<std::uint8_t>(lit - 1));
+                out.insert(out.end(), src + i, src + i + lit);
+                i += lit;
+            }
+        }
+
+        inline const std::uint8_t* decodeZeroRuns(const std::uint8_t* p, const std::uint8_t* end,
+                                                  std::uint8_t* dst, const std::size_t n) {
+            std::size_t i = 0;
+            while (i < n) {
+                if (p >= end) throw std::runtime_error("ga::checkpoint: corrupt chunk (run overflow)");
+                const std::uint8_t c = *p++;
+                if (c >= 128) {
+                    const std::size_t run = static_cast<std::size_t>(c) - 126;
+                    if (i + run > n) throw std::runtime_error("ga::checkpoint: corrupt chunk (run length)");
+                    std::memset(dst + i, 0, run);
+                    i += run;
+                } else {
+                    const std::size_t lit = static_cast<std::size_t>(c) + 1;
+                    if (i + lit > n || p + lit > end) throw std::runtime_error("ga::checkpoint: corrupt chunk (literal)");
+                    std::memcpy(dst + i, p, lit);
+                    p += lit;
+                    i += lit;
+                }
+            }
+            return p;
+        }
+
+        // Columns in (grade, mask) order
+        inline std::vector<BladeMask> gradeOrder(const int dims) {
+            std::vector<BladeMask> order;
+            const std::size_t N = (1u << dims);
+            for (int g = 0; g <= dims; ++g)
+                for (std::size_t m = 0; m < N; ++m)
+                    if (Blade::getGrade(static_cast<BladeMask>(m)) == g)
+                        order.push_back(static_cast<BladeMask>(m));
+            return order;
+        }
+
+        // State shared by writer and reader: previous frame per coefficient
+        // (float bits in lossless mode, grid index in quantised mode).
+        struct Coder {
+            int dims = 0;
+            std::size_t count = 0;
+            std::size_t chunkSize = 0;
+            float errorBound = 0.0f;
+            std::vector<BladeMask> order;
+            std::vector<std::uint32_t> prev;  // blade-major like MultivectorBatch
+            std::uint32_t frames = 0;
+
+            [[nodiscard]] bool quantized() const { return errorBound > 0.0f; }
+            [[nodiscard]] float step() const { return 2.0f * errorBound; }
+            [[nodiscard]] std::size_t chunkCount() const { return (count + chunkSize - 1) / chunkSize; }
+
+            [[nodiscard]] bool representable(const float v) const {
+                return !quantized() || std::fabs(std::nearbyint(static_cast<double>(v) / step())) < 2147483647.0;
+            }
+
+            std::uint32_t word(const float v, const std::uint32_t previous) const {
+                if (!quantized()) {
+                    return std::bit_cast<std::uint32_t>(v) ^ previous;
+                }
+                if (!representable(v)) {
+                    throw std::range_error("ga::checkpoint: value too large for the quantisation grid");
+                }
+                const double q = std::nearbyint(static_cast<double>(v) / step());
+                // Differences wrap modulo 2^32 and decode back exactly
+                return zigzag(static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::int32_t>(q)) - previous));
+            }
+
+            std::uint32_t state(const float v, const std::uint32_t w, const std::uint32_t previous) const {
+                if (!quantized()) return std::bit_cast<std::uint32_t>(v);
+                return previous + static_cast<std::uint32_t>(unzigzag(w));
+            }
+
+            float value(const std::uint32_t w, const std::uint32_t previous, std::uint32_t& next) const {
+                if (!quantized()) {
+                    next = w ^ previous;
+                    return std::bit_cast<float>(next);
+                }
+                next = previous + static_cast<std::uint32_t>(unzigzag(w));
+                return static_cast<float>(static_cast<double>(static_cast<std::int32_t>(next)) * step());
+            }
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief Writes a sequence of batches as a compressed checkpoint stream.
+     *
+     * All frames must use the algebra and count given at construction.
+     */
+    class Writer {
+    public:
+        Writer(std::ostream& out, const Algebra& alg, const std::size_t count, const Options& options = {})
+            : out_(out), alg_(&alg) {
+            if (options.chunkSize == 0) {
+                throw std::invalid_argument("ga::checkpoint::Writer: chunkSize must be positive");
+            }
+            if (!(options.errorBound >= 0.0f)) {
+                throw std::invalid_argument("ga::checkpoint::Writer: errorBound must be >= 0");
+            }
+            coder_.dims = alg.dimensions;
+            coder_.count = count;
+            coder_.chunkSize = options.chunkSize;
+            coder_.errorBound = options.errorBound;
+            coder_.order = detail::gradeOrder(alg.dimensions);
+            coder_.prev.assign((static_cast<std::size_t>(1) << alg.dimensions) * count, 0u);
+            keyframeInterval_ = options.keyframeInterval;
+
+            std::vector<std::uint8_t> h;
+            detail::putU32(h, detail::STREAM_MAGIC);
+            detail::putU16(h, detail::VERSION);
+            detail::putU8(h, static_cast<std::uint8_t>(alg.dimensions));
+            detail::putU8(h, coder_.quantized() ? detail::FLAG_QUANTIZED : 0);
+            detail::putU64(h, count);
+            detail::putU32(h, static_cast<std::uint32_t>(options.chunkSize));
+            detail::putU32(h, std::bit_cast<std::uint32_t>(options.errorBound));
+            emit(h);
+        }
+
+        /**
+         * @brief Append one frame.
+         *
+         * Throws std::range_error, before any state changes, if a coefficient
+         * does not fit the quantisation grid; the stream stays usable.
+         */
+        void write(const MultivectorBatch& batch) {
+            if (batch.alg != alg_ || batch.count != coder_.count) {
+                throw std::invalid_argument("ga::checkpoint::Writer::write: batch does not match the stream");
+            }
+            if (coder_.quantized()) {
+                // Chunks below overwrite coder_.prev as they go, so nothing may fail in there
+                std::atomic<bool> ok{true};
+                ga::parallel::parallelFor(batch.data.size(), 1 << 16, [&](const std::size_t i0, const std::size_t i1) {
+                    for (std::size_t i = i0; i < i1; ++i) {
+                        if (!coder_.representable(batch.data[i])) {
+                            ok.store(false, std::memory_order_relaxed);
+                            return;
+                        }
+                    }
+                });
+                if (!ok.load()) {
+                    throw std::range_error("ga::checkpoint::Writer::write: value too large for the quantisation grid");
+                }
+            }
+
+            const bool keyframe = coder_.frames == 0 ||
+                                  (keyframeInterval_ != 0 && coder_.frames % keyframeInterval_ == 0);
+            if (keyframe) {
+                std::fill(coder_.prev.begin(), coder_.prev.end(), 0u);
+            }
+
+            // Presence: a column is skipped when it is zero now and its previous state is zero
+            const std::size_t n = coder_.count;
+            std::uint8_t presence[32]{};
+            std::vector<BladeMask> present;
+            for (BladeMask m : coder_.order) {
+                const float* col = batch.column(m);
+                const std::uint32_t* prev = &coder_.prev[static_cast<std::size_t>(m) * n];
+                bool used = false;
+                for (std::size_t i = 0; i < n && !used; ++i) {
+                    used = (std::bit_cast<std::uint32_t>(col[i]) != 0u) || prev[i] != 0u;
+                }
+                if (used) {
+                    presence[m >> 3] |= static_cast<std::uint8_t>(1u << (m & 7));
+                    present.push_back(m);
+                }
+            }
+
+            const std::size_t chunks = coder_.chunkCount();
+            std::vector<std::vector<std::uint8_t>> payloads(chunks);
+
+            ga::parallel::parallelFor(chunks, 1, [&](const std::size_t c0, const std::size_t c1) {
+                std::vector<std::uint32_t> words;
+                std::vector<std::uint8_t> plane;
+                for (std::size_t c = c0; c < c1; ++c) {
+                    const std::size_t begin = c * coder_.chunkSize;
+                    const std::size_t len = std::min(coder_.chunkSize, n - begin);
+                    words.resize(len * present.size());
+
+                    std::size_t w = 0;
+                    for (BladeMask m : present) {
+                        const float* col = batch.column(m) + begin;
+                        std::uint32_t* prev = &coder_.prev[static_cast<std::size_t>(m) * n + begin];
+                        for (std::size_t i = 0; i < len; ++i, ++w) {
+                            words[w] = coder_.word(col[i], prev[i]);
+                            prev[i] = coder_.state(col[i], words[w], prev[i]);
+                        }
+                    }
+
+                    std::vector<std::uint8_t>& out = payloads[c];
+                    plane.resize(words.size());
+                    for (int b = 0; b < 4; ++b) {
+                        for (std::size_t i = 0; i < words.size(); ++i) {
+                            plane[i] = static_cast<std::uint8_t>(words[i] >> (8 * b));
+                        }
+                        detail::encodeZeroRuns(plane.data(), plane.size(), out);
+                    }
+                }
+            });
+
+            std::vector<std::uint8_t> h;
+            detail::putU32(h, detail::FRAME_MAGIC);
+            detail::putU32(h, coder_.frames);
+            detail::putU8(h, keyframe ? 1 : 0);
+            h.insert(h.end(), presence, presence + 32);
+            detail::putU32(h, static_cast<std::uint32_t>(chunks));
+            emit(h);
+            for (const auto& p : payloads) {
+                std::vector<std::uint8_t> size;
+                detail::putU32(size, static_cast<std::uint32_t>(p.size()));
+                emit(size);
+                emit(p);
+            }
+            ++coder_.frames;
+        }
+
+        [[nodiscard]] std::uint64_t bytesWritten() const { return bytes_; }
+        [[nodiscard]] std::uint32_t frames() const { return coder_.frames; }
+
+    private:
+        void emit(const std::vector<std::uint8_t>& b) {
+            out_.write(reinterpret_cast<const char*>(b.data()), static_cast<std::streamsize>(b.size()));
+            if (!out_) {
+                throw std::runtime_error("ga::checkpoint::Writer: write failed");
+            }
+            bytes_ += b.size();
+        }
+
+        std::ostream& out_;
+        const Algebra* alg_;
+        detail::Coder coder_;
+        std::uint32_t keyframeInterval_ = 0;
+        std::uint64_t bytes_ = 0;
+    };
+
+    /**
+     * @brief Reads frames of a checkpoint stream back into batches.
+     */
+    class Reader {
+    public:
+        Reader(std::istream& in, const Algebra& alg) : in_(in), alg_(&alg) {
+            std::uint8_t h[24];
+            detail::readExact(in_, h, sizeof(h));
+            if (detail::getLE(h, 4) != detail::STREAM_MAGIC) {
+                throw std::runtime_error("ga::checkpoint::Reader: not a checkpoint stream");
+            }
+            if (detail::getLE(h + 4, 2) != detail::VERSION) {
+                throw std::runtime_error("ga::checkpoint::Reader: unsupported stream version");
+            }
+            if (h[6] != alg.dimensions) {
+                throw std::invalid_argument("ga::checkpoint::Reader: stream dimensions do not match the Algebra");
+            }
+            coder_.dims = h[6];
+            coder_.count = static_cast<std::size_t>(detail::getLE(h + 8, 8));
+            coder_.chunkSize = static_cast<std::size_t>(detail::getLE(h + 16, 4));
+            coder_.errorBound = std::bit_cast<float>(static_cast<std::uint32_t>(detail::getLE(h + 20, 4)));
+            if (coder_.chunkSize == 0 || ((h[7] & detail::FLAG_QUANTIZED) != 0) != coder_.quantized()) {
+                throw std::runtime_error("ga::checkpoint::Reader: corrupt header");
+            }
+            coder_.order = detail::gradeOrder(coder_.dims);
+            coder_.prev.assign((static_cast<std::size_t>(1) << coder_.dims) * coder_.count, 0u);
+        }
+
+        [[nodiscard]] std::size_t count() const { return coder_.count; }
+        [[nodiscard]] float errorBound() const { return coder_.errorBound; }
+
+        /**
+         * @brief Decode the next frame into `out` (resized if needed).
+         * @return false at a clean end of stream.
+         */
+        bool read(MultivectorBatch& out) {
+            std::uint8_t magic[4];
+            in_.read(reinterpret_cast<char*>(magic), 4);
+            if (in_.gcount() == 0 && in_.eof()) {
+                return false;
+            }
+            if (in_.gcount() != 4 || detail::getLE(magic, 4) != detail::FRAME_MAGIC) {
+                throw std::runtime_error("ga::checkpoint::Reader: corrupt frame header");
+            }
+            const std::uint32_t index = detail::readU32(in_);
+            if (index != coder_.frames) {
+                throw std::runtime_error("ga::checkpoint::Reader: frames out of order");
+            }
+            std::uint8_t keyframe = 0;
+            detail::readExact(in_, &keyframe, 1);
+            std::uint8_t presence[32];
+            detail::readExact(in_, presence, 32);
+            const std::uint32_t chunks = detail::readU32(in_);
+            if (chunks != coder_.chunkCount()) {
+                throw std::runtime_error("ga::checkpoint::Reader: corrupt frame (chunk count)");
+            }
+
+            std::vector<std::vector<std::uint8_t>> payloads(chunks);
+            for (auto& p : payloads) {
+                p.resize(detail::readU32(in_));
+                detail::readExact(in_, p.data(), p.size());
+            }
+
+            if (keyframe) {
+                std::fill(coder_.prev.begin(), coder_.prev.end(), 0u);
+            }
+            if (out.alg != alg_ || out.count != coder_.count) {
+                out = MultivectorBatch(*alg_, coder_.count);
+            }
+
+            const std::size_t n = coder_.count;
+            std::vector<BladeMask> present;
+            for (BladeMask m : coder_.order) {
+                if (presence[m >> 3] & (1u << (m & 7))) {
+                    present.push_back(m);
+                } else {
+                    // Absent columns are zero in this frame and their state stays zero
+                    std::fill(out.column(m), out.column(m) + n, 0.0f);
+                }
+            }
+
+            ga::parallel::parallelFor(chunks, 1, [&](const std::size_t c0, const std::size_t c1) {
+                std::vector<std::uint8_t> planes;
+                for (std::size_t c = c0; c < c1; ++c) {
+                    const std::size_t begin = c * coder_.chunkSize;
+                    const std::size_t len = std::min(coder_.chunkSize, n - begin);
+                    const std::size_t nw = len * present.size();
+
+                    planes.resize(4 * nw);
+                    const std::uint8_t* p = payloads[c].data();
+                    const std::uint8_t* end = p + payloads[c].size();
+                    for (int b = 0; b < 4; ++b) {
+                        p = detail::decodeZeroRuns(p, end, planes.data() + b * nw, nw);
+                    }
+
+                    std::size_t w = 0;
+                    for (BladeMask m : present) {
+                        float* col = out.column(m) + begin;
+                        std::uint32_t* prev = &coder_.prev[static_cast<std::size_t>(m) * n + begin];
+                        for (std::size_t i = 0; i < len; ++i, ++w) {
+                            const std::uint32_t word =
+                                static_cast<std::uint32_t>(planes[w]) |
+                                static_cast<std::uint32_t>(planes[nw + w]) << 8 |
+                                static_cast<std::uint32_t>(planes[2 * nw + w]) << 16 |
+                                static_cast<std::uint32_t>(planes[3 * nw + w]) << 24;
+                            col[i] = coder_.value(word, prev[i], prev[i]);
+                        }
+                    }
+                }
+            });
+
+            ++coder_.frames;
+            return true;
+        }
+
+    private:
+        std::istream& in_;
+        const Algebra* alg_;
+        detail::Coder coder_;
+    };
+
+} // namespace ga::checkpoint
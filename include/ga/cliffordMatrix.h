@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/tables.h"
+
+// Matrices whose entries are multivectors.
+//
+// CliffordMatrix stores one real rows x cols matrix per blade (row-major):
+//
+//   data[mask * rows * cols + r * cols + c]
+//
+// so an entry costs 4 * 2^n bytes instead of the 1 KB of a Multivector.
+//
+// The product C = A B, with C_ij = sum_k A_ik B_kj, splits by the Cayley table:
+// for every output blade r and left blade a (b = a ^ r),
+//
+//   C_r += sign(a, b) A_a B_b
+//
+// which is one real GEMM per non-zero (a, b) pair. The ProductTables term lists
+// give exactly those pairs. Blades that are zero throughout A or B (e.g. the odd
+// part of a matrix of rotors) are skipped.
+//
+// The GEMM is tiled: an MC x NC tile of every output blade is kept in cache
+// while KC-deep slices of A and B are swept, and the micro-kernel updates
+// four output rows per pass over a row of B. Its inner loop is unit-stride
+// and vectorises. Output tiles are spread across threads with ga::parallel.
+
+namespace ga {
+
+    struct CliffordMatrix {
+        const Algebra* alg = nullptr;
+        std::size_t rows = 0, cols = 0;
+        std::vector<float> data;  // blade-major, (1 << dims) real matrices of rows * cols floats
+
+        CliffordMatrix() = default;
+
+        CliffordMatrix(const Algebra& a, const std::size_t r, const std::size_t c)
+            : alg(&a), rows(r), cols(c), data((static_cast<std::size_t>(1) << a.dimensions) * r * c, 0.0f) {}
+
+        [[nodiscard]] std::size_t entries() const { return rows * cols; }
+
+        [[nodiscard]] std::size_t bladeCount() const {
+            return alg ? (static_cast<std::size_t>(1) << alg->dimensions) : 0;
+        }
+
+        // Real row-major matrix of coefficient `mask`
+        [[nodiscard]] float* blade(const BladeMask mask) { return data.data() + static_cast<std::size_t>(mask) * entries(); }
+        [[nodiscard]] const float* blade(const BladeMask mask) const { return data.data() + static_cast<std::size_t>(mask) * entries(); }
+
+        [[nodiscard]] float& at(const std::size_t r, const std::size_t c, const BladeMask mask) {
+            return blade(mask)[r * cols + c];
+        }
+        [[nodiscard]] float at(const std::size_t r, const std::size_t c, const BladeMask mask) const {
+            return blade(mask)[r * cols + c];
+        }
+
+        // Gather entry (r, c) into a Multivector
+        [[nodiscard]] Multivector get(const std::size_t r, const std::size_t c) const {
+            if (!alg) {
+                throw std::invalid_argument("ga::CliffordMatrix::get: matrix has no Algebra");
+            }
+            if (r >= rows || c >= cols) {
+                throw std::out_of_range("ga::CliffordMatrix::get: entry out of range");
+            }
+            Multivector mv(*alg);
+            const std::size_t N = bladeCount(), i = r * cols + c, n = entries();
+            for (std::size_t m = 0; m < N; ++m) {
+                mv.storage[m] = data[m * n + i];
+            }
+            return mv;
+        }
+
+        // Scatter a Multivector into entry (r, c)
+        void set(const std::size_t r, const std::size_t c, const Multivector& mv) {
+            if (!alg || mv.alg != alg) {
+                throw std::invalid_argument("ga::CliffordMatrix::set: Algebra mismatch or null");
+            }
+            if (r >= rows || c >= cols) {
+                throw std::out_of_range("ga::CliffordMatrix::set: entry out of range");
+            }
+            const std::size_t N = bladeCount(), i = r * cols + c, n = entries();
+            for (std::size_t m = 0; m < N; ++m) {
+                data[m * n + i] = mv.storage[m];
+            }
+        }
+    };
+
+    namespace detail {
+
+        // Tile sizes: MC x NC output tile per blade, KC-deep slices of A and B
+        inline constexpr std::size_t GEMM_MC = 32;
+        inline constexpr std::size_t GEMM_NC = 64;
+        inline constexpr std::size_t GEMM_KC = 64;
+
+        // c[i][j] += s * sum_k a[i][k] b[k][j] over an mc x kc x nc block; lda, ldb, ldc are row strides
+        inline void gemmBlock(float* c, const std::size_t ldc, const float* a, const std::size_t lda,
+                              const float* b, const std::size_t ldb, const float s,
+                              const std::size_t mc, const std::size_t kc, const std::size_t nc) {
+            std::size_t i = 0;
+            for (; i + 4 <= mc; i += 4) {
+                float* c0 = c + (i + 0) * ldc;
+                float* c1 = c + (i + 1) * ldc;
+                float* c2 = c + (i + 2) * ldc;
+                float* c3 = c + (i + 3) * ldc;
+                const float* a0 = a + (i + 0) * lda;
+                const float* a1 = a + (i + 1) * lda;
+                const float* a2 = a + (i + 2) * lda;
+                const float* a3 = a + (i + 3) * lda;
+                for (std::size_t k = 0; k < kc; ++k) {
+                    const float w0 = s * a0[k], w1 = s * a1[k], w2 = s * a2[k], w3 = s * a3[k];
+                    const float* row = b + k * ldb;
+                    for (std::size_t j = 0; j < nc; ++j) {
+                        const float x = row[j];
+                        c0[j] += w0 * x;
+                        c1[j] += w1 * x;
+                        c2[j] += w2 * x;
+                        c3[j] += w3 * x;
+                    }
+                }
+            }
+            for (; i < mc; ++i) {
+                float* ci = c + i * ldc;
+                const float* ai = a + i * lda;
+                for (std::size_t k = 0; k < kc; ++k) {
+                    const float w = s * ai[k];
+                    const float* row = b + k * ldb;
+                    for (std::size_t j = 0; j < nc; ++j) ci[j] += w * row[j];
+                }
+            }
+        }
+
+        // Blades with at least one non-zero entry
+        inline std::vector<char> nonZeroBlades(const CliffordMatrix& M) {
+            const std::size_t N = M.bladeCount(), n = M.entries();
+            std::vector<char> present(N, 0);
+            for (std::size_t m = 0; m < N; ++m) {
+                const float* p = M.blade(static_cast<BladeMask>(m));
+                present[m] = std::any_of(p, p + n, [](const float x) { return x != 0.0f; }) ? 1 : 0;
+            }
+            return present;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief C = A B (or C += A B with accumulate), entries multiplied with the geometric product.
+     *
+     * C must already have A.rows x B.cols entries of the same algebra and must
+     * not share storage with A or B.
+     */
+    inline void multiply(const CliffordMatrix& A, const CliffordMatrix& B, CliffordMatrix& C,
+                         const bool accumulate = false) {
+        if (!A.alg || B.alg != A.alg || C.alg != A.alg) {
+            throw std::invalid_argument("ga::multiply: CliffordMatrix Algebra mismatch or null");
+        }
+        if (A.cols != B.rows || C.rows != A.rows || C.cols != B.cols) {
+            throw std::invalid_argument("ga::multiply: CliffordMatrix shapes do not match");
+        }
+        if (&C == &A || &C == &B) {
+            throw std::invalid_argument("ga::multiply: output aliases an operand");
+        }
+
+        const ProductTables& t = productTables(*A.alg);
+        const std::size_t N = t.bladeCount();
+        const std::size_t M = A.rows, K = A.cols, Ncols = B.cols;
+        if (!accumulate) std::fill(C.data.begin(), C.data.end(), 0.0f);
+        if (M == 0 || K == 0 || Ncols == 0) return;
+
+        // Non-zero (a, b) pairs per output blade
+        struct Term { BladeMask a, b; float sign; };
+        const std::vector<char> inA = detail::nonZeroBlades(A), inB = detail::nonZeroBlades(B);
+        std::vector<std::vector<Term>> terms(N);
+        for (std::size_t r = 0; r < N; ++r) {
+            for (std::uint32_t k = t.offsets[r]; k < t.offsets[r + 1]; ++k) {
+                const BladeMask a = t.left[k];
+                const auto b = static_cast<BladeMask>(a ^ r);
+                if (!inA[a] || !inB[b]) continue;
+                terms[r].push_back(Term{a, b, static_cast<float>(t.productSign(a, b))});
+            }
+        }
+
+        const std::size_t rowTiles = (M + detail::GEMM_MC - 1) / detail::GEMM_MC;
+        const std::size_t colTiles = (Ncols + detail::GEMM_NC - 1) / detail::GEMM_NC;
+        ga::parallel::parallelFor(rowTiles * colTiles, 1, [&](const std::size_t t0, const std::size_t t1) {
+            for (std::size_t tile = t0; tile < t1; ++tile) {
+                const std::size_t i0 = (tile / colTiles) * detail::GEMM_MC;
+                const std::size_t j0 = (tile % colTiles) * detail::GEMM_NC;
+                const std::size_t mc = std::min(detail::GEMM_MC, M - i0);
+                const std::size_t nc = std::min(detail::GEMM_NC, Ncols - j0);
+                for (std::size_t k0 = 0; k0 < K; k0 += detail::GEMM_KC) {
+                    const std::size_t kc = std::min(detail::GEMM_KC, K - k0);
+                    for (std::size_t r = 0; r < N; ++r) {
+                        float* c = C.blade(static_cast<BladeMask>(r)) + i0 * Ncols + j0;
+                        for (const Term& term : terms[r]) {
+                            detail::gemmBlock(c, Ncols,
+                                              A.blade(term.a) + i0 * K + k0, K,
+                                              B.blade(term.b) + k0 * Ncols + j0, Ncols,
+                                              term.sign, mc, kc, nc);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+} // namespace ga
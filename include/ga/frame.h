@@ -0,0 +1,439 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/policies.h"
+
+// Frames and reciprocal frames.
+//
+// A frame is k <= n linearly independent vectors a_1..a_k. Its reciprocal
+// frame a^1..a^k spans the same subspace and satisfies a^i . a_j = delta_ij.
+// With the Gram matrix G_ij = a_i . a_j (metric weighted),
+//
+//   a^i = sum_j (G^{-1})_ij a_j
+//
+// so the reciprocal frame is one k x k inverse on the coefficient matrix
+// instead of the usual wedge / dual / inverse construction on dense
+// multivectors. The frame blade a_1 ^ ... ^ a_k is assembled from the k x k
+// minors of the same matrix.
+//
+// Components: v = sum_i (v . a^i) a_i = sum_i (v . a_i) a^i for v in the span,
+// so contravariant components are dots with the reciprocal frame and
+// covariant components are dots with the frame itself.
+
+namespace ga {
+
+    namespace detail {
+
+        /**
+         * In-place Gauss-Jordan inverse of the k x k row-major matrix `m`
+         * (partial pivoting). Returns the determinant, or 0 when a pivot falls
+         * below `eps` (m is then left unspecified).
+         */
+        inline double invertSmall(double* m, const int k, const double eps) {
+            double inv[MAX_DIMENSIONS * MAX_DIMENSIONS]{};
+            for (int i = 0; i < k; ++i) inv[i * k + i] = 1.0;
+
+            double det = 1.0;
+            for (int c = 0; c < k; ++c) {
+                int p = c;
+                for (int r = c + 1; r < k; ++r) {
+                    if (std::fabs(m[r * k + c]) > std::fabs(m[p * k + c])) p = r;
+                }
+                const double pivot = m[p * k + c];
+                if (std::fabs(pivot) <= eps || pivot == 0.0) return 0.0;
+                if (p != c) {
+                    for (int j = 0; j < k; ++j) {
+                        std::swap(m[p * k + j], m[c * k + j]);
+                        std::swap(inv[p * k + j], inv[c * k + j]);
+                    }
+                    det = -det;
+                }
+                det *= pivot;
+                const double s = 1.0 / pivot;
+                for (int j = 0; j < k; ++j) {
+                    m[c * k + j] *= s;
+                    inv[c * k + j] *= s;
+                }
+                for (int r = 0; r < k; ++r) {
+                    if (r == c) continue;
+                    const double f = m[r * k + c];
+                    if (f == 0.0) continue;
+                    for (int j = 0; j < k; ++j) {
+                        m[r * k + j] -= f * m[c * k + j];
+                        inv[r * k + j] -= f * inv[c * k + j];
+                    }
+                }
+            }
+            for (int i = 0; i < k * k; ++i) m[i] = inv[i];
+            return det;
+        }
+
+        /// Determinant of the k x k row-major matrix `m` (destroyed).
+        inline double determinantSmall(double* m, const int k) {
+            double det = 1.0;
+            for (int c = 0; c < k; ++c) {
+                int p = c;
+                for (int r = c + 1; r < k; ++r) {
+                    if (std::fabs(m[r * k + c]) > std::fabs(m[p * k + c])) p = r;
+                }
+                if (m[p * k + c] == 0.0) return 0.0;
+                if (p != c) {
+                    for (int j = 0; j < k; ++j) std::swap(m[p * k + j], m[c * k + j]);
+                    det = -det;
+                }
+                det *= m[c * k + c];
+                for (int r = c + 1; r < k; ++r) {
+                    const double f = m[r * k + c] / m[c * k + c];
+                    for (int j = c; j < k; ++j) m[r * k + j] -= f * m[c * k + j];
+                }
+            }
+            return det;
+        }
+
+        /**
+         * Reciprocal of the k vectors in `a` (row i = coefficients of a_i over
+         * `dims` axes, metric signs `g`). Writes the reciprocal rows to `r` and
+         * returns det G, or 0 if the frame is degenerate.
+         */
+        inline double reciprocalRows(const double* a, const int k, const int dims, const double* g, double* r) {
+            double G[MAX_DIMENSIONS * MAX_DIMENSIONS];
+            for (int i = 0; i < k; ++i) {
+                for (int j = i; j < k; ++j) {
+                    double s = 0.0;
+                    for (int x = 0; x < dims; ++x) s += g[x] * a[i * dims + x] * a[j * dims + x];
+                    G[i * k + j] = s;
+                    G[j * k + i] = s;
+                }
+            }
+            // Pivot threshold relative to the frame's scale
+            double scale = 0.0;
+            for (int i = 0; i < k * k; ++i) scale = std::max(scale, std::fabs(G[i]));
+            const double det = invertSmall(G, k, ga::Policies::epsilon() * scale);
+            if (det == 0.0) return 0.0;
+            for (int i = 0; i < k; ++i) {
+                for (int x = 0; x < dims; ++x) {
+                    double s = 0.0;
+                    for (int j = 0; j < k; ++j) s += G[i * k + j] * a[j * dims + x];
+                    r[i * dims + x] = s;
+                }
+            }
+            return det;
+        }
+
+        // Checked before anything is sized by k
+        inline int frameSize(const Algebra& alg, const int k, const char* fn) {
+            if (k < 1 || k > alg.dimensions) {
+                throw std::invalid_argument(std::string(fn) + ": a frame needs between 1 and n vectors");
+            }
+            return k;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief k <= n vectors of an Algebra with their reciprocal frame, Gram
+     *        determinant and frame blade cached on construction.
+     *
+     * Only the grade-1 coefficients of the input multivectors are used.
+     * Throws std::invalid_argument for an empty or oversized frame and
+     * std::runtime_error if the vectors are dependent (or span a null subspace).
+     */
+    class Frame {
+    public:
+        Frame() = default;
+
+        Frame(const Algebra& algebra, const std::vector<Multivector>& vectors) : alg_(&algebra) {
+            init(vectors.data(), vectors.size());
+        }
+
+        Frame(const Algebra& algebra, const std::initializer_list<Multivector> vectors) : alg_(&algebra) {
+            init(vectors.begin(), vectors.size());
+        }
+
+        [[nodiscard]] const Algebra* algebra() const noexcept { return alg_; }
+
+        /// Number of vectors k.
+        [[nodiscard]] int size() const noexcept { return k_; }
+
+        /// a_i
+        [[nodiscard]] Multivector vector(const int i) const { return row(a_, i, "vector"); }
+
+        /// a^i, with a^i . a_j = delta_ij
+        [[nodiscard]] Multivector reciprocal(const int i) const { return row(r_, i, "reciprocal"); }
+
+        /// The reciprocal frame as a Frame (its reciprocal is this frame again).
+        [[nodiscard]] Frame reciprocalFrame() const {
+            std::vector<Multivector> rs;
+            for (int i = 0; i < k_; ++i) rs.push_back(reciprocal(i));
+            return Frame(*alg_, rs);
+        }
+
+        /// G_ij = a_i . a_j
+        [[nodiscard]] float gram(const int i, const int j) const {
+            requireIndex(i, "gram");
+            requireIndex(j, "gram");
+            double s = 0.0;
+            for (int x = 0; x < alg_->dimensions; ++x) s += g_[x] * a_[i * MAX_DIMENSIONS + x] * a_[j * MAX_DIMENSIONS + x];
+            return static_cast<float>(s);
+        }
+
+        /// det G; negative for frames spanning an indefinite subspace.
+        [[nodiscard]] float gramDeterminant() const noexcept { return static_cast<float>(gramDet_); }
+
+        /// Metric volume of the parallelotope: sqrt(|det G|).
+        [[nodiscard]] float volume() const noexcept { return static_cast<float>(std::sqrt(std::fabs(gramDet_))); }
+
+        /// Frame blade a_1 ^ ... ^ a_k (the pseudoscalar of the subspace, with orientation).
+        [[nodiscard]] Multivector pseudoscalar() const {
+            Multivector I(*alg_);
+            for (std::size_t m = 0; m < blade_.size(); ++m) I.storage[m] = blade_[m];
+            return I;
+        }
+
+        /// Contravariant components v^i = v . a^i, so v = sum_i v^i a_i for v in the span.
+        [[nodiscard]] std::vector<float> contravariant(const Multivector& v) const { return dots(v, r_); }
+
+        /// Covariant components v_i = v . a_i, so v = sum_i v_i a^i for v in the span.
+        [[nodiscard]] std::vector<float> covariant(const Multivector& v) const { return dots(v, a_); }
+
+        /// sum_i c[i] a_i
+        [[nodiscard]] Multivector fromContravariant(const std::vector<float>& c) const { return combine(c, a_); }
+
+        /// sum_i c[i] a^i
+        [[nodiscard]] Multivector fromCovariant(const std::vector<float>& c) const { return combine(c, r_); }
+
+    private:
+        using Rows = std::array<double, MAX_DIMENSIONS * MAX_DIMENSIONS>;  // row i at i * MAX_DIMENSIONS
+
+        const Algebra* alg_ = nullptr;
+        int k_ = 0;
+        Rows a_{};
+        Rows r_{};
+        double g_[MAX_DIMENSIONS]{};
+        double gramDet_ = 0.0;
+        std::vector<float> blade_;  ///< coefficients of a_1 ^ ... ^ a_k
+
+        void init(const Multivector* vs, const std::size_t count) {
+            const int dims = alg_->dimensions;
+            if (count == 0 || count > static_cast<std::size_t>(dims)) {
+                throw std::invalid_argument("ga::Frame: a frame needs between 1 and n vectors");
+            }
+            k_ = static_cast<int>(count);
+            for (int x = 0; x < dims; ++x) g_[x] = alg_->signature.getSign(x);
+
+            double a[MAX_DIMENSIONS * MAX_DIMENSIONS]{}, r[MAX_DIMENSIONS * MAX_DIMENSIONS]{};
+            for (int i = 0; i < k_; ++i) {
+                if (vs[i].alg != alg_) {
+                    throw std::invalid_argument("ga::Frame: vectors must belong to the frame's Algebra");
+                }
+                for (int x = 0; x < dims; ++x) {
+                    a[i * dims + x] = vs[i].storage[Blade::getBasis(x)];
+                    a_[i * MAX_DIMENSIONS + x] = a[i * dims + x];
+                }
+            }
+
+            gramDet_ = detail::reciprocalRows(a, k_, dims, g_, r);
+            if (gramDet_ == 0.0) {
+                throw std::runtime_error("ga::Frame: vectors are dependent or span a null subspace");
+            }
+            for (int i = 0; i < k_; ++i) {
+                for (int x = 0; x < dims; ++x) r_[i * MAX_DIMENSIONS + x] = r[i * dims + x];
+            }
+
+            // a_1 ^ ... ^ a_k = sum over grade-k blades e_S of det(A restricted to the columns S) e_S
+            const std::size_t N = static_cast<std::size_t>(1) << dims;
+            blade_.assign(N, 0.0f);
+            for (std::size_t mask = 0; mask < N; ++mask) {
+                const auto m = static_cast<BladeMask>(mask);
+                if (Blade::getGrade(m) != k_) continue;
+                int cols[MAX_DIMENSIONS], c = 0;
+                for (int x = 0; x < dims; ++x) {
+                    if (mask & (1u << x)) cols[c++] = x;
+                }
+                double minor[MAX_DIMENSIONS * MAX_DIMENSIONS];
+                for (int i = 0; i < k_; ++i) {
+                    for (int j = 0; j < k_; ++j) minor[i * k_ + j] = a[i * dims + cols[j]];
+                }
+                blade_[m] = static_cast<float>(detail::determinantSmall(minor, k_));
+            }
+        }
+
+        void requireIndex(const int i, const char* fn) const {
+            if (i < 0 || i >= k_) {
+                throw std::out_of_range(std::string("ga::Frame::") + fn + ": index out of range");
+            }
+        }
+
+        [[nodiscard]] Multivector row(const Rows& rows, const int i, const char* fn) const {
+            requireIndex(i, fn);
+            Multivector v(*alg_);
+            for (int x = 0; x < alg_->dimensions; ++x) {
+                v.storage[Blade::getBasis(x)] = static_cast<float>(rows[i * MAX_DIMENSIONS + x]);
+            }
+            return v;
+        }
+
+        [[nodiscard]] std::vector<float> dots(const Multivector& v, const Rows& rows) const {
+            if (v.alg != alg_) {
+                throw std::invalid_argument("ga::Frame: vector must belong to the frame's Algebra");
+            }
+            std::vector<float> out(k_);
+            for (int i = 0; i < k_; ++i) {
+                double s = 0.0;
+                for (int x = 0; x < alg_->dimensions; ++x) {
+                    s += g_[x] * rows[i * MAX_DIMENSIONS + x] * v.storage[Blade::getBasis(x)];
+                }
+                out[i] = static_cast<float>(s);
+            }
+            return out;
+        }
+
+        [[nodiscard]] Multivector combine(const std::vector<float>& c, const Rows& rows) const {
+            if (c.size() != static_cast<std::size_t>(k_)) {
+                throw std::invalid_argument("ga::Frame: expected one component per frame vector");
+            }
+            Multivector v(*alg_);
+            for (int x = 0; x < alg_->dimensions; ++x) {
+                double s = 0.0;
+                for (int i = 0; i < k_; ++i) s += c[i] * rows[i * MAX_DIMENSIONS + x];
+                v.storage[Blade::getBasis(x)] = static_cast<float>(s);
+            }
+            return v;
+        }
+    };
+
+    /**
+     * @brief Many k-vector frames in structure-of-arrays form.
+     *
+     * Coefficient x of vector i of element e lives at
+     * data[(i * n + x) * count + e], so each (vector, axis) pair is one
+     * contiguous column, like MultivectorBatch.
+     */
+    struct FrameBatch {
+        const Algebra* alg = nullptr;
+        int size = 0;            ///< vectors per frame (k)
+        std::size_t count = 0;   ///< number of frames
+        std::vector<float> data;
+
+        FrameBatch() = default;
+
+        FrameBatch(const Algebra& a, const int k, const std::size_t n)
+            : alg(&a), size(detail::frameSize(a, k, "ga::FrameBatch")), count(n),
+              data(static_cast<std::size_t>(size) * a.dimensions * n, 0.0f) {}
+
+        [[nodiscard]] float* column(const int i, const int x) {
+            return data.data() + (static_cast<std::size_t>(i) * alg->dimensions + x) * count;
+        }
+        [[nodiscard]] const float* column(const int i, const int x) const {
+            return data.data() + (static_cast<std::size_t>(i) * alg->dimensions + x) * count;
+        }
+
+        /// Store the grade-1 part of v as vector i of frame e.
+        void setVector(const std::size_t e, const int i, const Multivector& v) {
+            if (!alg || v.alg != alg) {
+                throw std::invalid_argument("ga::FrameBatch::setVector: Algebra mismatch or null");
+            }
+            if (e >= count || i < 0 || i >= size) {
+                throw std::out_of_range("ga::FrameBatch::setVector: index out of range");
+            }
+            for (int x = 0; x < alg->dimensions; ++x) column(i, x)[e] = v.storage[Blade::getBasis(x)];
+        }
+
+        /// Vector i of frame e.
+        [[nodiscard]] Multivector vector(const std::size_t e, const int i) const {
+            if (!alg) {
+                throw std::invalid_argument("ga::FrameBatch::vector: batch has no Algebra");
+            }
+            if (e >= count || i < 0 || i >= size) {
+                throw std::out_of_range("ga::FrameBatch::vector: index out of range");
+            }
+            Multivector v(*alg);
+            for (int x = 0; x < alg->dimensions; ++x) v.storage[Blade::getBasis(x)] = column(i, x)[e];
+            return v;
+        }
+
+        /// Frame e as a Frame (computes its reciprocal).
+        [[nodiscard]] Frame get(const std::size_t e) const {
+            std::vector<Multivector> vs;
+            for (int i = 0; i < size; ++i) vs.push_back(vector(e, i));
+            return Frame(*alg, vs);
+        }
+
+        /**
+         * @brief Reciprocal frame of every element.
+         *
+         * Each element costs one k x k Gram matrix and inverse. Elements are
+         * spread across threads. Throws std::runtime_error if any frame is
+         * degenerate.
+         */
+        [[nodiscard]] FrameBatch reciprocal() const {
+            if (!alg) {
+                throw std::invalid_argument("ga::FrameBatch::reciprocal: batch has no Algebra");
+            }
+            FrameBatch out(*alg, size, count);
+            const int dims = alg->dimensions;
+            const int k = size;
+            double g[MAX_DIMENSIONS];
+            for (int x = 0; x < dims; ++x) g[x] = alg->signature.getSign(x);
+
+            ga::parallel::parallelFor(count, 256, [&](const std::size_t begin, const std::size_t end) {
+                double a[MAX_DIMENSIONS * MAX_DIMENSIONS]{}, r[MAX_DIMENSIONS * MAX_DIMENSIONS]{};
+                for (std::size_t e = begin; e < end; ++e) {
+                    for (int i = 0; i < k; ++i) {
+                        for (int x = 0; x < dims; ++x) a[i * dims + x] = column(i, x)[e];
+                    }
+                    if (detail::reciprocalRows(a, k, dims, g, r) == 0.0) {
+                        throw std::runtime_error("ga::FrameBatch::reciprocal: frame " + std::to_string(e) +
+                                                 " is degenerate");
+                    }
+                    for (int i = 0; i < k; ++i) {
+                        for (int x = 0; x < dims; ++x) out.column(i, x)[e] = static_cast<float>(r[i * dims + x]);
+                    }
+                }
+            });
+            return out;
+        }
+
+        /**
+         * @brief Dots of each element's vector with its frame: out[i * count + e] = v[e] . a_i(e).
+         *
+         * These are the covariant components of v; called on the reciprocal
+         * batch they are the contravariant ones. Only grade-1 columns of `v`
+         * are read.
+         */
+        void project(const MultivectorBatch& v, std::vector<float>& out) const {
+            if (!alg || v.alg != alg) {
+                throw std::invalid_argument("ga::FrameBatch::project: Algebra mismatch or null");
+            }
+            if (v.count != count) {
+                throw std::invalid_argument("ga::FrameBatch::project: batch sizes differ");
+            }
+            out.assign(static_cast<std::size_t>(size) * count, 0.0f);
+            for (int i = 0; i < size; ++i) {
+                float* dst = &out[static_cast<std::size_t>(i) * count];
+                for (int x = 0; x < alg->dimensions; ++x) {
+                    const auto gx = static_cast<float>(alg->signature.getSign(x));
+                    if (gx == 0.0f) continue;
+                    const float* a = column(i, x);
+                    const float* c = v.column(Blade::getBasis(x));
+                    for (std::size_t e = 0; e < count; ++e) dst[e] += gx * a[e] * c[e];
+                }
+            }
+        }
+    };
+
+} // namespace ga
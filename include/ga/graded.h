@@ -0,0 +1,371 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/multivector.h"
+#include "ga/signature.h"
+#include "ga/ops/blade.h"
+
+// Compile-time grade-typed multivectors.
+//
+// Graded<Alg, G> stores only the blades whose grade is in the set G (bit k =
+// grade k) of a StaticAlgebra, so a Vector<E3> is three floats rather than a
+// 256-entry DenseStorage. Every product works out its result grade set and its
+// list of (left index, right index, output index, sign) terms at compile time
+// from the operand grade sets and the metric:
+//
+//   Vector<E3> a, b;
+//   auto B = a ^ b;   // Graded<E3, grade(2)>, 9 terms
+//   auto R = a * b;   // Graded<E3, grade(0) | grade(2)>, 9 terms
+//
+// Terms that vanish in the metric (null axes) or are dropped by the product's
+// grade filter are never generated, and a result grade that receives no term
+// is not part of the result type. Small term lists are fully unrolled.
+//
+// Everything is constexpr, so constants and products of constants can be
+// evaluated at compile time. toMultivector()/fromMultivector() bridge to the
+// runtime Multivector API.
+
+namespace ga::graded {
+
+    using ga::Algebra;
+    using ga::Blade;
+    using ga::BladeMask;
+    using ga::Multivector;
+    using ga::Signature;
+
+    /// Set of grades, bit k = grade k.
+    using GradeSet = std::uint32_t;
+
+    constexpr GradeSet grade(const int k) { return GradeSet{1} << k; }
+
+    /// Cl(P, Q, R) fixed at compile time; axes ordered positive, negative, null as in Signature.
+    template <int P, int Q = 0, int R = 0>
+    struct StaticAlgebra {
+        static_assert(P >= 0 && Q >= 0 && R >= 0 && P + Q + R <= MAX_DIMENSIONS,
+                      "ga::graded::StaticAlgebra: need p, q, r >= 0 and p + q + r <= 8");
+
+        static constexpr int p = P;
+        static constexpr int q = Q;
+        static constexpr int r = R;
+        static constexpr int dims = P + Q + R;
+        static constexpr Signature signature{P, Q, R, true};
+        static constexpr GradeSet allGrades = (GradeSet{1} << (dims + 1)) - 1;
+
+        /// Runtime Algebra for interop with Multivector.
+        static const Algebra& algebra() {
+            static const Algebra alg{signature};
+            return alg;
+        }
+    };
+
+    namespace detail {
+
+        enum class Product { Geometric, Wedge, Inner, LeftContraction, RightContraction };
+
+        // Same grade filters as ga::ops (wedge.h, inner.h)
+        constexpr bool keep(const Product kind, const int ga, const int gb, const int gr) {
+            switch (kind) {
+                case Product::Geometric: return true;
+                case Product::Wedge: return gr == ga + gb;
+                case Product::Inner: return gr == (ga > gb ? ga - gb : gb - ga);
+                case Product::LeftContraction: return ga <= gb && gr == gb - ga;
+                case Product::RightContraction: return ga >= gb && gr == ga - gb;
+            }
+            return false;
+        }
+
+        constexpr bool inSet(const GradeSet g, const BladeMask m) {
+            return (g >> Blade::getGrade(m)) & 1u;
+        }
+
+        template <int Dims, GradeSet G>
+        constexpr std::size_t bladeCount() {
+            std::size_t n = 0;
+            for (unsigned m = 0; m < (1u << Dims); ++m)
+                if (inSet(G, static_cast<BladeMask>(m))) ++n;
+            return n;
+        }
+
+        // Blades of the grade set in ascending mask order (the storage order of Graded)
+        template <int Dims, GradeSet G>
+        constexpr auto blades() {
+            std::array<BladeMask, bladeCount<Dims, G>()> out{};
+            std::size_t n = 0;
+            for (unsigned m = 0; m < (1u << Dims); ++m)
+                if (inSet(G, static_cast<BladeMask>(m))) out[n++] = static_cast<BladeMask>(m);
+            return out;
+        }
+
+        template <std::size_t N>
+        constexpr int indexIn(const std::array<BladeMask, N>& list, const BladeMask m) {
+            for (std::size_t k = 0; k < N; ++k)
+                if (list[k] == m) return static_cast<int>(k);
+            return -1;
+        }
+
+        struct Term {
+            std::uint16_t a = 0;
+            std::uint16_t b = 0;
+            std::uint16_t r = 0;
+            std::int8_t sign = 0;
+        };
+
+        template <class Alg, GradeSet GA, GradeSet GB, Product Kind>
+        struct ProductPlan {
+            static constexpr auto A = blades<Alg::dims, GA>();
+            static constexpr auto B = blades<Alg::dims, GB>();
+
+            template <class Visit>
+            static constexpr void forEachTerm(Visit&& visit) {
+                for (std::size_t i = 0; i < A.size(); ++i) {
+                    for (std::size_t j = 0; j < B.size(); ++j) {
+                        const Blade gp = ops::geometricProductBlade(Blade{A[i], +1}, Blade{B[j], +1}, Alg::signature);
+                        if (Blade::isZero(gp))
+                            continue;
+                        if (!keep(Kind, Blade::getGrade(A[i]), Blade::getGrade(B[j]), Blade::getGrade(gp.mask)))
+                            continue;
+                        visit(i, j, gp);
+                    }
+                }
+            }
+
+            static constexpr GradeSet resultGrades() {
+                GradeSet g = 0;
+                forEachTerm([&](std::size_t, std::size_t, const Blade& gp) { g |= grade(Blade::getGrade(gp.mask)); });
+                return g;
+            }
+
+            static constexpr std::size_t countTerms() {
+                std::size_t n = 0;
+                forEachTerm([&](std::size_t, std::size_t, const Blade&) { ++n; });
+                return n;
+            }
+
+            static constexpr GradeSet grades = resultGrades();
+            static constexpr auto R = blades<Alg::dims, grades>();
+
+            static constexpr auto buildTerms() {
+                std::array<Term, countTerms()> t{};
+                std::size_t n = 0;
+                forEachTerm([&](const std::size_t i, const std::size_t j, const Blade& gp) {
+                    t[n++] = Term{static_cast<std::uint16_t>(i), static_cast<std::uint16_t>(j),
+                                  static_cast<std::uint16_t>(indexIn(R, gp.mask)),
+                                  static_cast<std::int8_t>(gp.sign)};
+                });
+                return t;
+            }
+
+            static constexpr auto terms = buildTerms();
+        };
+
+        // Above this many terms a loop beats unrolling on compile time and code size
+        static constexpr std::size_t UNROLL_LIMIT = 512;
+
+        template <class Plan, class X, class Y, class Z>
+        constexpr void run(const X& x, const Y& y, Z& z) {
+            constexpr auto& T = Plan::terms;
+            if constexpr (T.size() <= UNROLL_LIMIT) {
+                [&]<std::size_t... K>(std::index_sequence<K...>) {
+                    ((z.c[T[K].r] += static_cast<float>(T[K].sign) * x.c[T[K].a] * y.c[T[K].b]), ...);
+                }(std::make_index_sequence<T.size()>{});
+            } else {
+                for (const Term& t : T) {
+                    z.c[t.r] += static_cast<float>(t.sign) * x.c[t.a] * y.c[t.b];
+                }
+            }
+        }
+
+    } // namespace detail
+
+    template <class Alg, GradeSet G>
+    struct Graded {
+        static_assert((G & ~Alg::allGrades) == 0, "ga::graded::Graded: grade set exceeds the algebra dimension");
+
+        using algebra_type = Alg;
+        static constexpr GradeSet grades = G;
+        static constexpr auto blades = detail::blades<Alg::dims, G>();
+        static constexpr std::size_t size = blades.size();
+
+        std::array<float, size> c{};  ///< coefficients in `blades` order
+
+        /// Storage index of blade `m`, or -1 if its grade is not in G.
+        static constexpr int indexOf(const BladeMask m) { return detail::indexIn(blades, m); }
+
+        [[nodiscard]] constexpr float component(const BladeMask m) const {
+            const int k = indexOf(m);
+            return k < 0 ? 0.0f : c[k];
+        }
+
+        constexpr void setComponent(const BladeMask m, const float value) {
+            const int k = indexOf(m);
+            if (k < 0) {
+                throw std::out_of_range("ga::graded::Graded::setComponent: blade grade not in this type");
+            }
+            c[k] = value;
+        }
+
+        /// Widening conversion to a type whose grade set contains G.
+        template <GradeSet H>
+            requires ((G & ~H) == 0 && G != H)
+        constexpr operator Graded<Alg, H>() const {
+            Graded<Alg, H> out;
+            for (std::size_t k = 0; k < size; ++k) out.c[Graded<Alg, H>::indexOf(blades[k])] = c[k];
+            return out;
+        }
+
+        [[nodiscard]] Multivector toMultivector() const {
+            Multivector mv(Alg::algebra());
+            for (std::size_t k = 0; k < size; ++k) mv.storage[blades[k]] = c[k];
+            return mv;
+        }
+
+        /// Project a runtime multivector onto the grades of this type; other grades are dropped.
+        static Graded fromMultivector(const Multivector& mv) {
+            if (!mv.alg || mv.alg->dimensions != Alg::dims) {
+                throw std::invalid_argument("ga::graded::Graded::fromMultivector: Algebra mismatch or null");
+            }
+            Graded out;
+            for (std::size_t k = 0; k < size; ++k) out.c[k] = mv.storage[blades[k]];
+            return out;
+        }
+    };
+
+    template <class Alg> using Scalar = Graded<Alg, grade(0)>;
+    template <class Alg> using Vector = Graded<Alg, grade(1)>;
+    template <class Alg> using Bivector = Graded<Alg, grade(2)>;
+    template <class Alg> using Trivector = Graded<Alg, grade(3)>;
+    template <class Alg> using Even = Graded<Alg, Alg::allGrades & 0x155u>;
+    template <class Alg> using Full = Graded<Alg, Alg::allGrades>;
+
+    /// Basis blade e_m as a single-grade value.
+    template <class Alg, BladeMask M>
+    constexpr Graded<Alg, grade(Blade::getGrade(M))> basis(const float s = 1.0f) {
+        Graded<Alg, grade(Blade::getGrade(M))> out;
+        out.setComponent(M, s);
+        return out;
+    }
+
+    // -------------------------------------------------------------------------
+    // Products: result type inferred at compile time
+    // -------------------------------------------------------------------------
+
+    template <class Alg, GradeSet GA, GradeSet GB, detail::Product Kind>
+    using ProductResult = Graded<Alg, detail::ProductPlan<Alg, GA, GB, Kind>::grades>;
+
+    template <detail::Product Kind, class Alg, GradeSet GA, GradeSet GB>
+    constexpr ProductResult<Alg, GA, GB, Kind> product(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        ProductResult<Alg, GA, GB, Kind> out;
+        detail::run<detail::ProductPlan<Alg, GA, GB, Kind>>(a, b, out);
+        return out;
+    }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto geometricProduct(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        return product<detail::Product::Geometric>(a, b);
+    }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto wedge(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        return product<detail::Product::Wedge>(a, b);
+    }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto inner(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        return product<detail::Product::Inner>(a, b);
+    }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto leftContraction(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        return product<detail::Product::LeftContraction>(a, b);
+    }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto rightContraction(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        return product<detail::Product::RightContraction>(a, b);
+    }
+
+    // Same operator spelling as ga/operators.h
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto operator*(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) { return geometricProduct(a, b); }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto operator^(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) { return wedge(a, b); }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto operator&(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) { return inner(a, b); }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto operator<<(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) { return leftContraction(a, b); }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr auto operator>>(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) { return rightContraction(a, b); }
+
+    // -------------------------------------------------------------------------
+    // Linear operations
+    // -------------------------------------------------------------------------
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr Graded<Alg, GA | GB> operator+(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        using Out = Graded<Alg, GA | GB>;
+        Out out;
+        for (std::size_t k = 0; k < a.size; ++k) out.c[Out::indexOf(a.blades[k])] += a.c[k];
+        for (std::size_t k = 0; k < b.size; ++k) out.c[Out::indexOf(b.blades[k])] += b.c[k];
+        return out;
+    }
+
+    template <class Alg, GradeSet G>
+    constexpr Graded<Alg, G> operator*(const float s, const Graded<Alg, G>& a) {
+        Graded<Alg, G> out;
+        for (std::size_t k = 0; k < a.size; ++k) out.c[k] = s * a.c[k];
+        return out;
+    }
+
+    template <class Alg, GradeSet G>
+    constexpr Graded<Alg, G> operator*(const Graded<Alg, G>& a, const float s) { return s * a; }
+
+    template <class Alg, GradeSet GA, GradeSet GB>
+    constexpr Graded<Alg, GA | GB> operator-(const Graded<Alg, GA>& a, const Graded<Alg, GB>& b) {
+        return a + (-1.0f) * b;
+    }
+
+    /// Grade-K part; the result type is empty when K is not in G.
+    template <int K, class Alg, GradeSet G>
+    constexpr Graded<Alg, G & grade(K)> gradePart(const Graded<Alg, G>& a) {
+        using Out = Graded<Alg, G & grade(K)>;
+        Out out;
+        for (std::size_t k = 0; k < Out::size; ++k) out.c[k] = a.component(Out::blades[k]);
+        return out;
+    }
+
+    /// Reverse: grade r picks up (-1)^{r(r-1)/2}.
+    template <class Alg, GradeSet G>
+    constexpr Graded<Alg, G> reverse(const Graded<Alg, G>& a) {
+        Graded<Alg, G> out;
+        for (std::size_t k = 0; k < a.size; ++k) {
+            const int r = Blade::getGrade(a.blades[k]);
+            out.c[k] = ((r * (r - 1) / 2) & 1) ? -a.c[k] : a.c[k];
+        }
+        return out;
+    }
+
+    template <class Alg, GradeSet G>
+    constexpr Graded<Alg, G> operator~(const Graded<Alg, G>& a) { return reverse(a); }
+
+    /// Grade involution: grade r picks up (-1)^r.
+    template <class Alg, GradeSet G>
+    constexpr Graded<Alg, G> gradeInvolution(const Graded<Alg, G>& a) {
+        Graded<Alg, G> out;
+        for (std::size_t k = 0; k < a.size; ++k) {
+            out.c[k] = (Blade::getGrade(a.blades[k]) & 1) ? -a.c[k] : a.c[k];
+        }
+        return out;
+    }
+
+} // namespace ga::graded
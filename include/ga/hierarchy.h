@@ -0,0 +1,313 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/pga.h"
+#include "ga/spline.h"
+#include "ga/ops/blade.h"
+
+// Transform hierarchies (scene graphs, kinematic trees).
+//
+// Nodes live in one flat array in topological order: a node's parent always
+// has a smaller index. Each node holds a local transform L_i and a world
+// transform
+//
+//   W_i = W_parent(i) L_i        (W_i = L_i for roots)
+//
+// Transforms are unit E3 rotors or unit PGA motors, kept as compact 8-float
+// even-subalgebra motors (the layout of ga::spline) and multiplied with the
+// unrolled compact product instead of dense Multivectors.
+//
+// setLocal() only records the node as changed. update() then walks the
+// subtrees below the changed nodes (child / sibling links), buckets the
+// affected nodes by depth and recomputes one depth level at a time, each
+// level spread across ga::parallel. The work is proportional to the number
+// of affected nodes, not to the size of the tree.
+//
+// World transforms export as row-major 4 x 4 homogeneous matrices, the
+// action X -> W X ~W on points, or as a MultivectorBatch.
+
+namespace ga {
+
+    namespace detail {
+
+        // Entry (row, col) of the point matrix gains sign * m[a] * m[b]
+        struct MotorMatrixTerm {
+            std::uint8_t a, b, row, col;
+            std::int8_t sign;
+        };
+
+        // Point coordinates (x, y, z, w) as signed trivectors, following ga::pga::point
+        inline constexpr BladeMask POINT_MASKS[4] = {ga::pga::E234, ga::pga::E134, ga::pga::E124, ga::pga::E123};
+        inline constexpr int POINT_SIGNS[4] = {-1, +1, -1, +1};
+
+        constexpr int pointIndex(const BladeMask m) {
+            for (int k = 0; k < 4; ++k) {
+                if (POINT_MASKS[k] == m) return k;
+            }
+            return -1;
+        }
+
+        inline constexpr std::size_t MOTOR_MATRIX_TERMS = [] {
+            std::size_t n = 0;
+            for (int a = 0; a < 8; ++a) {
+                for (int b = 0; b < 8; ++b) {
+                    for (int col = 0; col < 4; ++col) {
+                        const Blade ap = ga::ops::geometricProductBlade(Blade{spline::detail::EVEN_MASKS[a], +1},
+                                                                        Blade{POINT_MASKS[col], +1}, ga::pga::signature);
+                        const Blade apb = ga::ops::geometricProductBlade(ap, Blade{spline::detail::EVEN_MASKS[b], +1},
+                                                                         ga::pga::signature);
+                        n += apb.sign != 0 && pointIndex(apb.mask) >= 0;
+                    }
+                }
+            }
+            return n;
+        }();
+
+        /// Quadratic form of M P ~M on the basis points: every product e_a P_col ~e_b that lands on a
+        /// point blade (vector parts cancel in the full sandwich).
+        inline constexpr std::array<MotorMatrixTerm, MOTOR_MATRIX_TERMS> MOTOR_MATRIX = [] {
+            std::array<MotorMatrixTerm, MOTOR_MATRIX_TERMS> out{};
+            std::size_t n = 0;
+            for (int a = 0; a < 8; ++a) {
+                for (int b = 0; b < 8; ++b) {
+                    const BladeMask mb = spline::detail::EVEN_MASKS[b];
+                    const int reverseSign = Blade::getGrade(mb) == 2 ? -1 : +1;
+                    for (int col = 0; col < 4; ++col) {
+                        const Blade ap = ga::ops::geometricProductBlade(Blade{spline::detail::EVEN_MASKS[a], +1},
+                                                                        Blade{POINT_MASKS[col], +1}, ga::pga::signature);
+                        const Blade apb = ga::ops::geometricProductBlade(ap, Blade{mb, +1}, ga::pga::signature);
+                        const int row = pointIndex(apb.mask);
+                        if (apb.sign == 0 || row < 0) continue;
+                        out[n++] = {static_cast<std::uint8_t>(a), static_cast<std::uint8_t>(b),
+                                    static_cast<std::uint8_t>(row), static_cast<std::uint8_t>(col),
+                                    static_cast<std::int8_t>(apb.sign * reverseSign * POINT_SIGNS[row] * POINT_SIGNS[col])};
+                    }
+                }
+            }
+            return out;
+        }();
+
+        /// Row-major 4 x 4 matrix of the point action of a compact motor.
+        inline void motorMatrix(const spline::detail::Motor& m, float* out) {
+            float r[16] = {};
+            [&]<std::size_t... K>(std::index_sequence<K...>) {
+                ((r[MOTOR_MATRIX[K].row * 4 + MOTOR_MATRIX[K].col] +=
+                  static_cast<float>(MOTOR_MATRIX[K].sign) * m[MOTOR_MATRIX[K].a] * m[MOTOR_MATRIX[K].b]),
+                 ...);
+            }(std::make_index_sequence<MOTOR_MATRIX_TERMS>{});
+            std::copy(r, r + 16, out);
+        }
+
+    } // namespace detail
+
+    class TransformHierarchy {
+    public:
+        using Motor = spline::detail::Motor;
+
+        static constexpr std::uint32_t NO_PARENT = 0xFFFFFFFFu;
+
+        /// Empty hierarchy of E3 rotors or PGA motors.
+        explicit TransformHierarchy(const Algebra& alg) : alg_(&alg) {
+            if (!spline::detail::supported(alg)) {
+                throw std::invalid_argument("ga::TransformHierarchy: expected the E3 or PGA algebra");
+            }
+        }
+
+        /**
+         * @brief Hierarchy from parent indices and local transforms.
+         *
+         * parents[i] must be NO_PARENT or smaller than i.
+         */
+        TransformHierarchy(const Algebra& alg, const std::vector<std::uint32_t>& parents,
+                           const std::vector<Multivector>& locals)
+            : TransformHierarchy(alg) {
+            if (parents.size() != locals.size()) {
+                throw std::invalid_argument("ga::TransformHierarchy: parents and locals differ in size");
+            }
+            reserve(parents.size());
+            for (std::size_t i = 0; i < parents.size(); ++i) (void)add(parents[i], locals[i]);
+        }
+
+        [[nodiscard]] const Algebra* algebra() const noexcept { return alg_; }
+        [[nodiscard]] std::size_t size() const noexcept { return parent_.size(); }
+        [[nodiscard]] std::uint32_t parent(const std::size_t i) const { return parent_.at(i); }
+        [[nodiscard]] std::uint32_t depth(const std::size_t i) const { return depth_.at(i); }
+
+        /// True if some world transform is out of date.
+        [[nodiscard]] bool dirty() const noexcept { return !changed_.empty(); }
+
+        void reserve(const std::size_t n) {
+            for (auto* v : {&parent_, &depth_, &firstChild_, &nextSibling_}) v->reserve(n);
+            local_.reserve(n);
+            world_.reserve(n);
+            flags_.reserve(n);
+        }
+
+        /// Append a node; `parent` is NO_PARENT or an existing node. Returns its index.
+        std::uint32_t add(const std::uint32_t parent, const Multivector& local) {
+            if (parent != NO_PARENT && parent >= size()) {
+                throw std::invalid_argument("ga::TransformHierarchy::add: parent must precede the node");
+            }
+            if (size() >= NO_PARENT) {
+                throw std::length_error("ga::TransformHierarchy::add: too many nodes");
+            }
+            const auto i = static_cast<std::uint32_t>(size());
+            parent_.push_back(parent);
+            depth_.push_back(parent == NO_PARENT ? 0 : depth_[parent] + 1);
+            firstChild_.push_back(NO_PARENT);
+            nextSibling_.push_back(NO_PARENT);
+            if (parent != NO_PARENT) {
+                nextSibling_[i] = firstChild_[parent];
+                firstChild_[parent] = i;
+            }
+            local_.push_back(spline::detail::toMotor(local, alg_));
+            world_.push_back(Motor{});
+            flags_.push_back(0);
+            markChanged(i);
+            return i;
+        }
+
+        [[nodiscard]] Multivector local(const std::size_t i) const {
+            return spline::detail::toMultivector(local_.at(i), *alg_);
+        }
+
+        /// World transform as of the last update().
+        [[nodiscard]] Multivector world(const std::size_t i) const {
+            return spline::detail::toMultivector(world_.at(i), *alg_);
+        }
+
+        /// Replace a local transform; its subtree is recomputed on the next update().
+        void setLocal(const std::size_t i, const Multivector& local) {
+            if (i >= size()) {
+                throw std::out_of_range("ga::TransformHierarchy::setLocal: node out of range");
+            }
+            local_[i] = spline::detail::toMotor(local, alg_);
+            markChanged(static_cast<std::uint32_t>(i));
+        }
+
+        /// Compact local motor (s, e12, e13, e23, e14, e24, e34, e1234); same effect as setLocal.
+        void setLocal(const std::size_t i, const Motor& local) {
+            if (i >= size()) {
+                throw std::out_of_range("ga::TransformHierarchy::setLocal: node out of range");
+            }
+            local_[i] = local;
+            markChanged(static_cast<std::uint32_t>(i));
+        }
+
+        [[nodiscard]] const Motor& localMotor(const std::size_t i) const { return local_.at(i); }
+        [[nodiscard]] const Motor& worldMotor(const std::size_t i) const { return world_.at(i); }
+
+        /**
+         * @brief Recompute the world transforms below every changed node.
+         *
+         * Returns the number of nodes recomputed.
+         */
+        std::size_t update() {
+            if (changed_.empty()) return 0;
+
+            // Collect each affected subtree once; a node already collected stops the walk
+            std::size_t affected = 0;
+            std::uint32_t maxDepth = 0;
+            for (const std::uint32_t root : changed_) {
+                if (flags_[root] & AFFECTED) continue;
+                stack_.assign(1, root);
+                while (!stack_.empty()) {
+                    const std::uint32_t n = stack_.back();
+                    stack_.pop_back();
+                    if (flags_[n] & AFFECTED) continue;
+                    flags_[n] |= AFFECTED;
+                    const std::uint32_t d = depth_[n];
+                    if (d >= levels_.size()) levels_.resize(d + 1);
+                    levels_[d].push_back(n);
+                    maxDepth = std::max(maxDepth, d);
+                    ++affected;
+                    for (std::uint32_t c = firstChild_[n]; c != NO_PARENT; c = nextSibling_[c]) stack_.push_back(c);
+                }
+            }
+
+            // Parents are one level up, so each level only reads finished results
+            for (std::uint32_t d = 0; d <= maxDepth; ++d) {
+                std::vector<std::uint32_t>& level = levels_[d];
+                ga::parallel::parallelFor(level.size(), LEVEL_GRAIN, [&](const std::size_t b, const std::size_t e) {
+                    for (std::size_t k = b; k < e; ++k) {
+                        const std::uint32_t n = level[k];
+                        const std::uint32_t p = parent_[n];
+                        world_[n] = p == NO_PARENT ? local_[n] : spline::detail::mul(world_[p], local_[n]);
+                        flags_[n] = 0;
+                    }
+                });
+                level.clear();
+            }
+            for (const std::uint32_t n : changed_) flags_[n] = 0;
+            changed_.clear();
+            return affected;
+        }
+
+        /// Row-major 4 x 4 homogeneous matrix of world transform i (points, as of the last update()).
+        void worldMatrix(const std::size_t i, float* out) const {
+            detail::motorMatrix(world_.at(i), out);
+        }
+
+        /// All world matrices, 16 floats per node in node order.
+        void worldMatrices(float* out) const {
+            ga::parallel::parallelFor(size(), MATRIX_GRAIN, [&](const std::size_t b, const std::size_t e) {
+                for (std::size_t n = b; n < e; ++n) detail::motorMatrix(world_[n], out + 16 * n);
+            });
+        }
+
+        [[nodiscard]] std::vector<float> worldMatrices() const {
+            std::vector<float> out(16 * size());
+            worldMatrices(out.data());
+            return out;
+        }
+
+        /// World transforms into the even columns of `out` (count == size()); other columns are untouched.
+        void worldTransforms(MultivectorBatch& out) const {
+            if (out.alg != alg_ || out.count != size()) {
+                throw std::invalid_argument("ga::TransformHierarchy::worldTransforms: batch does not match the hierarchy");
+            }
+            const std::size_t N = out.bladeCount();
+            for (int k = 0; k < 8; ++k) {
+                const BladeMask m = spline::detail::EVEN_MASKS[k];
+                if (m >= N) continue;
+                float* dst = out.column(m);
+                for (std::size_t n = 0; n < size(); ++n) dst[n] = world_[n][k];
+            }
+        }
+
+    private:
+        static constexpr std::uint8_t CHANGED = 1;
+        static constexpr std::uint8_t AFFECTED = 2;
+        static constexpr std::size_t LEVEL_GRAIN = 1024;
+        static constexpr std::size_t MATRIX_GRAIN = 1024;
+
+        void markChanged(const std::uint32_t i) {
+            if (flags_[i] & CHANGED) return;
+            flags_[i] |= CHANGED;
+            changed_.push_back(i);
+        }
+
+        const Algebra* alg_;
+        std::vector<std::uint32_t> parent_, depth_, firstChild_, nextSibling_;
+        std::vector<Motor> local_, world_;
+        std::vector<std::uint8_t> flags_;
+        std::vector<std::uint32_t> changed_;  ///< nodes set since the last update(), each once
+
+        // Scratch reused across updates
+        std::vector<std::uint32_t> stack_;
+        std::vector<std::vector<std::uint32_t>> levels_;
+    };
+
+} // namespace ga
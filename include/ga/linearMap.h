@@ -2,15 +2,133 @@
 
 #include <stdexcept>
 #include <cstddef>
+#include <cmath>
+#include <utility>
 #include <vector>
 
 #include "ga/algebra.h"
 #include "ga/multivector.h"
 #include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/metrics.h"
+#include "ga/parallel.h"
 #include "ga/ops/wedge.h"
 
 namespace ga {
 
+/// Blade masks of one grade in ascending mask order (the row/column order of compound matrices).
+inline std::vector<BladeMask> gradeBlades(const int dims, const int grade) {
+    std::vector<BladeMask> masks;
+    const std::size_t bladeCount = (1u << dims);
+    for (std::size_t mask = 0; mask < bladeCount; ++mask) {
+        if (Blade::getGrade(static_cast<BladeMask>(mask)) == grade) {
+            masks.push_back(static_cast<BladeMask>(mask));
+        }
+    }
+    return masks;
+}
+
+/**
+ * @brief The k-th compound matrix of a linear map: its action on grade-k blades.
+ *
+ * With e_I = e_{i1} ∧ ... ∧ e_{ik} in ascending axis order,
+ *
+ *   L(e_I) = sum_J det(m[J][I]) e_J
+ *
+ * so the outermorphism restricted to grade k is a C(n,k) x C(n,k) matrix of
+ * k x k minors. For k = n-1 in E3 this is the cofactor matrix used for normals.
+ * Build it once with LinearMap::compound(k) and reuse it across many inputs.
+ */
+struct CompoundMap {
+    const Algebra* alg = nullptr;
+    int grade = 0;
+    std::vector<BladeMask> masks;  ///< grade-k blades, row/column order
+    std::vector<float> m;          ///< row-major masks.size() x masks.size()
+
+    [[nodiscard]] std::size_t size() const { return masks.size(); }
+
+    /// Apply to the grade-k part of A. Other grades of A are ignored.
+    [[nodiscard]] Multivector apply(const Multivector& A) const {
+        if (!alg || !A.alg || A.alg != alg) {
+            throw std::invalid_argument("ga::CompoundMap::apply: Algebra mismatch or null");
+        }
+        const std::size_t C = masks.size();
+        float in[70];  // C(8,4) is the largest compound
+        for (std::size_t c = 0; c < C; ++c) {
+            in[c] = A.storage[masks[c]];
+        }
+
+        Multivector out(*alg);
+        for (std::size_t r = 0; r < C; ++r) {
+            const float* row = &m[r * C];
+            float sum = 0.0f;
+            for (std::size_t c = 0; c < C; ++c) {
+                sum += row[c] * in[c];
+            }
+            out.storage[masks[r]] = sum;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Batch apply over structure-of-arrays input.
+     *
+     * Reads the grade-k columns of `in` and overwrites the grade-k columns of
+     * `out`; other columns of `out` are left untouched. `in` and `out` may be
+     * the same batch. Elements are processed in tiles so the C input rows of a
+     * tile stay in L1 while the C output rows are accumulated; tiles are
+     * spread across threads with ga::parallel.
+     */
+    void apply(const MultivectorBatch& in, MultivectorBatch& out) const {
+        if (!alg || in.alg != alg || out.alg != alg) {
+            throw std::invalid_argument("ga::CompoundMap::apply: Algebra mismatch or null");
+        }
+        if (in.count != out.count) {
+            throw std::invalid_argument("ga::CompoundMap::apply: batch sizes differ");
+        }
+
+        static constexpr std::size_t TILE = 64;
+        const std::size_t C = masks.size();
+        const std::size_t n = in.count;
+        const std::size_t tiles = (n + TILE - 1) / TILE;
+        ga::metrics::add(ga::metrics::Counter::BatchCalls);
+        ga::metrics::add(ga::metrics::Counter::BatchElements, n);
+        ga::metrics::record(ga::metrics::Histogram::BatchSize, n);
+        ga::metrics::peak(ga::metrics::Gauge::ScratchBytesPeak, C * TILE * sizeof(float));
+
+        ga::parallel::parallelFor(tiles, 16, [&](const std::size_t t0, const std::size_t t1) {
+            std::vector<float> tile(C * TILE);
+            for (std::size_t t = t0; t < t1; ++t) {
+                const std::size_t base = t * TILE;
+                const std::size_t len = (n - base < TILE) ? n - base : TILE;
+
+                for (std::size_t r = 0; r < C; ++r) {
+                    float* acc = &tile[r * TILE];
+                    for (std::size_t i = 0; i < len; ++i) acc[i] = 0.0f;
+
+                    const float* row = &m[r * C];
+                    for (std::size_t c = 0; c < C; ++c) {
+                        const float w = row[c];
+                        if (w == 0.0f)
+                            continue;
+                        const float* src = in.column(masks[c]) + base;
+                        for (std::size_t i = 0; i < len; ++i) {
+                            acc[i] += w * src[i];
+                        }
+                    }
+                }
+
+                // Write back after the whole tile is computed so in-place use is safe
+                for (std::size_t r = 0; r < C; ++r) {
+                    float* dst = out.column(masks[r]) + base;
+                    const float* acc = &tile[r * TILE];
+                    for (std::size_t i = 0; i < len; ++i) dst[i] = acc[i];
+                }
+            }
+        });
+    }
+};
+
 /**
  * @brief Linear map on the vector space of an Algebra, extended to all grades
  *        by outermorphism.
@@ -79,6 +197,47 @@ struct LinearMap {
         return m[row][col];
     }
 
+    /**
+     * @brief Build the k-th compound matrix of L (see CompoundMap).
+     *
+     * Each entry is a k x k minor, evaluated by Gaussian elimination in double,
+     * so building costs C(n,k)^2 minors. Keep the result and call its apply()
+     * for every grade-k input; that is the fast path, not rebuilding per call.
+     */
+    [[nodiscard]] CompoundMap compound(const int k) const {
+        if (!alg)
+            throw std::invalid_argument("ga::LinearMap::compound: no Algebra attached");
+        const int dims = alg->dimensions;
+        if (k < 0 || k > dims)
+            throw std::out_of_range("ga::LinearMap::compound: grade out of range");
+
+        CompoundMap cm;
+        cm.alg = alg;
+        cm.grade = k;
+        cm.masks = gradeBlades(dims, k);
+        const std::size_t C = cm.masks.size();
+        cm.m.assign(C * C, 0.0f);
+
+        int axes[70][8];
+        for (std::size_t b = 0; b < C; ++b) {
+            int n = 0;
+            for (int i = 0; i < dims; ++i)
+                if (Blade::hasAxis(cm.masks[b], i))
+                    axes[b][n++] = i;
+        }
+
+        for (std::size_t r = 0; r < C; ++r) {
+            for (std::size_t c = 0; c < C; ++c) {
+                double sub[8][8];
+                for (int i = 0; i < k; ++i)
+                    for (int j = 0; j < k; ++j)
+                        sub[i][j] = m[axes[r][i]][axes[c][j]];
+                cm.m[r * C + c] = static_cast<float>(determinant(sub, k));
+            }
+        }
+        return cm;
+    }
+
     /**
      * @brief Apply L only to the grade-1 (vector) part of v.
      *
@@ -232,6 +391,29 @@ struct LinearMap {
     return result;
 }
 
+private:
+    // Determinant of the leading k x k block (partial pivoting)
+    static double determinant(double a[8][8], const int k) {
+        double det = 1.0;
+        for (int col = 0; col < k; ++col) {
+            int pivot = col;
+            for (int r = col + 1; r < k; ++r)
+                if (std::fabs(a[r][col]) > std::fabs(a[pivot][col]))
+                    pivot = r;
+            if (a[pivot][col] == 0.0)
+                return 0.0;
+            if (pivot != col) {
+                for (int j = 0; j < k; ++j) std::swap(a[pivot][j], a[col][j]);
+                det = -det;
+            }
+            det *= a[col][col];
+            for (int r = col + 1; r < k; ++r) {
+                const double f = a[r][col] / a[col][col];
+                for (int j = col; j < k; ++j) a[r][j] -= f * a[col][j];
+            }
+        }
+        return det;
+    }
 };
 
 } // namespace ga
@@ -0,0 +1,579 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GASMITH_METRICS_SHM 1
+#else
+#define GASMITH_METRICS_SHM 0
+#endif
+
+// Opt-in runtime metrics for long-running processes.
+//
+// When enabled, the library counts calls per operation, batch sizes, product
+// kernel use and timing, and peak batch / scratch allocation. Each thread
+// writes its own shard of counters and histograms with plain relaxed stores
+// (no read-modify-write, no shared cache lines); snapshot() merges the shards
+// on read. When disabled, every recording site is a single relaxed load and
+// a branch. Product timings are sampled (one call in SAMPLE_PERIOD per thread)
+// so the clock is off the hot path.
+//
+// GASMITH_METRICS selects the initial state:
+//
+//   off     nothing is recorded (default)
+//   on      record; read with snapshot()
+//   shm     record and publish snapshots to shared memory every 100 ms,
+//           under the name from sharedName() ("/gasmith.<pid>")
+//
+// A published segment holds a SharedBlock guarded by a sequence lock, so an
+// external reader (readShared(), or the GASmith_metrics tool) can scrape a
+// consistent snapshot without stopping or signalling the process.
+
+namespace ga::metrics {
+
+    enum class Counter : std::uint8_t {
+        Products,             ///< geometricProductFiltered at runtime (every product, wedge, inner, ...)
+        ProductsDense,        ///< ... per kernel, in ga::autotune::Kernel order
+        ProductsTable,
+        ProductsBitParallel,
+        ProductsSparse,
+        ProductsGeometric,    ///< ... per operation, in Op order
+        ProductsWedge,
+        ProductsInner,
+        ProductsLeftContraction,
+        ProductsRightContraction,
+        ProductsFiltered,
+        Sandwiches,           ///< Versor::apply, Rotor::apply and ops::reflect on single multivectors
+        BatchCalls,           ///< ProductMatrix / CompoundMap batch applies
+        BatchElements,        ///< elements processed by those applies
+        ParallelJobs,         ///< parallelFor calls handed to the thread pool
+        ParallelChunks,       ///< chunks run by those calls
+        AutotuneRuns,         ///< autotune::tune() runs
+    };
+    inline constexpr int COUNTER_COUNT = 17;
+
+    /// Operation behind a geometricProductFiltered call, for the per-operation counters.
+    enum class Op : std::uint8_t {
+        Geometric,            ///< geometricProduct
+        Wedge,                ///< wedge
+        Inner,                ///< inner
+        LeftContraction,      ///< leftContraction
+        RightContraction,     ///< rightContraction
+        Filtered,             ///< any other grade filter passed to geometricProductFiltered
+    };
+
+    enum class Histogram : std::uint8_t {
+        BatchSize,            ///< elements per batch apply
+        ProductNanosDense,    ///< sampled product time per kernel, in ns
+        ProductNanosTable,
+        ProductNanosBitParallel,
+        ProductNanosSparse,
+    };
+    inline constexpr int HISTOGRAM_COUNT = 5;
+
+    enum class Gauge : std::uint8_t {
+        BatchBytesPeak,       ///< largest MultivectorBatch allocated
+        ScratchBytesPeak,     ///< largest per-call scratch buffer in batch kernels
+    };
+    inline constexpr int GAUGE_COUNT = 2;
+
+    /// Histogram buckets are powers of two: bucket b counts values in [2^(b-1), 2^b), bucket 0 counts 0.
+    inline constexpr int BUCKETS = 40;
+
+    /// One product call in SAMPLE_PERIOD (per thread) is timed.
+    inline constexpr std::uint32_t SAMPLE_PERIOD = 64;
+
+    inline const char* name(const Counter c) {
+        static constexpr const char* names[COUNTER_COUNT] = {
+            "products", "products_dense", "products_table", "products_bitparallel", "products_sparse",
+            "products_geometric", "products_wedge", "products_inner", "products_left_contraction",
+            "products_right_contraction", "products_filtered", "sandwiches", "batch_calls", "batch_elements", "parallel_jobs", "parallel_chunks", "autotune_runs"};
+        return names[static_cast<int>(c)];
+    }
+
+    inline const char* name(const Histogram h) {
+        static constexpr const char* names[HISTOGRAM_COUNT] = {
+            "batch_size", "product_ns_dense", "product_ns_table", "product_ns_bitparallel", "product_ns_sparse"};
+        return names[static_cast<int>(h)];
+    }
+
+    inline const char* name(const Gauge g) {
+        static constexpr const char* names[GAUGE_COUNT] = {"batch_bytes_peak", "scratch_bytes_peak"};
+        return names[static_cast<int>(g)];
+    }
+
+    struct HistogramData {
+        std::uint64_t count = 0;
+        std::uint64_t sum = 0;
+        std::uint64_t buckets[BUCKETS]{};
+
+        /// Upper bound of the bucket holding quantile q (0..1); 0 if empty.
+        [[nodiscard]] std::uint64_t quantile(const double q) const {
+            if (count == 0) return 0;
+            const double target = q * static_cast<double>(count);
+            std::uint64_t seen = 0;
+            for (int b = 0; b < BUCKETS; ++b) {
+                seen += buckets[b];
+                if (static_cast<double>(seen) >= target && buckets[b] != 0) {
+                    return b == 0 ? 0 : (std::uint64_t{1} << b) - 1;
+                }
+            }
+            return (std::uint64_t{1} << (BUCKETS - 1)) - 1;
+        }
+
+        [[nodiscard]] double mean() const {
+            return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+        }
+    };
+
+    /// Merged view of every thread's metrics. Plain data, so it can live in shared memory.
+    struct Snapshot {
+        std::uint64_t counters[COUNTER_COUNT]{};
+        HistogramData histograms[HISTOGRAM_COUNT]{};
+        std::uint64_t gauges[GAUGE_COUNT]{};
+
+        [[nodiscard]] std::uint64_t operator[](const Counter c) const { return counters[static_cast<int>(c)]; }
+        [[nodiscard]] const HistogramData& operator[](const Histogram h) const { return histograms[static_cast<int>(h)]; }
+        [[nodiscard]] std::uint64_t operator[](const Gauge g) const { return gauges[static_cast<int>(g)]; }
+    };
+
+    /// Layout of a published shared-memory segment.
+    struct SharedBlock {
+        static constexpr char MAGIC[8] = {'G', 'A', 'S', 'M', 'E', 'T', 'R', '2'};
+
+        char magic[8];
+        std::uint32_t size;                   ///< sizeof(SharedBlock), as a layout check
+        std::uint32_t pid;
+        std::atomic<std::uint64_t> sequence;  ///< odd while a write is in progress
+        std::uint64_t publishedNanos;         ///< system_clock time of the last publish
+        Snapshot snapshot;
+    };
+
+    namespace detail {
+
+        inline int bucketOf(const std::uint64_t v) {
+            return std::min(static_cast<int>(std::bit_width(v)), BUCKETS - 1);
+        }
+
+        // Written only by its owning thread; read concurrently by snapshot()
+        struct Shard {
+            std::atomic<std::uint64_t> counters[COUNTER_COUNT]{};
+            std::atomic<std::uint64_t> histograms[HISTOGRAM_COUNT][BUCKETS + 2]{};  ///< buckets, count, sum
+            std::uint32_t sampleTick = 0;
+
+            static void bump(std::atomic<std::uint64_t>& a, const std::uint64_t n) {
+                a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            }
+        };
+
+        struct Registry {
+            std::atomic<bool> enabled{false};
+            std::mutex mutex;
+            std::vector<std::unique_ptr<Shard>> shards;  ///< never freed; exited threads' shards are reused
+            std::vector<Shard*> idle;
+            std::atomic<std::uint64_t> gauges[GAUGE_COUNT]{};
+            Snapshot baseline;                            ///< subtracted by snapshot() after reset()
+
+            static Registry& instance() {
+                static Registry registry;
+                return registry;
+            }
+
+            Shard* acquire() {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!idle.empty()) {
+                    Shard* s = idle.back();
+                    idle.pop_back();
+                    return s;
+                }
+                shards.push_back(std::make_unique<Shard>());
+                return shards.back().get();
+            }
+
+            void release(Shard* s) {
+                std::lock_guard<std::mutex> lock(mutex);
+                idle.push_back(s);
+            }
+        };
+
+        struct ShardHandle {
+            Shard* shard = nullptr;
+            ~ShardHandle() {
+                if (shard) Registry::instance().release(shard);
+            }
+        };
+
+        inline Shard* threadShard() {
+            thread_local ShardHandle handle;  // returns the shard when the thread exits
+            if (!handle.shard) handle.shard = Registry::instance().acquire();
+            return handle.shard;
+        }
+
+        // The plain pointer needs no TLS destructor check on the recording path
+        inline Shard& localShard() {
+            thread_local Shard* shard = nullptr;
+            if (!shard) [[unlikely]] shard = threadShard();
+            return *shard;
+        }
+
+        inline void startFromEnvironment();
+
+        inline bool initialEnabled() {
+            const char* env = std::getenv("GASMITH_METRICS");
+            if (!env) return false;
+            const std::string_view v(env);
+            return v == "on" || v == "1" || v == "shm";
+        }
+
+        inline std::atomic<bool>& enabledFlag() {
+            static std::atomic<bool>& flag = [] () -> std::atomic<bool>& {
+                auto& r = Registry::instance();
+                r.enabled.store(initialEnabled(), std::memory_order_relaxed);
+                startFromEnvironment();
+                return r.enabled;
+            }();
+            return flag;
+        }
+
+    } // namespace detail
+
+    /// True if metrics are being recorded.
+    inline bool enabled() {
+        return detail::enabledFlag().load(std::memory_order_relaxed);
+    }
+
+    /// Turn recording on or off at runtime; recorded values are kept.
+    inline void setEnabled(const bool on) {
+        detail::enabledFlag().store(on, std::memory_order_relaxed);
+    }
+
+    inline void add(const Counter c, const std::uint64_t n = 1) {
+        if (!enabled()) return;
+        detail::Shard::bump(detail::localShard().counters[static_cast<int>(c)], n);
+    }
+
+    inline void record(const Histogram h, const std::uint64_t value) {
+        if (!enabled()) return;
+        auto& row = detail::localShard().histograms[static_cast<int>(h)];
+        detail::Shard::bump(row[detail::bucketOf(value)], 1);
+        detail::Shard::bump(row[BUCKETS], 1);
+        detail::Shard::bump(row[BUCKETS + 1], value);
+    }
+
+    /// Raise a high-water mark; a relaxed load when the value is not a new peak.
+    inline void peak(const Gauge g, const std::uint64_t value) {
+        if (!enabled()) return;
+        auto& a = detail::Registry::instance().gauges[static_cast<int>(g)];
+        std::uint64_t cur = a.load(std::memory_order_relaxed);
+        while (value > cur && !a.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Count a product call for `op` on `kernel` (ga::autotune::Kernel index)
+     *        and decide whether to time it.
+     *
+     * Returns true for one call in SAMPLE_PERIOD per thread; the caller then
+     * reports the elapsed time with sampledProduct().
+     */
+    inline bool countProduct(const int kernel, const Op op = Op::Filtered) {
+        if (!enabled()) return false;
+        detail::Shard& s = detail::localShard();
+        detail::Shard::bump(s.counters[static_cast<int>(Counter::Products)], 1);
+        detail::Shard::bump(s.counters[static_cast<int>(Counter::ProductsDense) + kernel], 1);
+        detail::Shard::bump(s.counters[static_cast<int>(Counter::ProductsGeometric) + static_cast<int>(op)], 1);
+        return ++s.sampleTick % SAMPLE_PERIOD == 0;
+    }
+
+    inline void sampledProduct(const int kernel, const std::uint64_t nanos) {
+        record(static_cast<Histogram>(static_cast<int>(Histogram::ProductNanosDense) + kernel), nanos);
+    }
+
+    /// Merge every thread's shard (counters and histograms summed, gauges are process-wide peaks).
+    inline Snapshot snapshot() {
+        auto& r = detail::Registry::instance();
+        Snapshot s;
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& shard : r.shards) {
+            for (int c = 0; c < COUNTER_COUNT; ++c) s.counters[c] += shard->counters[c].load(std::memory_order_relaxed);
+            for (int h = 0; h < HISTOGRAM_COUNT; ++h) {
+                for (int b = 0; b < BUCKETS; ++b) {
+                    s.histograms[h].buckets[b] += shard->histograms[h][b].load(std::memory_order_relaxed);
+                }
+                s.histograms[h].count += shard->histograms[h][BUCKETS].load(std::memory_order_relaxed);
+                s.histograms[h].sum += shard->histograms[h][BUCKETS + 1].load(std::memory_order_relaxed);
+            }
+        }
+        for (int c = 0; c < COUNTER_COUNT; ++c) s.counters[c] -= r.baseline.counters[c];
+        for (int h = 0; h < HISTOGRAM_COUNT; ++h) {
+            for (int b = 0; b < BUCKETS; ++b) s.histograms[h].buckets[b] -= r.baseline.histograms[h].buckets[b];
+            s.histograms[h].count -= r.baseline.histograms[h].count;
+            s.histograms[h].sum -= r.baseline.histograms[h].sum;
+        }
+        for (int g = 0; g < GAUGE_COUNT; ++g) s.gauges[g] = r.gauges[g].load(std::memory_order_relaxed);
+        return s;
+    }
+
+    /// Start counting from zero. Shards are owned by their threads, so this records a baseline.
+    inline void reset() {
+        const Snapshot current = snapshot();
+        auto& r = detail::Registry::instance();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (int c = 0; c < COUNTER_COUNT; ++c) r.baseline.counters[c] += current.counters[c];
+        for (int h = 0; h < HISTOGRAM_COUNT; ++h) {
+            for (int b = 0; b < BUCKETS; ++b) r.baseline.histograms[h].buckets[b] += current.histograms[h].buckets[b];
+            r.baseline.histograms[h].count += current.histograms[h].count;
+            r.baseline.histograms[h].sum += current.histograms[h].sum;
+        }
+        for (auto& g : r.gauges) g.store(0, std::memory_order_relaxed);
+    }
+
+    /// Text exposition, one "gasmith_<name> <value>" line per series (Prometheus style).
+    inline std::string format(const Snapshot& s) {
+        std::string out;
+        for (int c = 0; c < COUNTER_COUNT; ++c) {
+            out += std::string("gasmith_") + name(static_cast<Counter>(c)) + " " + std::to_string(s.counters[c]) + "\n";
+        }
+        for (int g = 0; g < GAUGE_COUNT; ++g) {
+            out += std::string("gasmith_") + name(static_cast<Gauge>(g)) + " " + std::to_string(s.gauges[g]) + "\n";
+        }
+        for (int h = 0; h < HISTOGRAM_COUNT; ++h) {
+            const HistogramData& d = s.histograms[h];
+            const std::string base = std::string("gasmith_") + name(static_cast<Histogram>(h));
+            std::uint64_t cumulative = 0;
+            for (int b = 0; b < BUCKETS; ++b) {
+                cumulative += d.buckets[b];
+                if (d.buckets[b] == 0) continue;
+                const std::uint64_t le = b == 0 ? 0 : (std::uint64_t{1} << b) - 1;
+                out += base + "_bucket{le=\"" + std::to_string(le) + "\"} " + std::to_string(cumulative) + "\n";
+            }
+            out += base + "_count " + std::to_string(d.count) + "\n";
+            out += base + "_sum " + std::to_string(d.sum) + "\n";
+        }
+        return out;
+    }
+
+    // -------------------------------------------------------------------------
+    // Shared-memory export
+    // -------------------------------------------------------------------------
+
+    /// Default segment name for this process: "/gasmith.<pid>".
+    inline std::string sharedName() {
+#if GASMITH_METRICS_SHM
+        return "/gasmith." + std::to_string(static_cast<long>(::getpid()));
+#else
+        return {};
+#endif
+    }
+
+    namespace detail {
+
+        class Exporter {
+        public:
+            static Exporter& instance() {
+                static Exporter exporter;
+                return exporter;
+            }
+
+            ~Exporter() { stop(); }
+
+            bool start(const std::string& name, const std::chrono::milliseconds interval) {
+#if GASMITH_METRICS_SHM
+                stop();
+                std::lock_guard<std::mutex> lock(mutex_);
+                const int fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+                if (fd < 0) return false;
+                if (::ftruncate(fd, sizeof(SharedBlock)) != 0) {
+                    ::close(fd);
+                    ::shm_unlink(name.c_str());
+                    return false;
+                }
+                void* p = ::mmap(nullptr, sizeof(SharedBlock), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (p == MAP_FAILED) {
+                    ::shm_unlink(name.c_str());
+                    return false;
+                }
+                block_ = static_cast<SharedBlock*>(p);
+                std::memcpy(block_->magic, SharedBlock::MAGIC, sizeof(block_->magic));
+                block_->size = sizeof(SharedBlock);
+                block_->pid = static_cast<std::uint32_t>(::getpid());
+                name_ = name;
+                publishLocked();
+
+                stopping_ = false;
+                thread_ = std::thread([this, interval] {
+                    std::unique_lock<std::mutex> lk(mutex_);
+                    while (!wake_.wait_for(lk, interval, [this] { return stopping_; })) publishLocked();
+                });
+                return true;
+#else
+                (void)name;
+                (void)interval;
+                return false;
+#endif
+            }
+
+            void stop() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stopping_ = true;
+                }
+                wake_.notify_all();
+                if (thread_.joinable()) thread_.join();
+#if GASMITH_METRICS_SHM
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (block_) {
+                    ::munmap(block_, sizeof(SharedBlock));
+                    ::shm_unlink(name_.c_str());
+                    block_ = nullptr;
+                }
+#endif
+            }
+
+            bool publish() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!block_) return false;
+                publishLocked();
+                return true;
+            }
+
+        private:
+            std::mutex mutex_;
+            std::condition_variable wake_;
+            std::thread thread_;
+            bool stopping_ = false;
+            SharedBlock* block_ = nullptr;
+            std::string name_;
+
+            // Sequence lock: odd while writing, readers retry on a change
+            void publishLocked() {
+                const Snapshot s = snapshot();
+                const std::uint64_t seq = block_->sequence.load(std::memory_order_relaxed);
+                block_->sequence.store(seq + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                block_->publishedNanos = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count());
+                std::memcpy(static_cast<void*>(&block_->snapshot), &s, sizeof(Snapshot));
+                block_->sequence.store(seq + 2, std::memory_order_release);
+            }
+        };
+
+        inline void startFromEnvironment() {
+            const char* env = std::getenv("GASMITH_METRICS");
+            if (env && std::string_view(env) == "shm") {
+                Exporter::instance().start(sharedName(), std::chrono::milliseconds(100));
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Publish snapshots to the shared-memory segment `name` every `interval`.
+     *
+     * Replaces any running export. The segment is unlinked by stopSharedExport()
+     * or at process exit. Returns false if shared memory is unavailable.
+     */
+    inline bool startSharedExport(const std::string& name = sharedName(),
+                                  const std::chrono::milliseconds interval = std::chrono::milliseconds(100)) {
+        return detail::Exporter::instance().start(name, interval);
+    }
+
+    inline void stopSharedExport() {
+        detail::Exporter::instance().stop();
+    }
+
+    /// Publish a snapshot now (outside the periodic schedule). False if no export is running.
+    inline bool publishShared() {
+        return detail::Exporter::instance().publish();
+    }
+
+    /**
+     * @brief Read a consistent snapshot from another (or this) process's segment.
+     *
+     * Never blocks the writer: retries while a publish is in progress. Returns
+     * false if the segment does not exist or has a different layout.
+     */
+    inline bool readShared(const std::string& name, Snapshot& out, std::uint32_t* pid = nullptr) {
+#if GASMITH_METRICS_SHM
+        const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) return false;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(SharedBlock)) {
+            ::close(fd);
+            return false;
+        }
+        void* p = ::mmap(nullptr, sizeof(SharedBlock), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        const auto* block = static_cast<const SharedBlock*>(p);
+
+        bool ok = std::memcmp(block->magic, SharedBlock::MAGIC, sizeof(block->magic)) == 0 &&
+                  block->size == sizeof(SharedBlock);
+        for (int attempt = 0; ok && attempt < 1000; ++attempt) {
+            const std::uint64_t s1 = block->sequence.load(std::memory_order_acquire);
+            if (s1 & 1u) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::memcpy(&out, &block->snapshot, sizeof(Snapshot));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (block->sequence.load(std::memory_order_relaxed) == s1) {
+                if (pid) *pid = block->pid;
+                ::munmap(p, sizeof(SharedBlock));
+                return true;
+            }
+        }
+        ::munmap(p, sizeof(SharedBlock));
+        return false;
+#else
+        (void)name;
+        (void)out;
+        (void)pid;
+        return false;
+#endif
+    }
+
+    /// RAII timer for a product call chosen by countProduct().
+    class ProductTimer {
+    public:
+        ProductTimer(const int kernel, const bool sampled)
+            : kernel_(kernel), start_(sampled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}),
+              sampled_(sampled) {}
+
+        ~ProductTimer() {
+            if (sampled_) {
+                sampledProduct(kernel_, static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count()));
+            }
+        }
+
+        ProductTimer(const ProductTimer&) = delete;
+        ProductTimer& operator=(const ProductTimer&) = delete;
+
+    private:
+        int kernel_;
+        std::chrono::steady_clock::time_point start_;
+        bool sampled_;
+    };
+
+} // namespace ga::metrics
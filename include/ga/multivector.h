@@ -1,4 +1,5 @@
 #pragma once
+#include <stdexcept>
 #include "storageDense.h"
 #include "algebra.h"
 #include "basis.h"
@@ -20,15 +21,15 @@ namespace ga {
         const Algebra* alg;     // pointer to algebra descriptor
         DenseStorage storage;   // coefficients indexed by mask
 
-        explicit Multivector(const Algebra& a)
+        constexpr explicit Multivector(const Algebra& a)
             : alg(&a), storage(a.dimensions) {}
 
-        [[nodiscard]] double component(const BladeMask m) const { return storage[m]; }
-        void setComponent(const BladeMask m, const double value) { storage[m] = value; }
+        [[nodiscard]] constexpr double component(const BladeMask m) const { return storage[m]; }
+        constexpr void setComponent(const BladeMask m, const double value) { storage[m] = value; }
 
     };
 
-    inline Multivector operator+(const Multivector& A, const Multivector& B) {
+    constexpr Multivector operator+(const Multivector& A, const Multivector& B) {
         if (!A.alg || !B.alg || A.alg != B.alg) {
             throw std::invalid_argument("ga::operator+: operands must share the same Algebra");
         }
@@ -45,7 +46,7 @@ namespace ga {
         return result;
     }
 
-    inline Multivector operator-(const Multivector& A, const Multivector& B) {
+    constexpr Multivector operator-(const Multivector& A, const Multivector& B) {
         if (!A.alg || !B.alg || A.alg != B.alg) {
             throw std::invalid_argument("ga::operator+: operands must share the same Algebra");
         }
@@ -62,7 +63,7 @@ namespace ga {
         return result;
     }
 
-    inline Multivector operator*(const float f, const Multivector& A) {
+    constexpr Multivector operator*(const float f, const Multivector& A) {
         if (!A.alg) {
             throw std::invalid_argument("ga::operator+: multivector has no Algebra");
         }
@@ -79,7 +80,7 @@ namespace ga {
         return result;
     }
 
-    inline Multivector operator*(const Multivector& A, const float f) {
+    constexpr Multivector operator*(const Multivector& A, const float f) {
         return f * A;
     }
 
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/cliffordMatrix.h"
+#include "ga/parallel.h"
+#include "ga/tables.h"
+
+// Inference kernels for Clifford / geometric-algebra neural network layers.
+//
+// Activations are CliffordMatrix values with one row per sample and one column
+// per channel, so every blade of every channel is a contiguous real matrix:
+//
+//   X.at(sample, channel, mask)
+//
+// Layers:
+//   linear       Y = X W + b with multivector weights (one blocked GEMM per Cayley term)
+//   gradeLinear  Y_k = X_k W_k with one real weight matrix per grade; equivariant
+//   product      elementwise geometric product of two activations
+//   gate         grade-wise gated nonlinearity
+//   normalize    divide each sample by its RMS multivector norm over channels
+//
+// Every kernel is a single pass over tiles of the output, with the tiles
+// spread across threads with ga::parallel. The grade-wise kernels use the
+// coefficient norm sum_B x_B^2 over a grade. That norm is invariant under
+// Spin(p) x Spin(q), which is the whole rotor group for Euclidean signatures.
+
+namespace ga::nn {
+
+    using ga::Algebra;
+    using ga::BladeMask;
+    using ga::CliffordMatrix;
+
+    /// One real in x out matrix per grade 0..dims, row-major: w[(k * in + i) * out + o]
+    struct GradeWeights {
+        int grades = 0;
+        std::size_t in = 0, out = 0;
+        std::vector<float> w;
+
+        GradeWeights() = default;
+        GradeWeights(const Algebra& alg, const std::size_t i, const std::size_t o)
+            : grades(alg.dimensions + 1), in(i), out(o), w(static_cast<std::size_t>(grades) * i * o, 0.0f) {}
+
+        [[nodiscard]] float* grade(const int k) { return w.data() + static_cast<std::size_t>(k) * in * out; }
+        [[nodiscard]] const float* grade(const int k) const { return w.data() + static_cast<std::size_t>(k) * in * out; }
+    };
+
+    /// Per channel and grade: gate = sigmoid(scale * q + shift), q = x_0 for grade 0 and |x_k| above
+    struct GateParams {
+        int grades = 0;
+        std::size_t channels = 0;
+        std::vector<float> scale, shift;  ///< scale[c * grades + k]
+
+        GateParams() = default;
+        GateParams(const Algebra& alg, const std::size_t c)
+            : grades(alg.dimensions + 1), channels(c),
+              scale(static_cast<std::size_t>(grades) * c, 1.0f), shift(static_cast<std::size_t>(grades) * c, 0.0f) {}
+    };
+
+    namespace detail {
+
+        // Elements per tile of the elementwise kernels
+        inline constexpr std::size_t TILE = 256;
+
+        inline void requireSame(const CliffordMatrix& X, const CliffordMatrix& Y, const char* fn) {
+            if (!X.alg || Y.alg != X.alg) {
+                throw std::invalid_argument(std::string("ga::nn::") + fn + ": Algebra mismatch or null");
+            }
+            if (Y.rows != X.rows || Y.cols != X.cols) {
+                throw std::invalid_argument(std::string("ga::nn::") + fn + ": activation shapes differ");
+            }
+        }
+
+        // Blades of each grade
+        inline std::vector<std::vector<BladeMask>> bladesByGrade(const Algebra& alg) {
+            std::vector<std::vector<BladeMask>> out(static_cast<std::size_t>(alg.dimensions) + 1);
+            const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+            for (std::size_t m = 0; m < N; ++m) out[Blade::getGrade(static_cast<BladeMask>(m))].push_back(static_cast<BladeMask>(m));
+            return out;
+        }
+
+        inline float sigmoid(const float x) { return 1.0f / (1.0f + std::exp(-x)); }
+
+    } // namespace detail
+
+    /**
+     * @brief Y = X W + bias with multivector weights: Y[s, o] = sum_i X[s, i] W[i, o] + bias[0, o].
+     *
+     * W is in x out; bias is 1 x out or nullptr. Y must be X.rows x W.cols and
+     * must not alias X or W.
+     */
+    inline void linear(const CliffordMatrix& X, const CliffordMatrix& W, const CliffordMatrix* bias, CliffordMatrix& Y) {
+        if (bias) {
+            // Validate everything multiply() checks before Y is overwritten with the bias
+            if (!X.alg || W.alg != X.alg || X.cols != W.rows) {
+                throw std::invalid_argument("ga::nn::linear: input and weights do not match");
+            }
+            if (bias->alg != W.alg || bias->rows != 1 || bias->cols != W.cols) {
+                throw std::invalid_argument("ga::nn::linear: bias must be a 1 x out matrix of the weights' Algebra");
+            }
+            if (Y.alg != W.alg || Y.rows != X.rows || Y.cols != W.cols || &Y == &X || &Y == &W) {
+                throw std::invalid_argument("ga::nn::linear: output does not match the input and weights");
+            }
+            // Broadcast the bias, then accumulate the product on top of it
+            const std::size_t N = Y.bladeCount();
+            for (std::size_t m = 0; m < N; ++m) {
+                const float* b = bias->blade(static_cast<BladeMask>(m));
+                float* y = Y.blade(static_cast<BladeMask>(m));
+                for (std::size_t r = 0; r < Y.rows; ++r) std::copy(b, b + Y.cols, y + r * Y.cols);
+            }
+        }
+        multiply(X, W, Y, bias != nullptr);
+    }
+
+    /**
+     * @brief Grade-wise linear map Y_k[s, o] = sum_i X_k[s, i] W_k[i, o].
+     *
+     * Each blade of grade k is one real GEMM with the grade's weights, so the
+     * layer commutes with rotors. Y must be X.rows x W.out and must not alias X.
+     */
+    inline void gradeLinear(const CliffordMatrix& X, const GradeWeights& W, CliffordMatrix& Y) {
+        if (!X.alg || Y.alg != X.alg || W.grades != X.alg->dimensions + 1) {
+            throw std::invalid_argument("ga::nn::gradeLinear: Algebra mismatch or null");
+        }
+        if (W.in != X.cols || Y.rows != X.rows || Y.cols != W.out) {
+            throw std::invalid_argument("ga::nn::gradeLinear: shapes do not match");
+        }
+        if (&Y == &X) {
+            throw std::invalid_argument("ga::nn::gradeLinear: output aliases input");
+        }
+        const std::size_t N = X.bladeCount(), S = X.rows, K = X.cols, O = W.out;
+        std::fill(Y.data.begin(), Y.data.end(), 0.0f);
+        if (S == 0 || K == 0 || O == 0) return;
+
+        const std::size_t rowTiles = (S + ga::detail::GEMM_MC - 1) / ga::detail::GEMM_MC;
+        ga::parallel::parallelFor(rowTiles * N, 1, [&](const std::size_t t0, const std::size_t t1) {
+            for (std::size_t t = t0; t < t1; ++t) {
+                const auto mask = static_cast<BladeMask>(t / rowTiles);
+                const std::size_t i0 = (t % rowTiles) * ga::detail::GEMM_MC;
+                const std::size_t mc = std::min(ga::detail::GEMM_MC, S - i0);
+                const float* w = W.grade(Blade::getGrade(mask));
+                for (std::size_t j0 = 0; j0 < O; j0 += ga::detail::GEMM_NC) {
+                    const std::size_t nc = std::min(ga::detail::GEMM_NC, O - j0);
+                    for (std::size_t k0 = 0; k0 < K; k0 += ga::detail::GEMM_KC) {
+                        const std::size_t kc = std::min(ga::detail::GEMM_KC, K - k0);
+                        ga::detail::gemmBlock(Y.blade(mask) + i0 * O + j0, O, X.blade(mask) + i0 * K + k0, K,
+                                              w + k0 * O + j0, O, 1.0f, mc, kc, nc);
+                    }
+                }
+            }
+        });
+    }
+
+    /// Elementwise geometric product Y[s, c] = A[s, c] B[s, c]. Y may alias A or B.
+    inline void product(const CliffordMatrix& A, const CliffordMatrix& B, CliffordMatrix& Y) {
+        detail::requireSame(A, B, "product");
+        detail::requireSame(A, Y, "product");
+        const ProductTables& t = productTables(*A.alg);
+        const std::size_t N = t.bladeCount(), n = A.entries();
+        const std::size_t tiles = (n + detail::TILE - 1) / detail::TILE;
+
+        ga::parallel::parallelFor(tiles, 4, [&](const std::size_t t0, const std::size_t t1) {
+            std::vector<float> acc(N * detail::TILE);
+            for (std::size_t tile = t0; tile < t1; ++tile) {
+                const std::size_t base = tile * detail::TILE;
+                const std::size_t len = std::min(detail::TILE, n - base);
+                for (std::size_t r = 0; r < N; ++r) {
+                    float* y = &acc[r * detail::TILE];
+                    std::fill(y, y + len, 0.0f);
+                    for (std::uint32_t k = t.offsets[r]; k < t.offsets[r + 1]; ++k) {
+                        const BladeMask a = t.left[k];
+                        const auto b = static_cast<BladeMask>(a ^ r);
+                        const float s = static_cast<float>(t.productSign(a, b));
+                        const float* x = A.blade(a) + base;
+                        const float* z = B.blade(b) + base;
+                        for (std::size_t i = 0; i < len; ++i) y[i] += s * x[i] * z[i];
+                    }
+                }
+                // Write back after the whole tile is computed so in-place use is safe
+                for (std::size_t r = 0; r < N; ++r) {
+                    std::copy(&acc[r * detail::TILE], &acc[r * detail::TILE] + len, Y.blade(static_cast<BladeMask>(r)) + base);
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Grade-wise gated nonlinearity: Y_k = X_k sigmoid(scale * q_k + shift).
+     *
+     * q_0 is the scalar itself (so grade 0 is SiLU with the default parameters)
+     * and q_k = |X_k| for k >= 1. params is per channel and grade, or nullptr
+     * for scale 1, shift 0. Y may alias X.
+     */
+    inline void gate(const CliffordMatrix& X, CliffordMatrix& Y, const GateParams* params = nullptr) {
+        detail::requireSame(X, Y, "gate");
+        const int G = X.alg->dimensions + 1;
+        if (params && (params->grades != G || params->channels != X.cols)) {
+            throw std::invalid_argument("ga::nn::gate: parameters do not match the channels or Algebra");
+        }
+        const std::vector<std::vector<BladeMask>> byGrade = detail::bladesByGrade(*X.alg);
+        const std::size_t n = X.entries(), C = X.cols;
+        const std::size_t tiles = (n + detail::TILE - 1) / detail::TILE;
+
+        ga::parallel::parallelFor(tiles, 4, [&](const std::size_t t0, const std::size_t t1) {
+            float g[detail::TILE];
+            for (std::size_t tile = t0; tile < t1; ++tile) {
+                const std::size_t base = tile * detail::TILE;
+                const std::size_t len = std::min(detail::TILE, n - base);
+                for (int k = 0; k < G; ++k) {
+                    const std::vector<BladeMask>& blades = byGrade[k];
+                    if (k == 0) {
+                        std::copy(X.blade(0) + base, X.blade(0) + base + len, g);
+                    } else {
+                        std::fill(g, g + len, 0.0f);
+                        for (const BladeMask m : blades) {
+                            const float* x = X.blade(m) + base;
+                            for (std::size_t i = 0; i < len; ++i) g[i] += x[i] * x[i];
+                        }
+                        for (std::size_t i = 0; i < len; ++i) g[i] = std::sqrt(g[i]);
+                    }
+                    if (params) {
+                        for (std::size_t i = 0; i < len; ++i) {
+                            const std::size_t at = ((base + i) % C) * static_cast<std::size_t>(G) + static_cast<std::size_t>(k);
+                            g[i] = params->scale[at] * g[i] + params->shift[at];
+                        }
+                    }
+                    for (std::size_t i = 0; i < len; ++i) g[i] = detail::sigmoid(g[i]);
+                    // Grade k's gate depends only on grade k, so its blades can be rewritten now
+                    for (const BladeMask m : blades) {
+                        const float* x = X.blade(m) + base;
+                        float* y = Y.blade(m) + base;
+                        for (std::size_t i = 0; i < len; ++i) y[i] = x[i] * g[i];
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Y[s, c] = gain[c] X[s, c] / sqrt(mean_c |X[s, c]|^2 + eps).
+     *
+     * |X|^2 is the coefficient norm summed over all blades. gain is per channel
+     * or nullptr for 1. Y may alias X.
+     */
+    inline void normalize(const CliffordMatrix& X, CliffordMatrix& Y, const float* gain = nullptr, const float eps = 1e-6f) {
+        detail::requireSame(X, Y, "normalize");
+        const std::size_t N = X.bladeCount(), S = X.rows, C = X.cols;
+        if (C == 0) return;
+        const std::size_t grain = std::max<std::size_t>(1, detail::TILE / C);
+
+        ga::parallel::parallelFor(S, grain, [&](const std::size_t r0, const std::size_t r1) {
+            for (std::size_t r = r0; r < r1; ++r) {
+                float sum = 0.0f;
+                for (std::size_t m = 0; m < N; ++m) {
+                    const float* x = X.blade(static_cast<BladeMask>(m)) + r * C;
+                    for (std::size_t c = 0; c < C; ++c) sum += x[c] * x[c];
+                }
+                const float inv = 1.0f / std::sqrt(sum / static_cast<float>(C) + eps);
+                for (std::size_t m = 0; m < N; ++m) {
+                    const float* x = X.blade(static_cast<BladeMask>(m)) + r * C;
+                    float* y = Y.blade(static_cast<BladeMask>(m)) + r * C;
+                    if (gain) {
+                        for (std::size_t c = 0; c < C; ++c) y[c] = gain[c] * inv * x[c];
+                    } else {
+                        for (std::size_t c = 0; c < C; ++c) y[c] = inv * x[c];
+                    }
+                }
+            }
+        });
+    }
+
+} // namespace ga::nn
@@ -13,9 +13,10 @@ namespace ga::ops {
     // Uses bitmask operations to compute:
     //   - sign from the relative ordering of basis vectors
     //   - metric contraction on overlapping axes via Signature::getSign(i)
-    inline Blade geometricProductBlade(const Blade& a,
-                                       const Blade& b,
-                                       const Signature& sig)
+    // constexpr so compile-time term tables (ga/graded.h) can be built from it.
+    constexpr Blade geometricProductBlade(const Blade& a,
+                                          const Blade& b,
+                                          const Signature& sig)
     {
         // Zero handling: if either is zero, result is zero
         if (Blade::isZero(a) || Blade::isZero(b)) {
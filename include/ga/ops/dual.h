@@ -11,7 +11,7 @@ namespace ga::ops {
     using ga::Blade;
 
     // Hodge dual: maps each blade to its complement blade (up to sign), using the pseudoscalar mask I_mask = (1<<dims) - 1 and geometricProductBlade
-    inline Multivector dual(const Multivector& A) {
+    constexpr Multivector dual(const Multivector& A) {
         const Algebra* alg = A.alg;
         if (!alg) {
             return A;
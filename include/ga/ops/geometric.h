@@ -1,10 +1,14 @@
 #pragma once
 
 #include <stdexcept>
+#include <type_traits>
 
 #include "blade.h"
 #include "ga/algebra.h"
 #include "ga/multivector.h"
+#include "ga/autotune.h"
+#include "ga/metrics.h"
+#include "ga/ops/kernels.h"
 
 // Implements a full clifford product of two n-dimensional generalized multivectors.
 // Multivecors must share a metric
@@ -16,71 +20,40 @@ namespace ga::ops {
     using ga::Multivector;
     using ga::Blade;
 
-    // A runtime callback type: decides whether a given (gradeA, gradeB, gradeR) term from the geometric product should be kept.
-    using GradeFilterFn = bool (*)(int gradeA, int gradeB, int gradeR);
+    namespace detail {
 
-    // Do full geometric product, keep only terms where keep(gradeA, gradeB, gradeR) == true.
-    inline Multivector geometricProductFiltered(const Multivector& A,
-                                           const Multivector& B,
-                                           const GradeFilterFn keep) {
-        const Algebra *alg = A.alg;
-
-        if (!alg || !B.alg || alg != B.alg) {
-            throw std::invalid_argument(
-                    "ga::ops::geometricProductFiltered: Multivectors must share the same Algebra");
+        // Runtime product with ga::metrics counting and sampled timing
+        inline Multivector meteredProduct(const ProductKernel fn, const Multivector& A, const Multivector& B,
+                                          const GradeFilterFn keep, const ga::metrics::Op op) {
+            const int kernel = static_cast<int>(ga::autotune::kernelOf(fn));
+            const ga::metrics::ProductTimer timer(kernel, ga::metrics::countProduct(kernel, op));
+            return fn(A, B, keep);
         }
 
-        const int dims = alg->dimensions;
-        const int bladeCount = 1 << dims;
-
-        Multivector result(*alg);
-
-        // Pre-compute grades if filtering is enabled
-        const bool useFilter = (keep != nullptr);
-
-        for (int i = 0; i < bladeCount; ++i) {
-            const auto maskA = static_cast<BladeMask>(i);
-            const double coeffA = A.component(maskA);
-            if (coeffA == 0.0)
-                continue;
-
-            const int gradeA = useFilter ? ga::Blade::getGrade(maskA) : 0;
-
-            for (int j = 0; j < bladeCount; ++j) {
-                const auto maskB = static_cast<BladeMask>(j);
-                const double coeffB = B.component(maskB);
-                if (coeffB == 0.0)
-                    continue;
+    } // namespace detail
 
-                const int gradeB = useFilter ? ga::Blade::getGrade(maskB) : 0;
-
-                const Blade gp = geometricProductBlade(
-                        Blade{maskA, +1},
-                        Blade{maskB, +1},
-                        alg->signature
-                );
-
-                if (Blade::isZero(gp))
-                    continue;
-
-                if (useFilter) {
-                    const int gradeR = ga::Blade::getGrade(gp.mask);
-                    if (!keep(gradeA, gradeB, gradeR))
-                        continue;
-                }
-
-                const double contrib = coeffA * coeffB * static_cast<double>(gp.sign);
-                result.setComponent(gp.mask, result.component(gp.mask) + contrib);
-            }
+    // Do full geometric product, keep only terms where keep(gradeA, gradeB, gradeR) == true.
+    // At runtime this calls the kernel ga::autotune selected for the algebra; all kernels give identical results.
+    // `op` only labels the call for ga::metrics' per-operation counters.
+    constexpr Multivector geometricProductFiltered(const Multivector& A,
+                                           const Multivector& B,
+                                           const GradeFilterFn keep,
+                                           const ga::metrics::Op op = ga::metrics::Op::Filtered) {
+        if (std::is_constant_evaluated()) {
+            return productDense(A, B, keep);
         }
-
-        return result;
+        detail::requireSameAlgebra(A, B);
+        const ProductKernel fn = ga::autotune::kernelFor(*A.alg);
+        if (ga::metrics::enabled()) {
+            return detail::meteredProduct(fn, A, B, keep, op);
+        }
+        return fn(A, B, keep);
     }
 
 
         // Just pass null so no filter, return full product.
-        inline Multivector geometricProduct(const Multivector& A, const Multivector& B) {
-            return geometricProductFiltered(A, B, nullptr);
+        constexpr Multivector geometricProduct(const Multivector& A, const Multivector& B) {
+            return geometricProductFiltered(A, B, nullptr, ga::metrics::Op::Geometric);
         }
 
 }
@@ -2,6 +2,7 @@
 
 #include <cstdlib>    // std::abs
 #include "ga/multivector.h"
+#include "ga/ops/geometric.h"
 
 namespace ga::ops {
 
@@ -9,14 +10,14 @@ namespace ga::ops {
 
     // ---------------- Hestenes inner product filter ---------------------------
     // keep gradeR == |gradeA - gradeB|
-    inline bool keepInnerGrade(const int gradeA, const int gradeB, const int gradeR) {
-        const int diff = std::abs(gradeA - gradeB);
+    constexpr bool keepInnerGrade(const int gradeA, const int gradeB, const int gradeR) {
+        const int diff = gradeA > gradeB ? gradeA - gradeB : gradeB - gradeA;  // std::abs is not constexpr in C++20
         return gradeR == diff;
     }
 
     // ---------------- Left contraction filter ---------------------------------
     // keep gradeR == (gradeB - gradeA) if gradeA <= gradeB
-    inline bool keepLeftContractionGrade(const int gradeA, const int gradeB, const int gradeR) {
+    constexpr bool keepLeftContractionGrade(const int gradeA, const int gradeB, const int gradeR) {
         if (gradeA > gradeB)
             return false;
         const int expected = gradeB - gradeA;
@@ -25,7 +26,7 @@ namespace ga::ops {
 
     // ---------------- Right contraction filter --------------------------------
     // keep gradeR == (gradeA - gradeB) if gradeA >= gradeB
-    inline bool keepRightContractionGrade(const int gradeA, const int gradeB, const int gradeR) {
+    constexpr bool keepRightContractionGrade(const int gradeA, const int gradeB, const int gradeR) {
         if (gradeA < gradeB)
             return false;
         const int expected = gradeA - gradeB;
@@ -35,22 +36,22 @@ namespace ga::ops {
     // --------------------------------------------------------------------------
     //  Hestenes inner product: A ⋅ B
     // --------------------------------------------------------------------------
-    inline Multivector inner(const Multivector& A, const Multivector& B) {
-        return ga::ops::geometricProductFiltered(A, B, &keepInnerGrade);
+    constexpr Multivector inner(const Multivector& A, const Multivector& B) {
+        return ga::ops::geometricProductFiltered(A, B, &keepInnerGrade, ga::metrics::Op::Inner);
     }
 
     // --------------------------------------------------------------------------
     //  Left contraction: A ⟍ B
     // --------------------------------------------------------------------------
-    inline Multivector leftContraction(const Multivector& A, const Multivector& B) {
-        return ga::ops::geometricProductFiltered(A, B, &keepLeftContractionGrade);
+    constexpr Multivector leftContraction(const Multivector& A, const Multivector& B) {
+        return ga::ops::geometricProductFiltered(A, B, &keepLeftContractionGrade, ga::metrics::Op::LeftContraction);
     }
 
     // --------------------------------------------------------------------------
     //  Right contraction: A ⟎ B
     // --------------------------------------------------------------------------
-    inline Multivector rightContraction(const Multivector& A, const Multivector& B) {
-        return ga::ops::geometricProductFiltered(A, B, &keepRightContractionGrade);
+    constexpr Multivector rightContraction(const Multivector& A, const Multivector& B) {
+        return ga::ops::geometricProductFiltered(A, B, &keepRightContractionGrade, ga::metrics::Op::RightContraction);
     }
 
 } // namespace ga::ops
\ No newline at end of file
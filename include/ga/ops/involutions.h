@@ -13,7 +13,7 @@ namespace ga::ops {
 // -------------- Reverse (~A) --------------------------------------------
 //
 // For each basis blade of grade r: sign = (-1)^{r(r-1)/2}
-inline Multivector reverse(const Multivector& A) {
+constexpr Multivector reverse(const Multivector& A) {
     const Algebra* alg = A.alg;
     if (!alg) {
         // You can throw or assert here if you want
@@ -45,7 +45,7 @@ inline Multivector reverse(const Multivector& A) {
 // -------------- Grade involution (A^ = sum (-1)^r A_r) ------------------
 //
 // For each grade-r blade: sign = (-1)^r
-inline Multivector gradeInvolution(const Multivector& A) {
+constexpr Multivector gradeInvolution(const Multivector& A) {
     const Algebra* alg = A.alg;
     if (!alg) {
         return A;
@@ -74,7 +74,7 @@ inline Multivector gradeInvolution(const Multivector& A) {
 // -------------- Clifford conjugation (combination of both) --------------
 //
 // For each grade-r blade: sign = (-1)^{r(r+1)/2}
-inline Multivector cliffordConjugate(const Multivector& A) {
+constexpr Multivector cliffordConjugate(const Multivector& A) {
     const Algebra* alg = A.alg;
     if (!alg) {
         return A;
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+
+#include "blade.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/tables.h"
+
+// Interchangeable implementations of the (grade-filtered) geometric product.
+//
+// All kernels visit the non-zero pairs (i, j) with i as the outer and j as the
+// inner loop, both ascending, and accumulate each contribution into a float
+// output exactly like the original dense loop. They differ only in how they
+// find the sign of e_i e_j and which zero pairs they skip, so every kernel
+// returns bitwise identical results and ga::autotune can pick whichever is
+// fastest on the running machine.
+//
+//   productDense        signs from geometricProductBlade per pair (reference)
+//   productTable        signs from the precomputed ProductTables Cayley table
+//   productBitParallel  signs from popcounts of the two masks and the metric masks
+//   productSparse       gathers non-zero coefficients first, then uses the table
+
+namespace ga::ops {
+
+    using ga::Algebra;
+    using ga::Blade;
+    using ga::BladeMask;
+    using ga::Multivector;
+
+    // A runtime callback type: decides whether a given (gradeA, gradeB, gradeR) term from the geometric product should be kept.
+    using GradeFilterFn = bool (*)(int gradeA, int gradeB, int gradeR);
+
+    using ProductKernel = Multivector (*)(const Multivector& A, const Multivector& B, GradeFilterFn keep);
+
+    namespace detail {
+
+        constexpr void requireSameAlgebra(const Multivector& A, const Multivector& B) {
+            if (!A.alg || !B.alg || A.alg != B.alg) {
+                throw std::invalid_argument(
+                        "ga::ops::geometricProductFiltered: Multivectors must share the same Algebra");
+            }
+        }
+
+        // Shared accumulation step; keeps the rounding identical across kernels
+        constexpr void accumulate(Multivector& result, const BladeMask mask, const double coeffA,
+                                  const double coeffB, const int sign) {
+            const double contrib = coeffA * coeffB * static_cast<double>(sign);
+            result.setComponent(mask, result.component(mask) + contrib);
+        }
+
+    } // namespace detail
+
+    constexpr Multivector productDense(const Multivector& A, const Multivector& B, const GradeFilterFn keep) {
+        detail::requireSameAlgebra(A, B);
+        const Algebra* alg = A.alg;
+
+        const int dims = alg->dimensions;
+        const int bladeCount = 1 << dims;
+
+        Multivector result(*alg);
+
+        // Pre-compute grades if filtering is enabled
+        const bool useFilter = (keep != nullptr);
+
+        for (int i = 0; i < bladeCount; ++i) {
+            const auto maskA = static_cast<BladeMask>(i);
+            const double coeffA = A.component(maskA);
+            if (coeffA == 0.0)
+                continue;
+
+            const int gradeA = useFilter ? ga::Blade::getGrade(maskA) : 0;
+
+            for (int j = 0; j < bladeCount; ++j) {
+                const auto maskB = static_cast<BladeMask>(j);
+                const double coeffB = B.component(maskB);
+                if (coeffB == 0.0)
+                    continue;
+
+                const int gradeB = useFilter ? ga::Blade::getGrade(maskB) : 0;
+
+                const Blade gp = geometricProductBlade(
+                        Blade{maskA, +1},
+                        Blade{maskB, +1},
+                        alg->signature
+                );
+
+                if (Blade::isZero(gp))
+                    continue;
+
+                if (useFilter) {
+                    const int gradeR = ga::Blade::getGrade(gp.mask);
+                    if (!keep(gradeA, gradeB, gradeR))
+                        continue;
+                }
+
+                detail::accumulate(result, gp.mask, coeffA, coeffB, gp.sign);
+            }
+        }
+
+        return result;
+    }
+
+    inline Multivector productTable(const Multivector& A, const Multivector& B, const GradeFilterFn keep) {
+        detail::requireSameAlgebra(A, B);
+        const ProductTables& t = productTables(*A.alg);
+        const std::size_t N = t.bladeCount();
+
+        Multivector result(*A.alg);
+        for (std::size_t i = 0; i < N; ++i) {
+            const double coeffA = A.storage[i];
+            if (coeffA == 0.0)
+                continue;
+            const std::int8_t* signs = &t.sign[i * N];
+            const int gradeA = keep ? Blade::getGrade(static_cast<BladeMask>(i)) : 0;
+
+            for (std::size_t j = 0; j < N; ++j) {
+                const double coeffB = B.storage[j];
+                if (coeffB == 0.0 || signs[j] == 0)
+                    continue;
+                const auto mask = static_cast<BladeMask>(i ^ j);
+                if (keep && !keep(gradeA, Blade::getGrade(static_cast<BladeMask>(j)), Blade::getGrade(mask)))
+                    continue;
+                detail::accumulate(result, mask, coeffA, coeffB, signs[j]);
+            }
+        }
+        return result;
+    }
+
+    inline Multivector productBitParallel(const Multivector& A, const Multivector& B, const GradeFilterFn keep) {
+        detail::requireSameAlgebra(A, B);
+        const Algebra& alg = *A.alg;
+        const int dims = alg.dimensions;
+        const unsigned N = 1u << dims;
+
+        unsigned negative = 0, null = 0;
+        for (int k = 0; k < dims; ++k) {
+            const int g = alg.signature.getSign(k);
+            if (g < 0) negative |= 1u << k;
+            if (g == 0) null |= 1u << k;
+        }
+
+        Multivector result(alg);
+        for (unsigned i = 0; i < N; ++i) {
+            const double coeffA = A.storage[i];
+            if (coeffA == 0.0)
+                continue;
+            const int gradeA = keep ? std::popcount(i) : 0;
+
+            for (unsigned j = 0; j < N; ++j) {
+                const double coeffB = B.storage[j];
+                if (coeffB == 0.0)
+                    continue;
+                const unsigned overlap = i & j;
+                if (overlap & null)
+                    continue;
+                const auto mask = static_cast<BladeMask>(i ^ j);
+                if (keep && !keep(gradeA, std::popcount(j), std::popcount(static_cast<unsigned>(mask))))
+                    continue;
+
+                // Reordering: count pairs (a in i, b in j) with b < a
+                int swaps = 0;
+                for (unsigned a = i >> 1; a != 0; a >>= 1) swaps += std::popcount(a & j);
+                swaps += std::popcount(overlap & negative);
+                detail::accumulate(result, mask, coeffA, coeffB, (swaps & 1) ? -1 : +1);
+            }
+        }
+        return result;
+    }
+
+    inline Multivector productSparse(const Multivector& A, const Multivector& B, const GradeFilterFn keep) {
+        detail::requireSameAlgebra(A, B);
+        const ProductTables& t = productTables(*A.alg);
+        const std::size_t N = t.bladeCount();
+
+        BladeMask ia[256], ib[256];
+        std::size_t na = 0, nb = 0;
+        for (std::size_t k = 0; k < N; ++k) {
+            if (A.storage[k] != 0.0f) ia[na++] = static_cast<BladeMask>(k);
+            if (B.storage[k] != 0.0f) ib[nb++] = static_cast<BladeMask>(k);
+        }
+
+        Multivector result(*A.alg);
+        for (std::size_t p = 0; p < na; ++p) {
+            const BladeMask i = ia[p];
+            const double coeffA = A.storage[i];
+            const std::int8_t* signs = &t.sign[static_cast<std::size_t>(i) * N];
+            const int gradeA = keep ? Blade::getGrade(i) : 0;
+
+            for (std::size_t q = 0; q < nb; ++q) {
+                const BladeMask j = ib[q];
+                if (signs[j] == 0)
+                    continue;
+                const auto mask = static_cast<BladeMask>(i ^ j);
+                if (keep && !keep(gradeA, Blade::getGrade(j), Blade::getGrade(mask)))
+                    continue;
+                detail::accumulate(result, mask, coeffA, B.storage[j], signs[j]);
+            }
+        }
+        return result;
+    }
+
+} // namespace ga::ops
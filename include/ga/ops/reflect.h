@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "blade.h"
+#include "geometric.h"
+#include "involutions.h"
+#include "selective.h"
+#include "ga/algebra.h"
+#include "ga/batch.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/policies.h"
+#include "ga/productMatrix.h"
+
+// Reflections in mirrors.
+//
+// A mirror is an invertible blade M: a vector is a hyperplane (a plane in PGA,
+// a plane or sphere in CGA), a PGA trivector is a point, and so on. Reflecting
+// a grade-k part of X in M is
+//
+//   X_k' = (-1)^(k m) M X_k M^{-1}       (m = grade parity of M)
+//
+// i.e. the versor sandwich with a sign per grade for odd mirrors, so that a
+// vector reflected in a hyperplane is v - 2 (v.n) / n^2 n rather than its
+// negative. For a vector mirror and vector input that closed form is used
+// directly (about 2n multiply-adds); everything else goes through two
+// products, evaluating only the grades present in X.
+//
+// Batch variants work on structure-of-arrays batches, either many inputs
+// against one mirror or one input against many mirrors.
+
+namespace ga::ops {
+
+    using ga::Algebra;
+    using ga::BladeMask;
+    using ga::Multivector;
+    using ga::MultivectorBatch;
+
+    namespace detail {
+
+        inline bool isVectorOnly(const Multivector& X) {
+            const std::size_t N = static_cast<std::size_t>(1) << X.alg->dimensions;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (X.storage[i] != 0.0f && Blade::getGrade(static_cast<BladeMask>(i)) != 1) return false;
+            }
+            return true;
+        }
+
+        inline unsigned gradesPresent(const Multivector& X) {
+            unsigned grades = 0;
+            const std::size_t N = static_cast<std::size_t>(1) << X.alg->dimensions;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (X.storage[i] != 0.0f) grades |= 1u << Blade::getGrade(static_cast<BladeMask>(i));
+            }
+            return grades;
+        }
+
+        // Metric-weighted vector inner product over the grade-1 coefficients
+        inline double vectorDot(const Multivector& a, const Multivector& b) {
+            double dot = 0.0;
+            for (int k = 0; k < a.alg->dimensions; ++k) {
+                const BladeMask e = Blade::getBasis(k);
+                dot += static_cast<double>(a.storage[e]) * b.storage[e] * a.alg->signature.getSign(k);
+            }
+            return dot;
+        }
+
+        inline void requireMirror(const double norm2, const char* fn) {
+            if ((norm2 < 0.0 ? -norm2 : norm2) <= ga::Policies::epsilon()) {
+                throw std::runtime_error(std::string(fn) + ": mirror is null (M ~M is too close to zero)");
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Reflect the vector part of v in the hyperplane orthogonal to n:
+     *        v - 2 (v.n) / n^2 n.
+     *
+     * Only grade-1 coefficients of v and n are read. Throws std::runtime_error
+     * if n is null.
+     */
+    inline Multivector reflectVector(const Multivector& v, const Multivector& n) {
+        if (!v.alg || !n.alg || v.alg != n.alg) {
+            throw std::invalid_argument("ga::ops::reflectVector: operands must share the same Algebra");
+        }
+        const double nn = detail::vectorDot(n, n);
+        detail::requireMirror(nn, "ga::ops::reflectVector");
+
+        const double k = 2.0 * detail::vectorDot(v, n) / nn;
+        Multivector out(*v.alg);
+        for (int a = 0; a < v.alg->dimensions; ++a) {
+            const BladeMask e = Blade::getBasis(a);
+            out.storage[e] = static_cast<float>(v.storage[e] - k * n.storage[e]);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Reflect X in the mirror blade M: (-1)^(k m) M X_k M^{-1} per grade k.
+     *
+     * M must have a single grade parity (a blade or other versor). Throws
+     * std::invalid_argument for mixed parity and std::runtime_error if M is null.
+     */
+    inline Multivector reflect(const Multivector& X, const Multivector& M) {
+        if (!X.alg || !M.alg || X.alg != M.alg) {
+            throw std::invalid_argument("ga::ops::reflect: operands must share the same Algebra");
+        }
+        ga::metrics::add(ga::metrics::Counter::Sandwiches);
+        const unsigned mGrades = detail::gradesPresent(M);
+        const bool odd = (mGrades & 0b010101010u) != 0;
+        if (odd && (mGrades & 0b101010101u) != 0) {
+            throw std::invalid_argument("ga::ops::reflect: mirror must be purely even or purely odd");
+        }
+
+        if (mGrades == 0b10u && detail::isVectorOnly(X)) {
+            return reflectVector(X, M);
+        }
+
+        const Multivector mRev = reverse(M);
+        const double norm2 = scalarProduct(M, mRev);
+        detail::requireMirror(norm2, "ga::ops::reflect");
+
+        Multivector mInv = mRev;
+        const std::size_t N = static_cast<std::size_t>(1) << X.alg->dimensions;
+        const float inv = static_cast<float>(1.0 / norm2);
+        for (std::size_t i = 0; i < N; ++i) mInv.storage[i] *= inv;
+
+        // M X^ M^{-1} carries the per-grade sign for odd mirrors; grades are preserved
+        const Multivector tmp = geometricProduct(M, odd ? gradeInvolution(X) : X);
+        return geometricProductGrades(tmp, mInv, detail::gradesPresent(X));
+    }
+
+    // -------------------------------------------------------------------------
+    // Batches
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Reflect the vectors of a batch in one hyperplane n.
+     *
+     * Reads the grade-1 columns of `in` and overwrites the grade-1 columns of
+     * `out`; other columns of `out` are left untouched. `in` and `out` may be
+     * the same batch. Costs 2n multiply-adds per element.
+     */
+    inline void reflectVectors(const MultivectorBatch& in, const Multivector& n, MultivectorBatch& out) {
+        if (!in.alg || n.alg != in.alg || out.alg != in.alg) {
+            throw std::invalid_argument("ga::ops::reflectVectors: Algebra mismatch or null");
+        }
+        if (in.count != out.count) {
+            throw std::invalid_argument("ga::ops::reflectVectors: batch sizes differ");
+        }
+        const int dims = in.alg->dimensions;
+        const double nn = detail::vectorDot(n, n);
+        detail::requireMirror(nn, "ga::ops::reflectVectors");
+
+        // Fold metric and 2 / n^2 into the dot weights: out_a = x_a - (sum_b w_b x_b) n_a
+        float w[MAX_DIMENSIONS]{}, nv[MAX_DIMENSIONS]{};
+        for (int a = 0; a < dims; ++a) {
+            nv[a] = n.storage[Blade::getBasis(a)];
+            w[a] = static_cast<float>(2.0 * nv[a] * in.alg->signature.getSign(a) / nn);
+        }
+
+        static constexpr std::size_t TILE = 256;
+        ga::parallel::parallelFor((in.count + TILE - 1) / TILE, 16, [&](const std::size_t t0, const std::size_t t1) {
+            float dot[TILE];
+            for (std::size_t t = t0; t < t1; ++t) {
+                const std::size_t base = t * TILE;
+                const std::size_t len = std::min(TILE, in.count - base);
+                std::fill(dot, dot + len, 0.0f);
+                for (int a = 0; a < dims; ++a) {
+                    const float* x = in.column(Blade::getBasis(a)) + base;
+                    for (std::size_t i = 0; i < len; ++i) dot[i] += w[a] * x[i];
+                }
+                for (int a = 0; a < dims; ++a) {
+                    const float* x = in.column(Blade::getBasis(a)) + base;
+                    float* y = out.column(Blade::getBasis(a)) + base;
+                    for (std::size_t i = 0; i < len; ++i) y[i] = x[i] - dot[i] * nv[a];
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Reflect one vector v in every hyperplane of a batch of mirrors.
+     *
+     * Reads the grade-1 columns of `mirrors` and overwrites the grade-1
+     * columns of `out`. Throws std::runtime_error (before writing) if any
+     * mirror is null.
+     */
+    inline void reflectVectors(const Multivector& v, const MultivectorBatch& mirrors, MultivectorBatch& out) {
+        if (!mirrors.alg || v.alg != mirrors.alg || out.alg != mirrors.alg) {
+            throw std::invalid_argument("ga::ops::reflectVectors: Algebra mismatch or null");
+        }
+        if (mirrors.count != out.count) {
+            throw std::invalid_argument("ga::ops::reflectVectors: batch sizes differ");
+        }
+        const int dims = v.alg->dimensions;
+        const std::size_t n = mirrors.count;
+
+        float g[MAX_DIMENSIONS]{}, xv[MAX_DIMENSIONS]{};
+        for (int a = 0; a < dims; ++a) {
+            g[a] = static_cast<float>(v.alg->signature.getSign(a));
+            xv[a] = v.storage[Blade::getBasis(a)];
+        }
+
+        // Per-mirror factor 2 (v.n) / n^2; computed up front so a null mirror leaves `out` untouched
+        std::vector<float> scale(n, 0.0f), norm2(n, 0.0f);
+        for (int a = 0; a < dims; ++a) {
+            const float* c = mirrors.column(Blade::getBasis(a));
+            const float gx = g[a] * xv[a];
+            for (std::size_t i = 0; i < n; ++i) {
+                scale[i] += gx * c[i];
+                norm2[i] += g[a] * c[i] * c[i];
+            }
+        }
+        bool nullMirror = false;
+        for (std::size_t i = 0; i < n; ++i) {
+            nullMirror |= (norm2[i] < 0.0f ? -norm2[i] : norm2[i]) <= ga::Policies::epsilon();
+            scale[i] = 2.0f * scale[i] / norm2[i];
+        }
+        if (nullMirror) {
+            throw std::runtime_error("ga::ops::reflectVectors: mirror is null (n^2 is too close to zero)");
+        }
+
+        for (int a = 0; a < dims; ++a) {
+            const float* c = mirrors.column(Blade::getBasis(a));
+            float* y = out.column(Blade::getBasis(a));
+            const float x = xv[a];
+            for (std::size_t i = 0; i < n; ++i) y[i] = x - scale[i] * c[i];
+        }
+    }
+
+    /**
+     * @brief Reflect every element of a batch in one mirror blade M.
+     *
+     * The reflection is linear in X, so its matrix is built once from the
+     * basis blades and applied as a ProductMatrix GEMM. Overwrites every
+     * column of `out`; `in` and `out` may be the same batch.
+     */
+    inline void reflect(const MultivectorBatch& in, const Multivector& M, MultivectorBatch& out) {
+        if (!in.alg || M.alg != in.alg || out.alg != in.alg) {
+            throw std::invalid_argument("ga::ops::reflect: Algebra mismatch or null");
+        }
+        const Algebra& alg = *in.alg;
+        const std::size_t N = in.bladeCount();
+
+        ProductMatrix pm;
+        pm.alg = &alg;
+        pm.m.assign(N * N, 0.0f);
+        for (std::size_t b = 0; b < N; ++b) {
+            pm.inputs.push_back(static_cast<BladeMask>(b));
+            pm.outputs.push_back(static_cast<BladeMask>(b));
+        }
+        for (std::size_t c = 0; c < N; ++c) {
+            Multivector e(alg);
+            e.storage[c] = 1.0f;
+            const Multivector img = reflect(e, M);
+            for (std::size_t r = 0; r < N; ++r) pm.m[r * N + c] = img.storage[r];
+        }
+        pm.apply(in, out);
+    }
+
+    /**
+     * @brief Reflect one multivector X in every mirror of a batch.
+     *
+     * Each element of `out` is reflect(X, mirrors[i]); elements are spread
+     * across threads with ga::parallel.
+     */
+    inline void reflect(const Multivector& X, const MultivectorBatch& mirrors, MultivectorBatch& out) {
+        if (!mirrors.alg || X.alg != mirrors.alg || out.alg != mirrors.alg) {
+            throw std::invalid_argument("ga::ops::reflect: Algebra mismatch or null");
+        }
+        if (mirrors.count != out.count) {
+            throw std::invalid_argument("ga::ops::reflect: batch sizes differ");
+        }
+        ga::parallel::parallelFor(mirrors.count, 64, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                out.set(i, reflect(X, mirrors.get(i)));
+            }
+        });
+    }
+
+} // namespace ga::ops
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/multivector.h"
+#include "ga/tables.h"
+#include "ga/ops/blade.h"
+
+// Output-selective geometric products.
+//
+// geometricProduct evaluates all 4^n blade pairs even when the caller only
+// reads a few coefficients of the result (the scalar part of V ~V, the vector
+// part of a sandwich, ...). These variants take the set of output blades up
+// front and, using the per-output term lists of ProductTables, touch only the
+// 2^n pairs feeding each requested output.
+//
+// Each requested coefficient is accumulated over the same terms, in the same
+// order and with the same rounding as geometricProduct, so the selected
+// outputs are bitwise identical to the corresponding full-product outputs.
+
+namespace ga::ops {
+
+    using ga::Algebra;
+    using ga::BladeMask;
+    using ga::Multivector;
+
+    /// Set of output blades (one bit per mask, up to 8 dimensions).
+    struct BladeSet {
+        std::uint64_t bits[4]{};
+
+        constexpr BladeSet() = default;
+
+        constexpr BladeSet& add(const BladeMask m) {
+            bits[m >> 6] |= std::uint64_t{1} << (m & 63);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool contains(const BladeMask m) const {
+            return (bits[m >> 6] >> (m & 63)) & 1u;
+        }
+
+        /// All blades of the grades set in `gradeMask` (bit k = grade k) in a `dims`-dimensional algebra.
+        [[nodiscard]] static constexpr BladeSet grades(const int dims, const unsigned gradeMask) {
+            BladeSet s;
+            const unsigned N = 1u << dims;
+            for (unsigned m = 0; m < N; ++m) {
+                if ((gradeMask >> Blade::getGrade(static_cast<BladeMask>(m))) & 1u) {
+                    s.add(static_cast<BladeMask>(m));
+                }
+            }
+            return s;
+        }
+    };
+
+    /// Coefficient `r` of A B, evaluated from the 2^n terms that feed it.
+    constexpr double productComponent(const Multivector& A, const Multivector& B, const BladeMask r) {
+        const Algebra* alg = A.alg;
+        if (!alg || !B.alg || alg != B.alg) {
+            throw std::invalid_argument("ga::ops::productComponent: Multivectors must share the same Algebra");
+        }
+
+        // Same per-step float rounding as geometricProductFiltered
+        float acc = 0.0f;
+
+        // The table registry is runtime-only; constant evaluation walks the same pairs directly
+        if (std::is_constant_evaluated()) {
+            const int N = 1 << alg->dimensions;
+            for (int i = 0; i < N; ++i) {
+                const auto j = static_cast<BladeMask>(i ^ r);
+                const double a = A.storage[i];
+                const double b = B.storage[j];
+                if (a == 0.0 || b == 0.0)
+                    continue;
+                const Blade gp = geometricProductBlade(Blade{static_cast<BladeMask>(i), +1}, Blade{j, +1}, alg->signature);
+                if (Blade::isZero(gp))
+                    continue;
+                acc = static_cast<float>(static_cast<double>(acc) + a * b * static_cast<double>(gp.sign));
+            }
+            return acc;
+        }
+
+        const ProductTables& t = productTables(*alg);
+        for (std::uint32_t k = t.offsets[r]; k < t.offsets[r + 1]; ++k) {
+            const BladeMask i = t.left[k];
+            const auto j = static_cast<BladeMask>(i ^ r);
+            const double a = A.storage[i];
+            const double b = B.storage[j];
+            if (a == 0.0 || b == 0.0)
+                continue;
+            acc = static_cast<float>(static_cast<double>(acc) + a * b * static_cast<double>(t.productSign(i, j)));
+        }
+        return acc;
+    }
+
+    /// Scalar part <A B>_0.
+    constexpr double scalarProduct(const Multivector& A, const Multivector& B) {
+        return productComponent(A, B, 0);
+    }
+
+    /// A B restricted to the blades in `outputs`; all other coefficients are zero.
+    constexpr Multivector geometricProductSelect(const Multivector& A, const Multivector& B, const BladeSet& outputs) {
+        const Algebra* alg = A.alg;
+        if (!alg || !B.alg || alg != B.alg) {
+            throw std::invalid_argument("ga::ops::geometricProductSelect: Multivectors must share the same Algebra");
+        }
+        Multivector result(*alg);
+        const std::size_t N = static_cast<std::size_t>(1) << alg->dimensions;
+        for (std::size_t r = 0; r < N; ++r) {
+            const auto m = static_cast<BladeMask>(r);
+            if (outputs.contains(m)) {
+                result.storage[m] = static_cast<float>(productComponent(A, B, m));
+            }
+        }
+        return result;
+    }
+
+    /// A B restricted to the grades set in `gradeMask` (bit k = grade k).
+    constexpr Multivector geometricProductGrades(const Multivector& A, const Multivector& B, const unsigned gradeMask) {
+        if (!A.alg) {
+            throw std::invalid_argument("ga::ops::geometricProductGrades: Multivector has no Algebra");
+        }
+        return geometricProductSelect(A, B, BladeSet::grades(A.alg->dimensions, gradeMask));
+    }
+
+} // namespace ga::ops
@@ -7,13 +7,13 @@ namespace ga::ops {
 
 using ga::Multivector;
 
-inline bool keepWedgeGrade(const int gradeA, const int gradeB, const int gradeR) {
+constexpr bool keepWedgeGrade(const int gradeA, const int gradeB, const int gradeR) {
     return gradeR == gradeA + gradeB;
 }
 
 // Outer product of two multivectors
-inline Multivector wedge(const Multivector& A, const Multivector& B) {
-    const Multivector result{ga::ops::geometricProductFiltered(A, B, &keepWedgeGrade)};
+constexpr Multivector wedge(const Multivector& A, const Multivector& B) {
+    const Multivector result{ga::ops::geometricProductFiltered(A, B, &keepWedgeGrade, ga::metrics::Op::Wedge)};
     return result;
 }
 
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ga/metrics.h"
+
+// Minimal fork-join helper shared by the batch kernels.
+//
+// parallelFor(count, grain, fn) splits [0, count) into chunks of at least
+// `grain` items and calls fn(begin, end) for each chunk on a persistent pool
+// of worker threads; the calling thread takes chunks too. Nested calls made
+// from inside a chunk, and calls that race with another parallelFor, simply
+// run serially on the caller, so kernels can use it without coordination.
+//
+// The number of threads defaults to std::thread::hardware_concurrency() and
+// can be changed with setThreadCount() (1 disables threading).
+
+namespace ga::parallel {
+
+    namespace detail {
+
+        class ThreadPool {
+        public:
+            static ThreadPool& instance() {
+                static ThreadPool pool;
+                return pool;
+            }
+
+            ~ThreadPool() { stop(); }
+
+            unsigned size() const { return threads_.load(std::memory_order_relaxed); }
+
+            void resize(unsigned threads) {
+                if (threads == 0) {
+                    threads = std::max(1u, std::thread::hardware_concurrency());
+                }
+                std::lock_guard<std::mutex> lock(runMutex_);
+                stop();
+                stopping_ = false;
+                for (unsigned i = 1; i < threads; ++i) {
+                    workers_.emplace_back([this] { workerLoop(); });
+                }
+                threads_.store(threads, std::memory_order_relaxed);
+            }
+
+            static bool& insideChunk() {
+                thread_local bool inside = false;
+                return inside;
+            }
+
+            // Run fn(chunk) for chunk in [0, chunks). Returns false if the pool was busy.
+            bool tryRun(const std::size_t chunks, const std::function<void(std::size_t)>& fn) {
+                std::unique_lock<std::mutex> runLock(runMutex_, std::try_to_lock);
+                if (!runLock.owns_lock() || workers_.empty()) {
+                    return false;
+                }
+
+                auto job = std::make_shared<Job>();
+                job->fn = &fn;
+                job->chunks = chunks;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    job_ = job;
+                    ++generation_;
+                }
+                wake_.notify_all();
+
+                work(*job);
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    finished_.wait(lock, [&] { return job->done.load() == job->chunks; });
+                    job_.reset();
+                }
+                if (job->error) {
+                    std::rethrow_exception(job->error);
+                }
+                return true;
+            }
+
+        private:
+            struct Job {
+                const std::function<void(std::size_t)>* fn = nullptr;
+                std::size_t chunks = 0;
+                std::atomic<std::size_t> next{0};
+                std::atomic<std::size_t> done{0};
+                std::exception_ptr error;
+                std::mutex errorMutex;
+            };
+
+            ThreadPool() { resize(0); }
+
+            void stop() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stopping_ = true;
+                }
+                wake_.notify_all();
+                for (auto& t : workers_) t.join();
+                workers_.clear();
+            }
+
+            void work(Job& job) {
+                insideChunk() = true;
+                for (;;) {
+                    const std::size_t c = job.next.fetch_add(1);
+                    if (c >= job.chunks) break;
+                    try {
+                        (*job.fn)(c);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(job.errorMutex);
+                        if (!job.error) job.error = std::current_exception();
+                    }
+                    if (job.done.fetch_add(1) + 1 == job.chunks) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        finished_.notify_all();
+                    }
+                }
+                insideChunk() = false;
+            }
+
+            void workerLoop() {
+                std::size_t seen = 0;
+                for (;;) {
+                    std::shared_ptr<Job> job;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                        if (stopping_) return;
+                        seen = generation_;
+                        job = job_;
+                    }
+                    if (job) work(*job);
+                }
+            }
+
+            std::vector<std::thread> workers_;
+            std::atomic<unsigned> threads_{1};
+            std::mutex runMutex_;   // one parallel region at a time
+            std::mutex mutex_;
+            std::condition_variable wake_;
+            std::condition_variable finished_;
+            std::shared_ptr<Job> job_;
+            std::size_t generation_ = 0;
+            bool stopping_ = false;
+        };
+
+    } // namespace detail
+
+    /// Number of threads parallelFor uses, including the caller.
+    inline unsigned threadCount() {
+        return detail::ThreadPool::instance().size();
+    }
+
+    /// Set the number of threads (0 = hardware concurrency, 1 = serial).
+    inline void setThreadCount(const unsigned threads) {
+        detail::ThreadPool::instance().resize(threads);
+    }
+
+    /**
+     * @brief Call fn(begin, end) over chunks covering [0, count).
+     *
+     * Chunks hold at least `grain` items; at most ~4 chunks per thread are made
+     * so the per-chunk overhead stays small next to the work.
+     */
+    template <class Fn>
+    void parallelFor(const std::size_t count, std::size_t grain, Fn&& fn) {
+        if (count == 0)
+            return;
+        grain = std::max<std::size_t>(grain, 1);
+
+        auto& pool = detail::ThreadPool::instance();
+        if (count <= grain || detail::ThreadPool::insideChunk()) {
+            fn(std::size_t{0}, count);
+            return;
+        }
+
+        const std::size_t threads = pool.size();
+        std::size_t chunks = std::min<std::size_t>((count + grain - 1) / grain, threads * 4);
+        if (threads <= 1 || chunks <= 1) {
+            fn(std::size_t{0}, count);
+            return;
+        }
+        const std::size_t step = (count + chunks - 1) / chunks;
+        chunks = (count + step - 1) / step;
+
+        const std::function<void(std::size_t)> body = [&](const std::size_t c) {
+            const std::size_t begin = c * step;
+            const std::size_t end = std::min(count, begin + step);
+            fn(begin, end);
+        };
+        ga::metrics::add(ga::metrics::Counter::ParallelJobs);
+        ga::metrics::add(ga::metrics::Counter::ParallelChunks, chunks);
+        if (!pool.tryRun(chunks, body)) {
+            fn(std::size_t{0}, count);
+        }
+    }
+
+} // namespace ga::parallel
@@ -0,0 +1,77 @@
+#pragma once
+#include <bit>
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/basis.h"
+
+// 3D Projective Geometric Algebra, Cl(3,0,1).
+// Axes 0,1,2 are the Euclidean e1,e2,e3 and axis 3 is the null (ideal) direction,
+// written e4 in mask order and usually called e0 in the PGA literature.
+//
+// Vectors are planes and trivectors are points:
+//   point(x, y, z) = e123 - x e234 + y e134 - z e124
+// A translator by t is T = 1 + 1/2 (tx e14 + ty e24 + tz e34), and a motor is M = T R
+// with R an ordinary rotor in e12, e13, e23. All act by the usual sandwich M X ~M.
+
+namespace ga::pga {
+
+    // Projective 3D signature (+,+,+,0)
+    inline constexpr Signature signature{3, 0, 1, true};
+    inline constexpr Algebra   algebra{signature};
+
+    // Index of the null axis
+    static constexpr int NULL_AXIS = 3;
+
+    // Blade masks used by points and motors
+    static constexpr BladeMask E123 = 0b0111;
+    static constexpr BladeMask E234 = 0b1110;
+    static constexpr BladeMask E134 = 0b1101;
+    static constexpr BladeMask E124 = 0b1011;
+    static constexpr BladeMask E14  = 0b1001;
+    static constexpr BladeMask E24  = 0b1010;
+    static constexpr BladeMask E34  = 0b1100;
+
+    [[nodiscard]] constexpr bool isPga(const Algebra& alg) {
+        const Signature& s = alg.signature;
+        return s.p() == 3 && s.q() == 0 && s.r() == 1 && s.isZero(NULL_AXIS);
+    }
+
+    // Euclidean point (x, y, z) in the given PGA algebra
+    constexpr Multivector point(const Algebra& alg, float x, float y, float z) {
+        Multivector P(alg);
+        P.setComponent(E123, 1.0f);
+        P.setComponent(E234, -x);
+        P.setComponent(E134, y);
+        P.setComponent(E124, -z);
+        return P;
+    }
+
+    constexpr Multivector point(float x, float y, float z) {
+        return point(algebra, x, y, z);
+    }
+
+    // Read back the Euclidean coordinates of a (finite) point trivector
+    constexpr void pointCoordinates(const Multivector& P, float& x, float& y, float& z) {
+        const float w = static_cast<float>(P.component(E123));
+        const float inv = (w != 0.0f) ? 1.0f / w : 0.0f;
+        x = static_cast<float>(-P.component(E234)) * inv;
+        y = static_cast<float>( P.component(E134)) * inv;
+        z = static_cast<float>(-P.component(E124)) * inv;
+    }
+
+    // Translator moving points by (tx, ty, tz)
+    constexpr Multivector translator(const Algebra& alg, float tx, float ty, float tz) {
+        Multivector T(alg);
+        T.setComponent(static_cast<BladeMask>(0), 1.0f);
+        T.setComponent(E14, 0.5f * tx);
+        T.setComponent(E24, 0.5f * ty);
+        T.setComponent(E34, 0.5f * tz);
+        return T;
+    }
+
+    constexpr Multivector translator(float tx, float ty, float tz) {
+        return translator(algebra, tx, ty, tz);
+    }
+
+} // namespace ga::pga
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/metrics.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/tables.h"
+#include "ga/ops/selective.h"
+
+// Fixed-operand multiplication matrices.
+//
+// For a fixed multivector F, X -> F X and X -> X F are linear maps on the 2^n
+// coefficients of X. ProductMatrix precomputes that matrix once (optionally
+// restricted to a set of input and output blades, e.g. grade 3 -> grade 3 for
+// a PGA motor acting on points), so a batch of products becomes one small
+// dense matrix times a structure-of-arrays batch:
+//
+//   out[r] = sum_c m[r][c] * in[inputs[c]]      for r over `outputs`
+//
+// Entries come from ProductTables: for the left product F X the coefficient of
+// e_r contributed by X_j is sign(r^j, j) F_{r^j}; for X F it is sign(j, j^r) F_{j^r}.
+// The batch kernel is a tiled GEMM: a tile of elements is kept in L1 while
+// four output rows are accumulated per pass over the inputs, so each input
+// column is streamed once per four rows. The element loops are unit-stride and
+// vectorise; tiles are spread across threads with ga::parallel.
+
+namespace ga {
+
+    using ga::ops::BladeSet;
+
+    struct ProductMatrix {
+        const Algebra* alg = nullptr;
+        std::vector<BladeMask> inputs;   ///< input blades, column order
+        std::vector<BladeMask> outputs;  ///< output blades, row order
+        std::vector<float> m;            ///< row-major outputs.size() x inputs.size()
+
+        [[nodiscard]] std::size_t rows() const { return outputs.size(); }
+        [[nodiscard]] std::size_t cols() const { return inputs.size(); }
+
+        /// Matrix of X -> F X, restricted to the given input and output blades.
+        [[nodiscard]] static ProductMatrix left(const Multivector& F) { return build(F, true, nullptr, nullptr); }
+        [[nodiscard]] static ProductMatrix left(const Multivector& F, const BladeSet& in, const BladeSet& out) {
+            return build(F, true, &in, &out);
+        }
+
+        /// Matrix of X -> X F, restricted to the given input and output blades.
+        [[nodiscard]] static ProductMatrix right(const Multivector& F) { return build(F, false, nullptr, nullptr); }
+        [[nodiscard]] static ProductMatrix right(const Multivector& F, const BladeSet& in, const BladeSet& out) {
+            return build(F, false, &in, &out);
+        }
+
+        /// Apply to one multivector. Input blades outside `inputs` are ignored; outputs outside `outputs` are zero.
+        [[nodiscard]] Multivector apply(const Multivector& X) const {
+            if (!alg || !X.alg || X.alg != alg) {
+                throw std::invalid_argument("ga::ProductMatrix::apply: Algebra mismatch or null");
+            }
+            const std::size_t C = cols();
+            Multivector out(*alg);
+            for (std::size_t r = 0; r < rows(); ++r) {
+                const float* row = &m[r * C];
+                float sum = 0.0f;
+                for (std::size_t c = 0; c < C; ++c) {
+                    sum += row[c] * X.storage[inputs[c]];
+                }
+                out.storage[outputs[r]] = sum;
+            }
+            return out;
+        }
+
+        /**
+         * @brief Batch apply over structure-of-arrays input.
+         *
+         * Reads the `inputs` columns of `in` and overwrites the `outputs`
+         * columns of `out`; other columns of `out` are left untouched. `in` and
+         * `out` may be the same batch.
+         */
+        void apply(const MultivectorBatch& in, MultivectorBatch& out) const {
+            if (!alg || in.alg != alg || out.alg != alg) {
+                throw std::invalid_argument("ga::ProductMatrix::apply: Algebra mismatch or null");
+            }
+            if (in.count != out.count) {
+                throw std::invalid_argument("ga::ProductMatrix::apply: batch sizes differ");
+            }
+
+            static constexpr std::size_t TILE = 256;
+            const std::size_t n = in.count;
+            const std::size_t R = rows();
+            const std::size_t C = cols();
+            const std::size_t tiles = (n + TILE - 1) / TILE;
+            ga::metrics::add(ga::metrics::Counter::BatchCalls);
+            ga::metrics::add(ga::metrics::Counter::BatchElements, n);
+            ga::metrics::record(ga::metrics::Histogram::BatchSize, n);
+            ga::metrics::peak(ga::metrics::Gauge::ScratchBytesPeak, R * TILE * sizeof(float));
+
+            ga::parallel::parallelFor(tiles, 4, [&](const std::size_t t0, const std::size_t t1) {
+                std::vector<float> acc(R * TILE);
+                for (std::size_t t = t0; t < t1; ++t) {
+                    const std::size_t base = t * TILE;
+                    const std::size_t len = std::min(TILE, n - base);
+
+                    // Four output rows per sweep over the inputs: each input tile is loaded once per block
+                    std::size_t r = 0;
+                    for (; r + 4 <= R; r += 4) {
+                        float* a0 = &acc[(r + 0) * TILE];
+                        float* a1 = &acc[(r + 1) * TILE];
+                        float* a2 = &acc[(r + 2) * TILE];
+                        float* a3 = &acc[(r + 3) * TILE];
+                        std::fill(a0, a0 + 4 * TILE, 0.0f);
+                        for (std::size_t c = 0; c < C; ++c) {
+                            const float w0 = m[(r + 0) * C + c];
+                            const float w1 = m[(r + 1) * C + c];
+                            const float w2 = m[(r + 2) * C + c];
+                            const float w3 = m[(r + 3) * C + c];
+                            if (w0 == 0.0f && w1 == 0.0f && w2 == 0.0f && w3 == 0.0f)
+                                continue;
+                            const float* src = in.column(inputs[c]) + base;
+                            for (std::size_t i = 0; i < len; ++i) {
+                                const float x = src[i];
+                                a0[i] += w0 * x;
+                                a1[i] += w1 * x;
+                                a2[i] += w2 * x;
+                                a3[i] += w3 * x;
+                            }
+                        }
+                    }
+                    for (; r < R; ++r) {
+                        float* a = &acc[r * TILE];
+                        std::fill(a, a + TILE, 0.0f);
+                        for (std::size_t c = 0; c < C; ++c) {
+                            const float w = m[r * C + c];
+                            if (w == 0.0f)
+                                continue;
+                            const float* src = in.column(inputs[c]) + base;
+                            for (std::size_t i = 0; i < len; ++i) a[i] += w * src[i];
+                        }
+                    }
+
+                    // Write back after the whole tile is computed so in-place use is safe
+                    for (std::size_t k = 0; k < R; ++k) {
+                        std::copy(&acc[k * TILE], &acc[k * TILE] + len, out.column(outputs[k]) + base);
+                    }
+                }
+            });
+        }
+
+    private:
+        static ProductMatrix build(const Multivector& F, const bool leftSide,
+                                   const BladeSet* in, const BladeSet* out) {
+            if (!F.alg) {
+                throw std::invalid_argument("ga::ProductMatrix: operand has no Algebra");
+            }
+            const ProductTables& t = productTables(*F.alg);
+            const std::size_t N = t.bladeCount();
+
+            ProductMatrix pm;
+            pm.alg = F.alg;
+            for (std::size_t b = 0; b < N; ++b) {
+                const auto mask = static_cast<BladeMask>(b);
+                if (!in || in->contains(mask)) pm.inputs.push_back(mask);
+                if (!out || out->contains(mask)) pm.outputs.push_back(mask);
+            }
+
+            const std::size_t C = pm.inputs.size();
+            pm.m.assign(pm.outputs.size() * C, 0.0f);
+            for (std::size_t r = 0; r < pm.outputs.size(); ++r) {
+                const BladeMask rm = pm.outputs[r];
+                for (std::size_t c = 0; c < C; ++c) {
+                    const BladeMask j = pm.inputs[c];
+                    const auto f = static_cast<BladeMask>(rm ^ j);
+                    const int sign = leftSide ? t.productSign(f, j) : t.productSign(j, f);
+                    pm.m[r * C + c] = static_cast<float>(sign) * F.storage[f];
+                }
+            }
+            return pm;
+        }
+    };
+
+} // namespace ga
@@ -0,0 +1,534 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/rotor.h"
+#include "ga/tables.h"
+
+// Random multivectors, blades and rotors for Monte Carlo and fuzzing.
+//
+// Numbers come from Philox4x32-10, a counter-based generator: each 128-bit
+// output block is a pure function of (seed, counter), so any element of any
+// stream can be generated independently and in any order. Batch fills use the
+// counter
+//
+//   (element / 4, kind << 24 | draw, stream)        4 consecutive elements per block
+//
+// where `draw` numbers the values an element consumes (a column, a vector
+// coefficient, ...) and `kind` is a tag per fill (see FillKind), so different
+// fills of the same (seed, stream) never share blocks and are independent of
+// each other. Sequential streams use kind 0xFF. Results do not depend on the thread count or
+// on how the batch is split, and a fill is reproducible from (seed, stream).
+// One Philox block costs about as much as a handful of multiply-adds and
+// carries no state, so fills run at memory speed across threads.
+//
+// Stream gives a sequential generator per thread or task: use one stream id
+// per thread for reproducible parallel runs.
+//
+// rotors() samples the Haar (group-uniform) measure on the compact rotor
+// group Spin(p) x Spin(q) of Cl(p,q,r), i.e. rotations among the positive axes
+// times rotations among the negative axes; for a Euclidean signature that is
+// the whole rotor group. It uses the subgroup algorithm: R = F_n ... F_2 (+-1),
+// where F_j rotates axis a_j onto a uniform unit vector of span(a_1 .. a_j).
+
+namespace ga::random {
+
+    using ga::Algebra;
+    using ga::BladeMask;
+    using ga::Multivector;
+    using ga::MultivectorBatch;
+
+    /// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+    struct Philox4x32 {
+        using Counter = std::array<std::uint32_t, 4>;
+        using Key = std::array<std::uint32_t, 2>;
+
+        static constexpr std::uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+        static constexpr std::uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+
+        [[nodiscard]] static constexpr Counter block(Counter c, Key k) {
+            for (int round = 0; round < 10; ++round) {
+                const std::uint64_t p0 = static_cast<std::uint64_t>(M0) * c[0];
+                const std::uint64_t p1 = static_cast<std::uint64_t>(M1) * c[2];
+                c = {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0], static_cast<std::uint32_t>(p1),
+                     static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1], static_cast<std::uint32_t>(p0)};
+                k[0] += W0;
+                k[1] += W1;
+            }
+            return c;
+        }
+    };
+
+    /// Uniform float in [0, 1) from the top 24 bits.
+    constexpr float toUniform(const std::uint32_t x) {
+        return static_cast<float>(x >> 8) * 0x1p-24f;
+    }
+
+    namespace detail {
+
+        inline constexpr float TWO_PI = 6.28318530717958647692f;
+
+        /// Counter domain of each batch fill: the top byte of the draw word. 0xFF belongs to Stream.
+        enum class FillKind : std::uint32_t {
+            Uniform = 1,
+            Gaussian = 2,
+            UnitVectors = 3,
+            Rotors = 4,
+            Blades = 0x10,  ///< + grade
+        };
+
+        constexpr std::uint32_t drawWord(const std::uint32_t kind, const std::uint32_t draw) {
+            return kind << 24 | draw;
+        }
+
+        constexpr Philox4x32::Key seedKey(const std::uint64_t seed) {
+            return {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+        }
+
+        /**
+         * Draw `draw` of elements [begin, begin + len): dst[i - begin].
+         * Uniform in [0, 1), or standard normal (Box-Muller on pairs of a block) for Normal.
+         */
+        template <bool Normal>
+        inline void fill(const std::uint64_t seed, const std::uint32_t stream, const std::uint32_t draw,
+                         const std::size_t begin, const std::size_t len, float* dst) {
+            const Philox4x32::Key key = seedKey(seed);
+            const std::size_t end = begin + len;
+            float v[4];
+            for (std::size_t blk = begin / 4; blk * 4 < end; ++blk) {
+                const Philox4x32::Counter c = Philox4x32::block(
+                    {static_cast<std::uint32_t>(blk), static_cast<std::uint32_t>(blk >> 32), draw, stream}, key);
+                if constexpr (Normal) {
+                    for (int pair = 0; pair < 4; pair += 2) {
+                        const float r = std::sqrt(-2.0f * std::log(1.0f - toUniform(c[pair])));
+                        const float a = TWO_PI * toUniform(c[pair + 1]);
+                        v[pair] = r * std::cos(a);
+                        v[pair + 1] = r * std::sin(a);
+                    }
+                } else {
+                    for (int w = 0; w < 4; ++w) v[w] = toUniform(c[w]);
+                }
+                const std::size_t first = blk * 4;
+                if (first >= begin && first + 4 <= end) {
+                    std::memcpy(dst + (first - begin), v, sizeof(v));
+                } else {
+                    for (std::size_t w = 0; w < 4; ++w) {
+                        if (first + w >= begin && first + w < end) dst[first + w - begin] = v[w];
+                    }
+                }
+            }
+        }
+
+        inline void requireBatch(const MultivectorBatch& out, const char* fn) {
+            if (!out.alg) {
+                throw std::invalid_argument(std::string(fn) + ": batch has no Algebra");
+            }
+        }
+
+        // Masks of each grade in increasing order
+        inline std::vector<BladeMask> masksOfGrade(const int dims, const int grade) {
+            std::vector<BladeMask> out;
+            for (std::size_t m = 0; m < (static_cast<std::size_t>(1) << dims); ++m) {
+                if (Blade::getGrade(static_cast<BladeMask>(m)) == grade) out.push_back(static_cast<BladeMask>(m));
+            }
+            return out;
+        }
+
+        /// Per-algebra plan for building one element from a vector of normal draws.
+        struct Builder {
+            const Algebra* alg = nullptr;
+            int dims = 0;
+            std::vector<int> positive, negative;     ///< axis indices by metric sign
+            std::vector<std::vector<BladeMask>> byGrade;
+            const ProductTables* tables = nullptr;
+
+            explicit Builder(const Algebra& a) : alg(&a), dims(a.dimensions), tables(&productTables(a)) {
+                for (int i = 0; i < dims; ++i) {
+                    if (a.signature.isPos(i)) positive.push_back(i);
+                    if (a.signature.isNeg(i)) negative.push_back(i);
+                }
+                for (int g = 0; g <= dims; ++g) byGrade.push_back(masksOfGrade(dims, g));
+            }
+
+            // Unit vector, uniform on the sphere of the positive axes; z holds dims normals
+            void unitVector(const float* z, float* coef) const {
+                float n2 = 0.0f;
+                for (const int a : positive) n2 += z[a] * z[a];
+                const float inv = n2 > 0.0f ? 1.0f / std::sqrt(n2) : 0.0f;
+                for (const int a : positive) coef[Blade::getBasis(a)] = z[a] * inv;
+                if (n2 == 0.0f) coef[Blade::getBasis(positive.front())] = 1.0f;
+            }
+
+            // Wedge of `grade` Gaussian vectors, scaled to unit coefficient norm; z holds grade * dims normals
+            void blade(const int grade, const float* z, float* coef, float* scratch) const {
+                const std::size_t N = static_cast<std::size_t>(1) << dims;
+                std::fill(coef, coef + N, 0.0f);
+                coef[0] = 1.0f;
+                for (int j = 0; j < grade; ++j) {
+                    std::fill(scratch, scratch + N, 0.0f);
+                    const float* v = z + j * dims;
+                    for (const BladeMask m : byGrade[j]) {
+                        const float c = coef[m];
+                        for (int a = 0; a < dims; ++a) {
+                            const BladeMask e = Blade::getBasis(a);
+                            if (m & e) continue;
+                            // e_m ^ e_a: move e_a past the axes of m above a
+                            const int swaps = Blade::getGrade(static_cast<BladeMask>(m >> (a + 1)));
+                            scratch[m | e] += ((swaps & 1) ? -c : c) * v[a];
+                        }
+                    }
+                    std::copy(scratch, scratch + N, coef);
+                }
+                float n2 = 0.0f;
+                for (const BladeMask m : byGrade[grade]) n2 += coef[m] * coef[m];
+                const float inv = n2 > 0.0f ? 1.0f / std::sqrt(n2) : 0.0f;
+                for (const BladeMask m : byGrade[grade]) coef[m] *= inv;
+            }
+
+            // R <- F R for F = (1 + v_a) + eps sum_i v_i e_i e_a, normalised (the rotor taking e_a to v);
+            // z[i] is the Gaussian coefficient of axes[i], i <= j
+            void rotateAxisTo(const std::vector<int>& axes, const std::size_t j, const float* z, float* R, float* scratch) const {
+                const std::size_t N = static_cast<std::size_t>(1) << dims;
+                const int a = axes[j];
+                const float eps = static_cast<float>(alg->signature.getSign(a));
+
+                float n2 = 0.0f;
+                for (std::size_t i = 0; i <= j; ++i) n2 += z[i] * z[i];
+                const float inv = n2 > 0.0f ? 1.0f / std::sqrt(n2) : 0.0f;
+
+                BladeMask fm[MAX_DIMENSIONS + 1];
+                float fc[MAX_DIMENSIONS + 1];
+                int terms = 0;
+                const float s = 1.0f + z[j] * inv;
+                if (s > 1e-6f) {
+                    // Normalise by the actual coefficients: 2 (1 + v_a) loses precision as v -> -e_a
+                    fm[terms] = 0;
+                    fc[terms++] = s;
+                    float f2 = s * s;
+                    for (std::size_t i = 0; i < j; ++i) {
+                        fm[terms] = static_cast<BladeMask>(Blade::getBasis(axes[i]) | Blade::getBasis(a));
+                        fc[terms] = eps * z[i] * inv;
+                        f2 += fc[terms] * fc[terms];
+                        ++terms;
+                    }
+                    const float norm = 1.0f / std::sqrt(f2);
+                    for (int t = 0; t < terms; ++t) fc[t] *= norm;
+                } else {
+                    // v = -e_a: a half turn in the plane of a_0 and a
+                    fm[terms] = static_cast<BladeMask>(Blade::getBasis(axes[0]) | Blade::getBasis(a));
+                    fc[terms++] = 1.0f;
+                }
+
+                std::fill(scratch, scratch + N, 0.0f);
+                for (std::size_t m = 0; m < N; ++m) {
+                    const float r = R[m];
+                    if (r == 0.0f) continue;
+                    for (int t = 0; t < terms; ++t) {
+                        const int sign = tables->productSign(fm[t], static_cast<BladeMask>(m));
+                        scratch[fm[t] ^ m] += static_cast<float>(sign) * fc[t] * r;
+                    }
+                }
+                std::copy(scratch, scratch + N, R);
+            }
+
+            // Haar rotor on Spin(p) x Spin(q); z holds rotorDraws() normals
+            void rotor(const float* z, float* R, float* scratch) const {
+                const std::size_t N = static_cast<std::size_t>(1) << dims;
+                std::fill(R, R + N, 0.0f);
+                R[0] = z[0] < 0.0f ? -1.0f : 1.0f;  // uniform over the two covers
+                const float* draws = z + 1;
+                for (const std::vector<int>* axes : {&positive, &negative}) {
+                    for (std::size_t j = 1; j < axes->size(); ++j) {
+                        rotateAxisTo(*axes, j, draws, R, scratch);
+                        draws += j + 1;
+                    }
+                }
+            }
+
+            // 1 sign + (j + 1) coefficients for step j of each block
+            [[nodiscard]] int rotorDraws() const {
+                int draws = 1;
+                for (const std::size_t n : {positive.size(), negative.size()}) {
+                    for (std::size_t j = 1; j < n; ++j) draws += static_cast<int>(j + 1);
+                }
+                return draws;
+            }
+        };
+
+        /**
+         * Run build(z, coef, scratch) per element with `draws` normals in z, in
+         * tiles spread over ga::parallel. Writes the `outputs` columns from coef
+         * and zeroes every other column.
+         */
+        template <class Build>
+        void generate(MultivectorBatch& out, const std::uint64_t seed, const std::uint32_t stream,
+                      const std::uint32_t kind, const int draws, const std::vector<BladeMask>& outputs,
+                      Build&& build) {
+            static constexpr std::size_t TILE = 256;
+            const std::size_t N = out.bladeCount();
+            const std::size_t count = out.count;
+            std::vector<char> isOutput(N, 0);
+            for (const BladeMask m : outputs) isOutput[m] = 1;
+
+            ga::parallel::parallelFor((count + TILE - 1) / TILE, 1, [&](const std::size_t t0, const std::size_t t1) {
+                std::vector<float> z(static_cast<std::size_t>(draws) * TILE), zi(static_cast<std::size_t>(draws));
+                std::vector<float> coef(N), scratch(N), tile(outputs.size() * TILE);
+                for (std::size_t t = t0; t < t1; ++t) {
+                    const std::size_t base = t * TILE;
+                    const std::size_t len = std::min(TILE, count - base);
+                    for (int d = 0; d < draws; ++d) {
+                        fill<true>(seed, stream, drawWord(kind, static_cast<std::uint32_t>(d)), base, len, &z[d * TILE]);
+                    }
+                    for (std::size_t i = 0; i < len; ++i) {
+                        for (int d = 0; d < draws; ++d) zi[d] = z[d * TILE + i];
+                        std::fill(coef.begin(), coef.end(), 0.0f);
+                        build(zi.data(), coef.data(), scratch.data());
+                        for (std::size_t k = 0; k < outputs.size(); ++k) tile[k * TILE + i] = coef[outputs[k]];
+                    }
+                    for (std::size_t k = 0; k < outputs.size(); ++k) {
+                        std::copy(&tile[k * TILE], &tile[k * TILE] + len, out.column(outputs[k]) + base);
+                    }
+                    for (std::size_t m = 0; m < N; ++m) {
+                        if (!isOutput[m]) std::fill(out.column(static_cast<BladeMask>(m)) + base, out.column(static_cast<BladeMask>(m)) + base + len, 0.0f);
+                    }
+                }
+            });
+        }
+
+        inline std::vector<BladeMask> evenMasks(const Builder& b) {
+            std::vector<BladeMask> out;
+            for (std::size_t g = 0; g < b.byGrade.size(); g += 2) {
+                for (const BladeMask m : b.byGrade[g]) {
+                    bool compact = true;
+                    for (int a = 0; a < b.dims; ++a) {
+                        if ((m & Blade::getBasis(a)) && b.alg->signature.isZero(a)) compact = false;
+                    }
+                    if (compact) out.push_back(m);
+                }
+            }
+            return out;
+        }
+
+        inline std::vector<BladeMask> gradeMasks(const Builder& b, const unsigned gradeMask) {
+            std::vector<BladeMask> out;
+            for (std::size_t g = 0; g < b.byGrade.size(); ++g) {
+                if ((gradeMask >> g) & 1u) out.insert(out.end(), b.byGrade[g].begin(), b.byGrade[g].end());
+            }
+            return out;
+        }
+
+    } // namespace detail
+
+    // -------------------------------------------------------------------------
+    // Batch fills
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Fill `out` with coefficients uniform in [lo, hi) on the grades in
+     *        `gradeMask` (bit k = grade k) and zero elsewhere.
+     */
+    inline void uniform(MultivectorBatch& out, const std::uint64_t seed, const std::uint32_t stream = 0,
+                        const float lo = -1.0f, const float hi = 1.0f, const unsigned gradeMask = ~0u) {
+        detail::requireBatch(out, "ga::random::uniform");
+        const std::size_t N = out.bladeCount();
+        const float scale = hi - lo;
+        ga::parallel::parallelFor(N, 1, [&](const std::size_t m0, const std::size_t m1) {
+            for (std::size_t m = m0; m < m1; ++m) {
+                float* col = out.column(static_cast<BladeMask>(m));
+                if (!((gradeMask >> Blade::getGrade(static_cast<BladeMask>(m))) & 1u)) {
+                    std::fill(col, col + out.count, 0.0f);
+                    continue;
+                }
+                detail::fill<false>(seed, stream,
+                                    detail::drawWord(static_cast<std::uint32_t>(detail::FillKind::Uniform),
+                                                     static_cast<std::uint32_t>(m)),
+                                    0, out.count, col);
+                for (std::size_t i = 0; i < out.count; ++i) col[i] = lo + scale * col[i];
+            }
+        });
+    }
+
+    /**
+     * @brief Fill `out` with independent N(0, sigma^2) coefficients on the
+     *        grades in `gradeMask` and zero elsewhere.
+     */
+    inline void gaussian(MultivectorBatch& out, const std::uint64_t seed, const std::uint32_t stream = 0,
+                         const float sigma = 1.0f, const unsigned gradeMask = ~0u) {
+        detail::requireBatch(out, "ga::random::gaussian");
+        const std::size_t N = out.bladeCount();
+        ga::parallel::parallelFor(N, 1, [&](const std::size_t m0, const std::size_t m1) {
+            for (std::size_t m = m0; m < m1; ++m) {
+                float* col = out.column(static_cast<BladeMask>(m));
+                if (!((gradeMask >> Blade::getGrade(static_cast<BladeMask>(m))) & 1u)) {
+                    std::fill(col, col + out.count, 0.0f);
+                    continue;
+                }
+                detail::fill<true>(seed, stream,
+                                   detail::drawWord(static_cast<std::uint32_t>(detail::FillKind::Gaussian),
+                                                    static_cast<std::uint32_t>(m)),
+                                   0, out.count, col);
+                if (sigma != 1.0f) {
+                    for (std::size_t i = 0; i < out.count; ++i) col[i] *= sigma;
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Fill `out` with unit vectors uniform on the sphere of the positive
+     *        (Euclidean) axes. Throws std::invalid_argument if there are none.
+     */
+    inline void unitVectors(MultivectorBatch& out, const std::uint64_t seed, const std::uint32_t stream = 0) {
+        detail::requireBatch(out, "ga::random::unitVectors");
+        const detail::Builder b(*out.alg);
+        if (b.positive.empty()) {
+            throw std::invalid_argument("ga::random::unitVectors: algebra has no positive axes");
+        }
+        detail::generate(out, seed, stream, static_cast<std::uint32_t>(detail::FillKind::UnitVectors), b.dims, b.byGrade[1],
+                         [&](const float* z, float* coef, float*) { b.unitVector(z, coef); });
+    }
+
+    /**
+     * @brief Fill `out` with random unit k-blades: the wedge of k Gaussian
+     *        vectors, scaled so the grade-k coefficients have unit norm.
+     */
+    inline void blades(MultivectorBatch& out, const int grade, const std::uint64_t seed, const std::uint32_t stream = 0) {
+        detail::requireBatch(out, "ga::random::blades");
+        if (grade < 0 || grade > out.alg->dimensions) {
+            throw std::invalid_argument("ga::random::blades: grade out of range");
+        }
+        const detail::Builder b(*out.alg);
+        detail::generate(out, seed, stream,
+                         static_cast<std::uint32_t>(detail::FillKind::Blades) + static_cast<std::uint32_t>(grade),
+                         std::max(grade, 1) * b.dims, b.byGrade[grade],
+                         [&](const float* z, float* coef, float* scratch) { b.blade(grade, z, coef, scratch); });
+    }
+
+    /**
+     * @brief Fill `out` with Haar-uniform unit rotors of Spin(p) x Spin(q).
+     *
+     * In Cl(p, 0, 0) these are uniformly distributed rotations; in general
+     * signatures the boosts and null directions are left out (the non-compact
+     * part of the group has no uniform distribution).
+     */
+    inline void rotors(MultivectorBatch& out, const std::uint64_t seed, const std::uint32_t stream = 0) {
+        detail::requireBatch(out, "ga::random::rotors");
+        const detail::Builder b(*out.alg);
+        detail::generate(out, seed, stream, static_cast<std::uint32_t>(detail::FillKind::Rotors), b.rotorDraws(),
+                         detail::evenMasks(b),
+                         [&](const float* z, float* coef, float* scratch) { b.rotor(z, coef, scratch); });
+    }
+
+    // -------------------------------------------------------------------------
+    // Sequential streams
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Sequential generator over one Philox stream.
+     *
+     * Stream(seed, id) always yields the same sequence; give each thread its
+     * own id for reproducible parallel runs. Its blocks never collide with
+     * the batch fills of the same (seed, stream).
+     */
+    class Stream {
+    public:
+        explicit Stream(const std::uint64_t seed, const std::uint32_t stream = 0)
+            : key_(detail::seedKey(seed)), stream_(stream) {}
+
+        std::uint32_t next() {
+            if (used_ == 4) {
+                buffer_ = Philox4x32::block({static_cast<std::uint32_t>(block_), static_cast<std::uint32_t>(block_ >> 32),
+                                             SEQUENTIAL, stream_}, key_);
+                ++block_;
+                used_ = 0;
+            }
+            return buffer_[used_++];
+        }
+
+        float uniform() { return toUniform(next()); }
+        float uniform(const float lo, const float hi) { return lo + (hi - lo) * uniform(); }
+
+        float normal() {
+            if (haveSpare_) {
+                haveSpare_ = false;
+                return spare_;
+            }
+            const float r = std::sqrt(-2.0f * std::log(1.0f - uniform()));
+            const float a = detail::TWO_PI * uniform();
+            spare_ = r * std::sin(a);
+            haveSpare_ = true;
+            return r * std::cos(a);
+        }
+
+        /// Coefficients uniform in [lo, hi) on the grades in `gradeMask`.
+        Multivector multivector(const Algebra& alg, const unsigned gradeMask = ~0u, const float lo = -1.0f,
+                                const float hi = 1.0f) {
+            Multivector m(alg);
+            const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+            for (std::size_t i = 0; i < N; ++i) {
+                if ((gradeMask >> Blade::getGrade(static_cast<BladeMask>(i))) & 1u) m.storage[i] = uniform(lo, hi);
+            }
+            return m;
+        }
+
+        Multivector unitVector(const Algebra& alg) {
+            const detail::Builder b(alg);
+            if (b.positive.empty()) {
+                throw std::invalid_argument("ga::random::Stream::unitVector: algebra has no positive axes");
+            }
+            return build(alg, b.dims, [&](const float* z, float* coef, float*) { b.unitVector(z, coef); });
+        }
+
+        Multivector blade(const Algebra& alg, const int grade) {
+            if (grade < 0 || grade > alg.dimensions) {
+                throw std::invalid_argument("ga::random::Stream::blade: grade out of range");
+            }
+            const detail::Builder b(alg);
+            return build(alg, std::max(grade, 1) * b.dims,
+                         [&](const float* z, float* coef, float* scratch) { b.blade(grade, z, coef, scratch); });
+        }
+
+        Rotor rotor(const Algebra& alg) {
+            const detail::Builder b(alg);
+            return Rotor(build(alg, b.rotorDraws(),
+                               [&](const float* z, float* coef, float* scratch) { b.rotor(z, coef, scratch); }));
+        }
+
+    private:
+        static constexpr std::uint32_t SEQUENTIAL = 0xFFFFFFFFu;  ///< draw index reserved for streams
+
+        Philox4x32::Key key_;
+        std::uint32_t stream_;
+        std::uint64_t block_ = 0;
+        Philox4x32::Counter buffer_{};
+        int used_ = 4;
+        bool haveSpare_ = false;
+        float spare_ = 0.0f;
+
+        template <class Build>
+        Multivector build(const Algebra& alg, const int draws, Build&& fn) {
+            std::vector<float> z(static_cast<std::size_t>(draws));
+            for (float& v : z) v = normal();
+            const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+            std::vector<float> coef(N, 0.0f), scratch(N);
+            fn(z.data(), coef.data(), scratch.data());
+            Multivector m(alg);
+            for (std::size_t i = 0; i < N; ++i) m.storage[i] = coef[i];
+            return m;
+        }
+    };
+
+} // namespace ga::random
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__F16C__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/linearMap.h"
+#include "ga/rotor.h"
+
+// Reduced-precision batches: the same blade-major layout as MultivectorBatch,
+// but every coefficient is stored in 16 bits.
+//
+// Nothing is computed in 16 bits. Kernels widen a tile of each column they
+// need into float registers/buffers, do the arithmetic in float, and narrow
+// the results on store. That halves the bytes streamed per coefficient, which
+// is what limits throughput for large, read-once datasets.
+//
+// Formats (u = unit roundoff, the worst relative error of one narrowing):
+//   Fp16     IEEE binary16, 11-bit significand, u = 2^-11 ~ 4.9e-4,
+//            normal range 6.1e-5 .. 65504, overflow saturates to +-inf.
+//   BFloat16 truncated binary32, 8-bit significand, u = 2^-8 ~ 3.9e-3,
+//            same range as float.
+//
+// Conversions round to nearest, ties to even. With F16C (or AVX-512F) the fp16
+// conversions use the hardware instructions; otherwise, and for bf16, plain
+// bit-manipulation loops are used (bf16 widening is a shift and vectorises).
+
+namespace ga {
+
+    struct Fp16 {
+        static constexpr float unitRoundoff = 1.0f / 2048.0f;  // 2^-11
+
+        static float toFloat(const std::uint16_t h) {
+            const float magic = std::bit_cast<float>(113u << 23);
+            const std::uint32_t shiftedExp = 0x7c00u << 13;
+            std::uint32_t o = (h & 0x7fffu) << 13;
+            const std::uint32_t exp = shiftedExp & o;
+            o += (127u - 15u) << 23;
+            if (exp == shiftedExp) {
+                o += (128u - 16u) << 23;  // inf / nan
+            } else if (exp == 0) {
+                o += 1u << 23;            // subnormal: renormalise
+                o = std::bit_cast<std::uint32_t>(std::bit_cast<float>(o) - magic);
+            }
+            o |= (h & 0x8000u) << 16;
+            return std::bit_cast<float>(o);
+        }
+
+        static std::uint16_t fromFloat(const float f) {
+            const std::uint32_t infinity = 255u << 23;
+            const std::uint32_t maxHalf = (127u + 16u) << 23;
+            const std::uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+            const std::uint32_t sign = u & 0x80000000u;
+            u ^= sign;
+
+            std::uint32_t o;
+            if (u >= maxHalf) {
+                o = (u > infinity) ? 0x7e00u : 0x7c00u;
+            } else if (u < (113u << 23)) {
+                const float fu = std::bit_cast<float>(u) + std::bit_cast<float>(denormMagic);
+                o = std::bit_cast<std::uint32_t>(fu) - denormMagic;
+            } else {
+                const std::uint32_t mantOdd = (u >> 13) & 1u;
+                u += ((15u - 127u) << 23) + 0xfffu;
+                u += mantOdd;
+                o = u >> 13;
+            }
+            return static_cast<std::uint16_t>(o | (sign >> 16));
+        }
+
+        static void widen(const std::uint16_t* src, float* dst, const std::size_t n) {
+            std::size_t i = 0;
+#if defined(__AVX512F__)
+            for (; i + 16 <= n; i += 16) {
+                const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+            }
+#endif
+#if defined(__F16C__)
+            for (; i + 8 <= n; i += 8) {
+                const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+            }
+#endif
+            for (; i < n; ++i) dst[i] = toFloat(src[i]);
+        }
+
+        static void narrow(const float* src, std::uint16_t* dst, const std::size_t n) {
+            std::size_t i = 0;
+#if defined(__AVX512F__)
+            for (; i + 16 <= n; i += 16) {
+                const __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), h);
+            }
+#endif
+#if defined(__F16C__)
+            for (; i + 8 <= n; i += 8) {
+                const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+            }
+#endif
+            for (; i < n; ++i) dst[i] = fromFloat(src[i]);
+        }
+    };
+
+    struct BFloat16 {
+        static constexpr float unitRoundoff = 1.0f / 256.0f;  // 2^-8
+
+        static float toFloat(const std::uint16_t h) {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(h) << 16);
+        }
+
+        static std::uint16_t fromFloat(const float f) {
+            std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+            if ((u & 0x7fffffffu) > 0x7f800000u) {
+                return static_cast<std::uint16_t>((u >> 16) | 0x40u);  // keep nan quiet
+            }
+            u += 0x7fffu + ((u >> 16) & 1u);
+            return static_cast<std::uint16_t>(u >> 16);
+        }
+
+        static void widen(const std::uint16_t* src, float* dst, const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) dst[i] = toFloat(src[i]);
+        }
+
+        static void narrow(const float* src, std::uint16_t* dst, const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) dst[i] = fromFloat(src[i]);
+        }
+    };
+
+    /**
+     * @brief Structure-of-arrays batch with 16-bit coefficients.
+     *
+     * Same layout as MultivectorBatch: coefficient `mask` of element `i` is
+     * data[mask * count + i]. `Format` is Fp16 or BFloat16.
+     */
+    template <class Format>
+    struct ReducedBatch {
+        const Algebra* alg = nullptr;
+        std::size_t count = 0;
+        std::vector<std::uint16_t> data;
+
+        ReducedBatch() = default;
+
+        ReducedBatch(const Algebra& a, const std::size_t n)
+            : alg(&a), count(n), data((static_cast<std::size_t>(1) << a.dimensions) * n, 0) {}
+
+        /// Narrow a float batch (relative error <= u per coefficient).
+        explicit ReducedBatch(const MultivectorBatch& src)
+            : ReducedBatch(*src.alg, src.count) {
+            Format::narrow(src.data.data(), data.data(), data.size());
+        }
+
+        [[nodiscard]] std::size_t bladeCount() const {
+            return alg ? (static_cast<std::size_t>(1) << alg->dimensions) : 0;
+        }
+
+        [[nodiscard]] std::uint16_t* column(const BladeMask mask) { return data.data() + static_cast<std::size_t>(mask) * count; }
+        [[nodiscard]] const std::uint16_t* column(const BladeMask mask) const { return data.data() + static_cast<std::size_t>(mask) * count; }
+
+        /// Widen to a float batch (exact).
+        [[nodiscard]] MultivectorBatch widen() const {
+            MultivectorBatch out(*alg, count);
+            Format::widen(data.data(), out.data.data(), data.size());
+            return out;
+        }
+
+        /// Widen element i (exact).
+        [[nodiscard]] Multivector get(const std::size_t i) const {
+            if (!alg) {
+                throw std::invalid_argument("ga::ReducedBatch::get: batch has no Algebra");
+            }
+            if (i >= count) {
+                throw std::out_of_range("ga::ReducedBatch::get: index out of range");
+            }
+            Multivector mv(*alg);
+            const std::size_t N = bladeCount();
+            for (std::size_t m = 0; m < N; ++m) {
+                mv.storage[m] = Format::toFloat(data[m * count + i]);
+            }
+            return mv;
+        }
+
+        /// Narrow a Multivector into element i (relative error <= u per coefficient).
+        void set(const std::size_t i, const Multivector& mv) {
+            if (!alg || mv.alg != alg) {
+                throw std::invalid_argument("ga::ReducedBatch::set: Algebra mismatch or null");
+            }
+            if (i >= count) {
+                throw std::out_of_range("ga::ReducedBatch::set: index out of range");
+            }
+            const std::size_t N = bladeCount();
+            for (std::size_t m = 0; m < N; ++m) {
+                data[m * count + i] = Format::fromFloat(mv.storage[m]);
+            }
+        }
+    };
+
+    using HalfBatch = ReducedBatch<Fp16>;
+    using BFloat16Batch = ReducedBatch<BFloat16>;
+
+    namespace detail {
+
+        static constexpr std::size_t REDUCED_TILE = 256;
+
+        // out_r = sum_c M[r][c] in_c over the listed columns, widening and narrowing per tile
+        template <class Format>
+        void reducedMatVec(const float* M, const BladeMask* masks, const std::size_t C,
+                           const ReducedBatch<Format>& in, ReducedBatch<Format>& out) {
+            std::vector<float> src(C * REDUCED_TILE);
+            std::vector<std::uint16_t> packed(C * REDUCED_TILE);
+            float acc[REDUCED_TILE];
+            const std::size_t n = in.count;
+
+            for (std::size_t base = 0; base < n; base += REDUCED_TILE) {
+                const std::size_t len = (n - base < REDUCED_TILE) ? n - base : REDUCED_TILE;
+
+                for (std::size_t c = 0; c < C; ++c) {
+                    Format::widen(in.column(masks[c]) + base, &src[c * REDUCED_TILE], len);
+                }
+                for (std::size_t r = 0; r < C; ++r) {
+                    for (std::size_t i = 0; i < len; ++i) acc[i] = 0.0f;
+                    for (std::size_t c = 0; c < C; ++c) {
+                        const float w = M[r * C + c];
+                        if (w == 0.0f)
+                            continue;
+                        const float* x = &src[c * REDUCED_TILE];
+                        for (std::size_t i = 0; i < len; ++i) acc[i] += w * x[i];
+                    }
+                    Format::narrow(acc, &packed[r * REDUCED_TILE], len);
+                }
+                // Store after the tile is done so in-place use is safe
+                for (std::size_t r = 0; r < C; ++r) {
+                    std::uint16_t* dst = out.column(masks[r]) + base;
+                    const std::uint16_t* p = &packed[r * REDUCED_TILE];
+                    for (std::size_t i = 0; i < len; ++i) dst[i] = p[i];
+                }
+            }
+        }
+
+        template <class Format>
+        void checkReduced(const ReducedBatch<Format>& in, const ReducedBatch<Format>& out,
+                          const Algebra* alg, const char* who) {
+            if (!alg || in.alg != alg || out.alg != alg) {
+                throw std::invalid_argument(std::string(who) + ": Algebra mismatch or null");
+            }
+            if (in.count != out.count) {
+                throw std::invalid_argument(std::string(who) + ": batch sizes differ");
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Apply a linear map to the vector (grade-1) columns of a reduced batch.
+     *
+     * Other columns of `out` are untouched; `in` may alias `out`.
+     *
+     * Error bound, per output coefficient y_i = sum_j m_ij x_j with x_j the
+     * stored (already rounded) inputs:
+     *   |y~_i - y_i| <= u |y_i| + n 2^-24 sum_j |m_ij x_j|
+     * i.e. one narrowing plus float accumulation. For a rotation
+     * sum_j |m_ij x_j| <= sqrt(n) |x|, so the result is within about u |x|.
+     */
+    template <class Format>
+    void applyVectors(const LinearMap& L, const ReducedBatch<Format>& in, ReducedBatch<Format>& out) {
+        detail::checkReduced(in, out, L.alg, "ga::applyVectors");
+        const int dims = L.alg->dimensions;
+        float M[8 * 8];
+        BladeMask masks[8];
+        for (int r = 0; r < dims; ++r) {
+            masks[r] = Blade::getBasis(r);
+            for (int c = 0; c < dims; ++c) M[r * dims + c] = L.m[r][c];
+        }
+        detail::reducedMatVec(M, masks, static_cast<std::size_t>(dims), in, out);
+    }
+
+    /**
+     * @brief Rotate the vector columns of a reduced batch by a unit rotor.
+     *
+     * The rotor is converted once to its n x n matrix (Rotor::toLinearMap).
+     * Same error bound as applyVectors; the matrix itself carries float error
+     * of order n 2^-24, negligible next to u.
+     */
+    template <class Format>
+    void applyRotor(const Rotor& R, const ReducedBatch<Format>& in, ReducedBatch<Format>& out) {
+        applyVectors(R.toLinearMap(), in, out);
+    }
+
+    /**
+     * @brief Apply a grade-k compound map (normals, planes, volumes) to a reduced batch.
+     *
+     * Error bound per output coefficient, with C = C(n,k):
+     *   |y~_r - y_r| <= u |y_r| + C 2^-24 sum_c |M_rc x_c|.
+     */
+    template <class Format>
+    void applyCompound(const CompoundMap& map, const ReducedBatch<Format>& in, ReducedBatch<Format>& out) {
+        detail::checkReduced(in, out, map.alg, "ga::applyCompound");
+        detail::reducedMatVec(map.m.data(), map.masks.data(), map.masks.size(), in, out);
+    }
+
+    /**
+     * @brief Scale every coefficient by f.
+     *
+     * Error bound: |y~ - f x| <= u |f x| (a single rounding of the float product).
+     */
+    template <class Format>
+    void scale(ReducedBatch<Format>& batch, const float f) {
+        float buf[detail::REDUCED_TILE];
+        const std::size_t n = batch.data.size();
+        for (std::size_t base = 0; base < n; base += detail::REDUCED_TILE) {
+            const std::size_t len = (n - base < detail::REDUCED_TILE) ? n - base : detail::REDUCED_TILE;
+            Format::widen(batch.data.data() + base, buf, len);
+            for (std::size_t i = 0; i < len; ++i) buf[i] *= f;
+            Format::narrow(buf, batch.data.data() + base, len);
+        }
+    }
+
+} // namespace ga
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/rotor.h"
+#include "ga/pga.h"
+#include "ga/ops/geometric.h"
+
+// Rigid point-set registration.
+//
+// Given corresponding points p_i (source) and q_i (target) we want the rotor R
+// (and for PGA, the motor M = T R) that minimises sum_i w_i |q_i - M(p_i)|^2.
+//
+// The closed form works on the even subalgebra of E3: a rotor is
+// R = a + b23 e23 + b13 e13 + b12 e12, and sum_i w_i q_i . (R p_i ~R) is a quadratic
+// form in those four coefficients. Its matrix is built from the 3x3 correlation
+// of the centred points, and the optimal rotor is its top eigen-multivector
+// (this is the same matrix Horn writes down for quaternions).
+//
+// Points are passed as structure-of-arrays so the correlation sums run over
+// contiguous floats. Accumulation is split over LANES independent partial sums,
+// which lets the compiler vectorise the reduction without fast-math.
+
+namespace ga::registration {
+
+    using ga::Algebra;
+    using ga::Multivector;
+    using ga::Rotor;
+
+    /// Read-only view of a point cloud stored as separate x, y, z arrays.
+    struct PointSetView {
+        const float* x = nullptr;
+        const float* y = nullptr;
+        const float* z = nullptr;
+        std::size_t count = 0;
+    };
+
+    /// Closed-form rigid fit in plain numbers, before it is turned into a rotor/motor.
+    /// q = (w, x, y, z) with R = w - (x e23 - y e13 + z e12).
+    struct RigidFit {
+        double q[4]{1.0, 0.0, 0.0, 0.0};
+        double t[3]{0.0, 0.0, 0.0};
+    };
+
+    struct IcpOptions {
+        int   maxIterations = 30;
+        float tolerance = 1e-6f;  ///< stop when the RMS error changes less than this
+        float maxCorrespondenceDistance = std::numeric_limits<float>::infinity();
+    };
+
+    struct IcpResult {
+        Rotor motor;              ///< PGA motor mapping source onto target
+        int   iterations = 0;
+        float rms = 0.0f;         ///< RMS distance of the accepted correspondences
+        bool  converged = false;
+    };
+
+    namespace detail {
+
+        static constexpr std::size_t LANES = 8;
+
+        inline void checkView(const PointSetView& v, const char* who) {
+            if (v.count > 0 && (!v.x || !v.y || !v.z)) {
+                throw std::invalid_argument(std::string(who) + ": point arrays must not be null");
+            }
+        }
+
+        // Weighted centroid of a point set (w may be null for unit weights)
+        inline double centroid(const PointSetView& p, const float* w, double c[3]) {
+            float acc[4][LANES]{};
+            const std::size_t n = p.count;
+            const std::size_t body = n - n % LANES;
+
+            for (std::size_t i = 0; i < body; i += LANES) {
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    const float wi = w ? w[i + l] : 1.0f;
+                    acc[0][l] += wi * p.x[i + l];
+                    acc[1][l] += wi * p.y[i + l];
+                    acc[2][l] += wi * p.z[i + l];
+                    acc[3][l] += wi;
+                }
+            }
+            double sum[4]{};
+            for (int k = 0; k < 4; ++k)
+                for (std::size_t l = 0; l < LANES; ++l)
+                    sum[k] += acc[k][l];
+            for (std::size_t i = body; i < n; ++i) {
+                const double wi = w ? w[i] : 1.0;
+                sum[0] += wi * p.x[i];
+                sum[1] += wi * p.y[i];
+                sum[2] += wi * p.z[i];
+                sum[3] += wi;
+            }
+
+            const double inv = (sum[3] != 0.0) ? 1.0 / sum[3] : 0.0;
+            c[0] = sum[0] * inv;
+            c[1] = sum[1] * inv;
+            c[2] = sum[2] * inv;
+            return sum[3];
+        }
+
+        // S[a][b] = sum_i w_i (p_i - cp)_a (q_i - cq)_b
+        inline void correlation(const PointSetView& p, const PointSetView& q, const float* w,
+                                const double cp[3], const double cq[3], double S[3][3]) {
+            float acc[9][LANES]{};
+            const float px0 = static_cast<float>(cp[0]), py0 = static_cast<float>(cp[1]), pz0 = static_cast<float>(cp[2]);
+            const float qx0 = static_cast<float>(cq[0]), qy0 = static_cast<float>(cq[1]), qz0 = static_cast<float>(cq[2]);
+            const std::size_t n = p.count;
+            const std::size_t body = n - n % LANES;
+
+            for (std::size_t i = 0; i < body; i += LANES) {
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    const float wi = w ? w[i + l] : 1.0f;
+                    const float px = (p.x[i + l] - px0) * wi;
+                    const float py = (p.y[i + l] - py0) * wi;
+                    const float pz = (p.z[i + l] - pz0) * wi;
+                    const float qx = q.x[i + l] - qx0;
+                    const float qy = q.y[i + l] - qy0;
+                    const float qz = q.z[i + l] - qz0;
+                    acc[0][l] += px * qx; acc[1][l] += px * qy; acc[2][l] += px * qz;
+                    acc[3][l] += py * qx; acc[4][l] += py * qy; acc[5][l] += py * qz;
+                    acc[6][l] += pz * qx; acc[7][l] += pz * qy; acc[8][l] += pz * qz;
+                }
+            }
+            double sum[9]{};
+            for (int k = 0; k < 9; ++k)
+                for (std::size_t l = 0; l < LANES; ++l)
+                    sum[k] += acc[k][l];
+            for (std::size_t i = body; i < n; ++i) {
+                const double wi = w ? w[i] : 1.0;
+                const double px = (p.x[i] - cp[0]) * wi, py = (p.y[i] - cp[1]) * wi, pz = (p.z[i] - cp[2]) * wi;
+                const double qx = q.x[i] - cq[0], qy = q.y[i] - cq[1], qz = q.z[i] - cq[2];
+                sum[0] += px * qx; sum[1] += px * qy; sum[2] += px * qz;
+                sum[3] += py * qx; sum[4] += py * qy; sum[5] += py * qz;
+                sum[6] += pz * qx; sum[7] += pz * qy; sum[8] += pz * qz;
+            }
+            for (int a = 0; a < 3; ++a)
+                for (int b = 0; b < 3; ++b)
+                    S[a][b] = sum[a * 3 + b];
+        }
+
+        // Top eigenvector of a symmetric 4x4 matrix (cyclic Jacobi rotations)
+        inline void topEigenvector4(double N[4][4], double out[4]) {
+            double V[4][4]{};
+            for (int i = 0; i < 4; ++i) V[i][i] = 1.0;
+
+            for (int sweep = 0; sweep < 32; ++sweep) {
+                double off = 0.0;
+                for (int i = 0; i < 4; ++i)
+                    for (int j = i + 1; j < 4; ++j)
+                        off += N[i][j] * N[i][j];
+                if (off < 1e-30)
+                    break;
+
+                for (int i = 0; i < 4; ++i) {
+                    for (int j = i + 1; j < 4; ++j) {
+                        if (N[i][j] == 0.0)
+                            continue;
+                        const double theta = (N[j][j] - N[i][i]) / (2.0 * N[i][j]);
+                        const double t = (theta >= 0.0 ? 1.0 : -1.0) /
+                                         (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                        const double c = 1.0 / std::sqrt(t * t + 1.0);
+                        const double s = t * c;
+
+                        for (int k = 0; k < 4; ++k) {
+                            const double nki = N[k][i], nkj = N[k][j];
+                            N[k][i] = c * nki - s * nkj;
+                            N[k][j] = s * nki + c * nkj;
+                        }
+                        for (int k = 0; k < 4; ++k) {
+                            const double nik = N[i][k], njk = N[j][k];
+                            N[i][k] = c * nik - s * njk;
+                            N[j][k] = s * nik + c * njk;
+                        }
+                        for (int k = 0; k < 4; ++k) {
+                            const double vki = V[k][i], vkj = V[k][j];
+                            V[k][i] = c * vki - s * vkj;
+                            V[k][j] = s * vki + c * vkj;
+                        }
+                    }
+                }
+            }
+
+            int best = 0;
+            for (int i = 1; i < 4; ++i)
+                if (N[i][i] > N[best][best])
+                    best = i;
+            for (int k = 0; k < 4; ++k)
+                out[k] = V[k][best];
+            // Fix the double-cover sign so the scalar part is non-negative
+            if (out[0] < 0.0)
+                for (int k = 0; k < 4; ++k) out[k] = -out[k];
+        }
+
+        // Optimal rotation for a correlation matrix
+        inline void rotationFromCorrelation(const double S[3][3], double q[4]) {
+            const double Sxx = S[0][0], Sxy = S[0][1], Sxz = S[0][2];
+            const double Syx = S[1][0], Syy = S[1][1], Syz = S[1][2];
+            const double Szx = S[2][0], Szy = S[2][1], Szz = S[2][2];
+
+            double N[4][4] = {
+                {Sxx + Syy + Szz, Syz - Szy,        Szx - Sxz,        Sxy - Syx},
+                {Syz - Szy,       Sxx - Syy - Szz,  Sxy + Syx,        Szx + Sxz},
+                {Szx - Sxz,       Sxy + Syx,        -Sxx + Syy - Szz, Syz + Szy},
+                {Sxy - Syx,       Szx + Sxz,        Syz + Szy,        -Sxx - Syy + Szz},
+            };
+            topEigenvector4(N, q);
+        }
+
+        inline void rotationMatrix(const double q[4], double M[3][3]) {
+            const double w = q[0], x = q[1], y = q[2], z = q[3];
+            M[0][0] = 1 - 2 * (y * y + z * z); M[0][1] = 2 * (x * y - w * z);     M[0][2] = 2 * (x * z + w * y);
+            M[1][0] = 2 * (x * y + w * z);     M[1][1] = 1 - 2 * (x * x + z * z); M[1][2] = 2 * (y * z - w * x);
+            M[2][0] = 2 * (x * z - w * y);     M[2][1] = 2 * (y * z + w * x);     M[2][2] = 1 - 2 * (x * x + y * y);
+        }
+
+        // Write the rotor R = w - (x e23 - y e13 + z e12) into mv
+        inline void writeRotor(const double q[4], Multivector& mv) {
+            mv.setComponent(static_cast<BladeMask>(0),      q[0]);
+            mv.setComponent(static_cast<BladeMask>(0b110), -q[1]);
+            mv.setComponent(static_cast<BladeMask>(0b101),  q[2]);
+            mv.setComponent(static_cast<BladeMask>(0b011), -q[3]);
+        }
+
+        inline bool isE3(const Algebra& alg) {
+            const Signature& s = alg.signature;
+            return s.p() == 3 && s.q() == 0 && s.r() == 0;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Closed-form rigid fit between corresponding points.
+     *
+     * When `withTranslation` is false the rotation is about the origin and the
+     * translation is left at zero.
+     */
+    inline RigidFit fitRigid(const PointSetView& source, const PointSetView& target,
+                             const float* weights = nullptr, bool withTranslation = true) {
+        detail::checkView(source, "ga::registration::fitRigid");
+        detail::checkView(target, "ga::registration::fitRigid");
+        if (source.count != target.count) {
+            throw std::invalid_argument("ga::registration::fitRigid: source and target must have the same count");
+        }
+        if (source.count == 0) {
+            throw std::invalid_argument("ga::registration::fitRigid: empty point set");
+        }
+
+        RigidFit fit;
+        double cp[3]{}, cq[3]{};
+        if (withTranslation) {
+            detail::centroid(source, weights, cp);
+            detail::centroid(target, weights, cq);
+        }
+
+        double S[3][3];
+        detail::correlation(source, target, weights, cp, cq, S);
+        detail::rotationFromCorrelation(S, fit.q);
+
+        if (withTranslation) {
+            double M[3][3];
+            detail::rotationMatrix(fit.q, M);
+            for (int a = 0; a < 3; ++a) {
+                fit.t[a] = cq[a] - (M[a][0] * cp[0] + M[a][1] * cp[1] + M[a][2] * cp[2]);
+            }
+        }
+        return fit;
+    }
+
+    /// E3 rotor (about the origin) from a closed-form fit. `alg` must be Cl(3,0,0).
+    inline Rotor toRotor(const Algebra& alg, const RigidFit& fit) {
+        if (!detail::isE3(alg)) {
+            throw std::invalid_argument("ga::registration::toRotor: algebra must be Euclidean 3D (3,0,0)");
+        }
+        Multivector R(alg);
+        detail::writeRotor(fit.q, R);
+        return Rotor(R);
+    }
+
+    /// PGA motor M = T R from a closed-form fit. `alg` must be Cl(3,0,1).
+    inline Rotor toMotor(const Algebra& alg, const RigidFit& fit) {
+        if (!ga::pga::isPga(alg)) {
+            throw std::invalid_argument("ga::registration::toMotor: algebra must be 3D PGA (3,0,1)");
+        }
+        Multivector R(alg);
+        detail::writeRotor(fit.q, R);
+        const Multivector T = ga::pga::translator(alg,
+                                                  static_cast<float>(fit.t[0]),
+                                                  static_cast<float>(fit.t[1]),
+                                                  static_cast<float>(fit.t[2]));
+        return Rotor(ga::ops::geometricProduct(T, R));
+    }
+
+    /// Optimal E3 rotor R minimising sum w_i |q_i - R p_i ~R|^2 (rotation about the origin).
+    inline Rotor fitRotor(const Algebra& alg, const PointSetView& source, const PointSetView& target,
+                          const float* weights = nullptr) {
+        return toRotor(alg, fitRigid(source, target, weights, false));
+    }
+
+    /// Optimal PGA motor M minimising sum w_i |q_i - M(p_i)|^2.
+    inline Rotor fitMotor(const Algebra& alg, const PointSetView& source, const PointSetView& target,
+                          const float* weights = nullptr) {
+        return toMotor(alg, fitRigid(source, target, weights, true));
+    }
+
+    /**
+     * @brief Iterative closest point between two unmatched clouds.
+     *
+     * Each iteration transforms the source with the current fit, matches every
+     * source point to its nearest target point (brute force over the target SoA,
+     * O(N*M)), drops matches beyond `maxCorrespondenceDistance`, and re-solves the
+     * closed form from the original source to the matched targets.
+     */
+    inline IcpResult icp(const Algebra& alg, const PointSetView& source, const PointSetView& target,
+                         const IcpOptions& options = {}) {
+        detail::checkView(source, "ga::registration::icp");
+        detail::checkView(target, "ga::registration::icp");
+        if (!ga::pga::isPga(alg)) {
+            throw std::invalid_argument("ga::registration::icp: algebra must be 3D PGA (3,0,1)");
+        }
+        if (source.count == 0 || target.count == 0) {
+            throw std::invalid_argument("ga::registration::icp: empty point set");
+        }
+
+        const std::size_t n = source.count;
+        const std::size_t m = target.count;
+        const float maxD2 = options.maxCorrespondenceDistance * options.maxCorrespondenceDistance;
+
+        std::vector<float> moved(3 * n);
+        float* mx = moved.data();
+        float* my = mx + n;
+        float* mz = my + n;
+
+        std::vector<float> matched(3 * n);
+        std::vector<float> weights(n);
+        std::vector<float> dist2(m);
+
+        RigidFit fit;
+        IcpResult result{Rotor(Multivector(alg))};
+        float prevRms = std::numeric_limits<float>::infinity();
+
+        for (int iter = 0; iter < options.maxIterations; ++iter) {
+            // Transform the source with the current estimate
+            double R[3][3];
+            detail::rotationMatrix(fit.q, R);
+            float Rf[3][3];
+            for (int a = 0; a < 3; ++a)
+                for (int b = 0; b < 3; ++b)
+                    Rf[a][b] = static_cast<float>(R[a][b]);
+            const float tx = static_cast<float>(fit.t[0]);
+            const float ty = static_cast<float>(fit.t[1]);
+            const float tz = static_cast<float>(fit.t[2]);
+            for (std::size_t i = 0; i < n; ++i) {
+                const float x = source.x[i], y = source.y[i], z = source.z[i];
+                mx[i] = Rf[0][0] * x + Rf[0][1] * y + Rf[0][2] * z + tx;
+                my[i] = Rf[1][0] * x + Rf[1][1] * y + Rf[1][2] * z + ty;
+                mz[i] = Rf[2][0] * x + Rf[2][1] * y + Rf[2][2] * z + tz;
+            }
+
+            // Nearest neighbours
+            double err = 0.0;
+            std::size_t accepted = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const float px = mx[i], py = my[i], pz = mz[i];
+                for (std::size_t j = 0; j < m; ++j) {
+                    const float dx = target.x[j] - px;
+                    const float dy = target.y[j] - py;
+                    const float dz = target.z[j] - pz;
+                    dist2[j] = dx * dx + dy * dy + dz * dz;
+                }
+                std::size_t best = 0;
+                for (std::size_t j = 1; j < m; ++j)
+                    if (dist2[j] < dist2[best])
+                        best = j;
+
+                matched[i]         = target.x[best];
+                matched[n + i]     = target.y[best];
+                matched[2 * n + i] = target.z[best];
+                if (dist2[best] <= maxD2) {
+                    weights[i] = 1.0f;
+                    err += dist2[best];
+                    ++accepted;
+                } else {
+                    weights[i] = 0.0f;
+                }
+            }
+
+            if (accepted < 3) {
+                throw std::runtime_error("ga::registration::icp: fewer than 3 correspondences within range");
+            }
+
+            const float rms = static_cast<float>(std::sqrt(err / static_cast<double>(accepted)));
+            result.iterations = iter + 1;
+            result.rms = rms;
+            if (std::fabs(prevRms - rms) <= options.tolerance) {
+                result.converged = true;
+                break;
+            }
+            prevRms = rms;
+
+            const PointSetView matchedView{matched.data(), matched.data() + n, matched.data() + 2 * n, n};
+            fit = fitRigid(source, matchedView, weights.data(), true);
+        }
+
+        result.motor = toMotor(alg, fit);
+        return result;
+    }
+
+} // namespace ga::registration
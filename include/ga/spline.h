@@ -0,0 +1,644 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/pga.h"
+#include "ga/rotor.h"
+#include "ga/ops/blade.h"
+
+// Rotor and motor splines.
+//
+// Keys are unit rotors of E3 (Cl(3,0,0)) or unit motors of 3D PGA (Cl(3,0,1)).
+// Both live in the 8-dimensional even subalgebra
+//
+//   s + e12 + e13 + e23 + e14 + e24 + e34 + e1234     (E3 rotors use the first four)
+//
+// so all spline arithmetic runs on compact 8-float motors with a product
+// table generated from geometricProductBlade, instead of dense Multivectors.
+//
+// exp / log are the closed forms for PGA bivectors B = r + q (Euclidean part
+// r, ideal part q). With theta^2 = -r^2 and c the e1234 coefficient of r ^ q,
+//
+//   exp(B) = cos(theta) + sin(theta)/theta B + c sin(theta)/theta e1234
+//            - c (theta cos(theta) - sin(theta)) / theta^3 (r e1234)
+//
+// which reduces to the rotor formula for q = 0 and to 1 + B for r = 0.
+//
+// Two spline types are provided:
+//
+//   BSpline  cumulative cubic B-spline on the group (C2, approximating,
+//            clamped to the end keys, t in [0, n + 1]):
+//            M(t) = P_i exp(b1(u) w_{i+1}) exp(b2(u) w_{i+2}) exp(b3(u) w_{i+3})
+//            with w_j = log(~P_{j-1} P_j) precomputed per key.
+//   Squad    spherical quadrangle interpolation (C1, keys at t = 0 .. n - 1) with the
+//            inner control motors and per-segment logs precomputed.
+//
+// velocity(t) returns the body-frame generator rate ~M dM/dt, a bivector:
+// for M(t) = exp(t W) it is W. For a rotor R = exp(-theta/2 B) the angular
+// speed is therefore twice its magnitude.
+
+namespace ga::spline {
+
+    using ga::Algebra;
+    using ga::BladeMask;
+    using ga::Multivector;
+    using ga::MultivectorBatch;
+
+    namespace detail {
+
+        /// Even blades in compact order: s, e12, e13, e23, e14, e24, e34, e1234.
+        inline constexpr BladeMask EVEN_MASKS[8] = {0b0000, 0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100, 0b1111};
+
+        using Motor = std::array<float, 8>;
+
+        struct EvenTerm {
+            std::uint8_t out;
+            std::int8_t sign;
+        };
+
+        constexpr int evenIndex(const BladeMask m) {
+            for (int k = 0; k < 8; ++k) {
+                if (EVEN_MASKS[k] == m) return k;
+            }
+            return -1;
+        }
+
+        constexpr std::array<EvenTerm, 64> makeEvenTable() {
+            std::array<EvenTerm, 64> t{};
+            for (int a = 0; a < 8; ++a) {
+                for (int b = 0; b < 8; ++b) {
+                    const Blade gp = ga::ops::geometricProductBlade(Blade{EVEN_MASKS[a], +1}, Blade{EVEN_MASKS[b], +1},
+                                                                    ga::pga::signature);
+                    t[a * 8 + b] = {static_cast<std::uint8_t>(evenIndex(gp.mask)), static_cast<std::int8_t>(gp.sign)};
+                }
+            }
+            return t;
+        }
+
+        /// Products of compact even blades in PGA (E3 rotors never touch the e4 entries).
+        inline constexpr std::array<EvenTerm, 64> EVEN_TABLE = makeEvenTable();
+
+        struct EvenProductTerm {
+            std::uint8_t a, b, out;
+            std::int8_t sign;
+        };
+
+        inline constexpr std::size_t EVEN_TERMS = [] {
+            std::size_t n = 0;
+            for (const EvenTerm& t : EVEN_TABLE) n += t.sign != 0;
+            return n;
+        }();
+
+        /// Non-zero entries of EVEN_TABLE, so mul() unrolls to straight-line multiply-adds.
+        inline constexpr std::array<EvenProductTerm, EVEN_TERMS> EVEN_PRODUCT = [] {
+            std::array<EvenProductTerm, EVEN_TERMS> out{};
+            std::size_t n = 0;
+            for (int i = 0; i < 64; ++i) {
+                const EvenTerm t = EVEN_TABLE[i];
+                if (t.sign != 0) {
+                    out[n++] = {static_cast<std::uint8_t>(i / 8), static_cast<std::uint8_t>(i % 8), t.out, t.sign};
+                }
+            }
+            return out;
+        }();
+
+        inline Motor mul(const Motor& a, const Motor& b) {
+            Motor r{};
+            [&]<std::size_t... K>(std::index_sequence<K...>) {
+                ((r[EVEN_PRODUCT[K].out] += static_cast<float>(EVEN_PRODUCT[K].sign) * a[EVEN_PRODUCT[K].a] *
+                                             b[EVEN_PRODUCT[K].b]),
+                 ...);
+            }(std::make_index_sequence<EVEN_TERMS>{});
+            return r;
+        }
+
+        inline Motor reverse(const Motor& a) {
+            return {a[0], -a[1], -a[2], -a[3], -a[4], -a[5], -a[6], a[7]};
+        }
+
+        inline Motor scaled(const Motor& a, const float f) {
+            Motor r;
+            for (int k = 0; k < 8; ++k) r[k] = a[k] * f;
+            return r;
+        }
+
+        /// Ideal bivector r e1234 for the Euclidean bivector part r of `a`.
+        inline void euclideanTimesPseudo(const Motor& a, float out[3]) {
+            out[0] = out[1] = out[2] = 0.0f;
+            for (int k = 1; k <= 3; ++k) {
+                const EvenTerm t = EVEN_TABLE[k * 8 + 7];
+                if (t.sign != 0) out[t.out - 4] += static_cast<float>(t.sign) * a[k];
+            }
+        }
+
+        /// e1234 coefficient of r ^ q (Euclidean part r, ideal part q).
+        inline float wedgeCoefficient(const Motor& a) {
+            float c = 0.0f;
+            for (int i = 1; i <= 3; ++i) {
+                for (int j = 4; j <= 6; ++j) {
+                    const EvenTerm t = EVEN_TABLE[i * 8 + j];
+                    if (t.out == 7) c += static_cast<float>(t.sign) * a[i] * a[j];
+                }
+            }
+            return c;
+        }
+
+        // sin(x)/x and (x cos(x) - sin(x))/x^3 with series near zero
+        inline void trigFactors(const double x, double& sinc, double& k3) {
+            if (x < 1e-3) {
+                const double x2 = x * x;
+                sinc = 1.0 - x2 / 6.0;
+                k3 = -1.0 / 3.0 + x2 / 30.0;
+            } else {
+                sinc = std::sin(x) / x;
+                k3 = (x * std::cos(x) - std::sin(x)) / (x * x * x);
+            }
+        }
+
+        /// exp of the bivector in entries 1..6 of `b` (entries 0 and 7 are ignored).
+        inline Motor exp(const Motor& b) {
+            const double theta = std::sqrt(static_cast<double>(b[1]) * b[1] + static_cast<double>(b[2]) * b[2] +
+                                           static_cast<double>(b[3]) * b[3]);
+            const double c = wedgeCoefficient(b);
+            double sinc, k3;
+            trigFactors(theta, sinc, k3);
+
+            float rI[3];
+            euclideanTimesPseudo(b, rI);
+            Motor m;
+            m[0] = static_cast<float>(std::cos(theta));
+            for (int k = 1; k <= 3; ++k) m[k] = static_cast<float>(sinc * b[k]);
+            for (int k = 4; k <= 6; ++k) m[k] = static_cast<float>(sinc * b[k] - c * k3 * rI[k - 4]);
+            m[7] = static_cast<float>(c * sinc);
+            return m;
+        }
+
+        /// log of a unit motor with m[0] >= 0 (callers pick that cover); the result is a bivector in entries 1..6.
+        inline Motor log(const Motor& m) {
+            const double sinTheta = std::sqrt(static_cast<double>(m[1]) * m[1] + static_cast<double>(m[2]) * m[2] +
+                                              static_cast<double>(m[3]) * m[3]);
+            const double theta = std::atan2(sinTheta, static_cast<double>(m[0]));
+            double sinc, k3;
+            trigFactors(theta, sinc, k3);
+
+            Motor b{};
+            for (int k = 1; k <= 3; ++k) b[k] = static_cast<float>(m[k] / sinc);
+            const double c = m[7] / sinc;
+            float rI[3];
+            euclideanTimesPseudo(b, rI);
+            for (int k = 4; k <= 6; ++k) b[k] = static_cast<float>((m[k] + c * k3 * rI[k - 4]) / sinc);
+            return b;
+        }
+
+        /// log(~a b), taking the shorter of the two covers.
+        inline Motor relativeLog(const Motor& a, const Motor& b) {
+            Motor d = mul(reverse(a), b);
+            if (d[0] < 0.0f) d = scaled(d, -1.0f);
+            return log(d);
+        }
+
+        // (sinc(x) + 3 k3(x)) / x^2 = -d k3 / (x dx), with series near zero
+        inline double trigFactor5(const double x) {
+            if (x < 1e-2) return -1.0 / 15.0 + x * x / 210.0;
+            const double s = std::sin(x), c = std::cos(x);
+            return (x * x * s + 3.0 * x * c - 3.0 * s) / (x * x * x * x * x);
+        }
+
+        /// Derivative of wedgeCoefficient(a) along the bivector tangent `da`.
+        inline float wedgeCoefficient(const Motor& a, const Motor& da) {
+            float c = 0.0f;
+            for (int i = 1; i <= 3; ++i) {
+                for (int j = 4; j <= 6; ++j) {
+                    const EvenTerm t = EVEN_TABLE[i * 8 + j];
+                    if (t.out == 7) c += static_cast<float>(t.sign) * (da[i] * a[j] + a[i] * da[j]);
+                }
+            }
+            return c;
+        }
+
+        /// exp(b), also writing its derivative along the bivector tangent `db` to `dm`.
+        /// The closed form above is differentiated term by term; x dx = r . dr keeps it smooth at zero.
+        inline Motor exp(const Motor& b, const Motor& db, Motor& dm) {
+            const double theta = std::sqrt(static_cast<double>(b[1]) * b[1] + static_cast<double>(b[2]) * b[2] +
+                                           static_cast<double>(b[3]) * b[3]);
+            const double xdx = static_cast<double>(b[1]) * db[1] + static_cast<double>(b[2]) * db[2] +
+                               static_cast<double>(b[3]) * db[3];
+            const double c = wedgeCoefficient(b);
+            const double dc = wedgeCoefficient(b, db);
+            double sinc, k3;
+            trigFactors(theta, sinc, k3);
+            const double dsinc = k3 * xdx;
+            const double dk3 = -trigFactor5(theta) * xdx;
+
+            float rI[3], drI[3];
+            euclideanTimesPseudo(b, rI);
+            euclideanTimesPseudo(db, drI);
+            Motor m;
+            m[0] = static_cast<float>(std::cos(theta));
+            dm[0] = static_cast<float>(-sinc * xdx);
+            for (int k = 1; k <= 3; ++k) {
+                m[k] = static_cast<float>(sinc * b[k]);
+                dm[k] = static_cast<float>(dsinc * b[k] + sinc * db[k]);
+            }
+            for (int k = 4; k <= 6; ++k) {
+                m[k] = static_cast<float>(sinc * b[k] - c * k3 * rI[k - 4]);
+                dm[k] = static_cast<float>(dsinc * b[k] + sinc * db[k] -
+                                           (dc * k3 + c * dk3) * rI[k - 4] - c * k3 * drI[k - 4]);
+            }
+            m[7] = static_cast<float>(c * sinc);
+            dm[7] = static_cast<float>(dc * sinc + c * dsinc);
+            return m;
+        }
+
+        /// log of a unit motor `m`, also writing its derivative along the tangent `dm` to `db`.
+        inline Motor log(const Motor& m, const Motor& dm, Motor& db) {
+            const double sinTheta = std::sqrt(static_cast<double>(m[1]) * m[1] + static_cast<double>(m[2]) * m[2] +
+                                              static_cast<double>(m[3]) * m[3]);
+            const double theta = std::atan2(sinTheta, static_cast<double>(m[0]));
+            double sinc, k3;
+            trigFactors(theta, sinc, k3);
+            // theta dtheta, from theta = atan2(|m_r|, m_0) with |m_r| = theta sinc
+            const double mdm = static_cast<double>(m[1]) * dm[1] + static_cast<double>(m[2]) * dm[2] +
+                               static_cast<double>(m[3]) * dm[3];
+            const double xdx = m[0] * mdm / sinc - theta * theta * sinc * dm[0];
+            const double dsinc = k3 * xdx;
+            const double dk3 = -trigFactor5(theta) * xdx;
+
+            Motor b{};
+            db = Motor{};
+            for (int k = 1; k <= 3; ++k) {
+                b[k] = static_cast<float>(m[k] / sinc);
+                db[k] = static_cast<float>((dm[k] - b[k] * dsinc) / sinc);
+            }
+            const double c = m[7] / sinc;
+            const double dc = (dm[7] - c * dsinc) / sinc;
+            float rI[3], drI[3];
+            euclideanTimesPseudo(b, rI);
+            euclideanTimesPseudo(db, drI);
+            for (int k = 4; k <= 6; ++k) {
+                const double n = m[k] + c * k3 * rI[k - 4];
+                const double dn = dm[k] + (dc * k3 + c * dk3) * rI[k - 4] + c * k3 * drI[k - 4];
+                b[k] = static_cast<float>(n / sinc);
+                db[k] = static_cast<float>((dn - n / sinc * dsinc) / sinc);
+            }
+            return b;
+        }
+
+        inline bool supported(const Algebra& alg) {
+            const Signature& s = alg.signature;
+            return ga::pga::isPga(alg) || (s.p() == 3 && s.q() == 0 && s.r() == 0);
+        }
+
+        inline Motor toMotor(const Multivector& M, const Algebra* alg) {
+            if (M.alg != alg) {
+                throw std::invalid_argument("ga::spline: keys must share one Algebra");
+            }
+            Motor m{};
+            const std::size_t N = static_cast<std::size_t>(1) << alg->dimensions;
+            for (int k = 0; k < 8; ++k) {
+                if (EVEN_MASKS[k] < N) m[k] = M.storage[EVEN_MASKS[k]];
+            }
+            return m;
+        }
+
+        inline Multivector toMultivector(const Motor& m, const Algebra& alg) {
+            Multivector M(alg);
+            const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+            for (int k = 0; k < 8; ++k) {
+                if (EVEN_MASKS[k] < N) M.storage[EVEN_MASKS[k]] = m[k];
+            }
+            return M;
+        }
+
+        inline std::vector<Motor> keyMotors(const std::vector<Multivector>& keys) {
+            if (keys.empty()) {
+                throw std::invalid_argument("ga::spline: at least one key is required");
+            }
+            const Algebra* alg = keys.front().alg;
+            if (!alg || !supported(*alg)) {
+                throw std::invalid_argument("ga::spline: keys must be E3 rotors or PGA motors");
+            }
+            std::vector<Motor> out;
+            out.reserve(keys.size());
+            for (const Multivector& k : keys) {
+                Motor m = toMotor(k, alg);
+                // Keep consecutive keys on the same cover so segments take the short way
+                if (!out.empty()) {
+                    float d = 0.0f;
+                    for (int j = 0; j < 8; ++j) d += m[j] * out.back()[j];
+                    if (d < 0.0f) m = scaled(m, -1.0f);
+                }
+                out.push_back(m);
+            }
+            return out;
+        }
+
+        inline std::vector<Multivector> rotorValues(const std::vector<Rotor>& keys) {
+            std::vector<Multivector> out;
+            out.reserve(keys.size());
+            for (const Rotor& r : keys) out.push_back(r.value());
+            return out;
+        }
+
+        // Write the compact columns of `m` into element i of `out`
+        inline void store(MultivectorBatch& out, const std::size_t i, const Motor& m, const int first, const int last) {
+            const std::size_t N = out.bladeCount();
+            for (int k = first; k <= last; ++k) {
+                if (EVEN_MASKS[k] < N) out.column(EVEN_MASKS[k])[i] = m[k];
+            }
+        }
+
+    } // namespace detail
+
+    /// exp of an E3 or PGA bivector (only grade-2 coefficients are read).
+    inline Multivector motorExp(const Multivector& B) {
+        if (!B.alg || !detail::supported(*B.alg)) {
+            throw std::invalid_argument("ga::spline::motorExp: expected an E3 or PGA bivector");
+        }
+        detail::Motor b = detail::toMotor(B, B.alg);
+        b[0] = b[7] = 0.0f;
+        return detail::toMultivector(detail::exp(b), *B.alg);
+    }
+
+    /// log of a unit E3 rotor or PGA motor, taken on the cover with a non-negative
+    /// scalar part: exp(motorLog(M)) == M for M[0] >= 0 and -M otherwise (the same
+    /// rotation / motion), so -1 and rotations near 2 pi stay finite.
+    inline Multivector motorLog(const Multivector& M) {
+        if (!M.alg || !detail::supported(*M.alg)) {
+            throw std::invalid_argument("ga::spline::motorLog: expected an E3 rotor or PGA motor");
+        }
+        detail::Motor m = detail::toMotor(M, M.alg);
+        if (m[0] < 0.0f) m = detail::scaled(m, -1.0f);
+        return detail::toMultivector(detail::log(m), *M.alg);
+    }
+
+    /**
+     * @brief Cumulative cubic B-spline on the rotor / motor group.
+     *
+     * C2 continuous and approximating: the curve starts at the first key and
+     * ends at the last (end keys are tripled), but passes near, not through,
+     * the interior keys. With n keys the uniform parameter runs over n + 1
+     * segments, [0, n + 1]. Each evaluation costs three exps and three
+     * compact motor products.
+     */
+    class BSpline {
+    public:
+        explicit BSpline(const std::vector<Multivector>& keys) : alg_(keys.empty() ? nullptr : keys.front().alg) {
+            const std::vector<detail::Motor> m = detail::keyMotors(keys);
+            const int n = static_cast<int>(m.size());
+
+            // Padded keys P_j = M_clamp(j - 2), j = 0 .. n + 3: the end keys are tripled so
+            // the curve is clamped to them, giving n + 1 segments
+            for (int j = 0; j < n + 4; ++j) {
+                padded_.push_back(m[std::clamp(j - 2, 0, n - 1)]);
+            }
+            logs_.resize(padded_.size());
+            for (std::size_t j = 1; j < padded_.size(); ++j) {
+                logs_[j] = detail::relativeLog(padded_[j - 1], padded_[j]);
+            }
+            segments_ = n + 1;
+        }
+
+        explicit BSpline(const std::vector<Rotor>& keys) : BSpline(detail::rotorValues(keys)) {}
+
+        [[nodiscard]] const Algebra* algebra() const noexcept { return alg_; }
+
+        /// Parameter range is [0, duration()] = [0, keys + 1].
+        [[nodiscard]] float duration() const noexcept { return static_cast<float>(segments_); }
+
+        [[nodiscard]] Multivector evaluate(const float t) const {
+            return detail::toMultivector(at(t), *alg_);
+        }
+
+        [[nodiscard]] Multivector velocity(const float t) const {
+            return detail::toMultivector(rate(t), *alg_);
+        }
+
+        /// Evaluate at `count` parameters; writes the even columns of `out` (others untouched).
+        void evaluate(const float* t, const std::size_t count, MultivectorBatch& out) const {
+            requireBatch(out, count);
+            ga::parallel::parallelFor(count, 1024, [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) detail::store(out, i, at(t[i]), 0, 7);
+            });
+        }
+
+        /// Velocity at `count` parameters; writes the bivector columns of `out` (others untouched).
+        void velocity(const float* t, const std::size_t count, MultivectorBatch& out) const {
+            requireBatch(out, count);
+            ga::parallel::parallelFor(count, 1024, [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) detail::store(out, i, rate(t[i]), 1, 6);
+            });
+        }
+
+    private:
+        const Algebra* alg_ = nullptr;
+        std::vector<detail::Motor> padded_;
+        std::vector<detail::Motor> logs_;  ///< logs_[j] = log(~P_{j-1} P_j)
+        int segments_ = 1;
+
+        void locate(float t, int& i, float& u) const {
+            t = std::clamp(t, 0.0f, static_cast<float>(segments_));
+            i = std::min(static_cast<int>(t), segments_ - 1);
+            u = t - static_cast<float>(i);
+        }
+
+        static void basis(const float u, float b[3], float db[3]) {
+            const float u2 = u * u, u3 = u2 * u;
+            b[0] = (5.0f + 3.0f * u - 3.0f * u2 + u3) / 6.0f;
+            b[1] = (1.0f + 3.0f * u + 3.0f * u2 - 2.0f * u3) / 6.0f;
+            b[2] = u3 / 6.0f;
+            db[0] = (3.0f - 6.0f * u + 3.0f * u2) / 6.0f;
+            db[1] = (3.0f + 6.0f * u - 6.0f * u2) / 6.0f;
+            db[2] = 0.5f * u2;
+        }
+
+        [[nodiscard]] detail::Motor at(const float t) const {
+            int i;
+            float u, b[3], db[3];
+            locate(t, i, u);
+            basis(u, b, db);
+            detail::Motor m = padded_[i];
+            for (int j = 0; j < 3; ++j) m = detail::mul(m, detail::exp(detail::scaled(logs_[i + 1 + j], b[j])));
+            return m;
+        }
+
+        // ~M M' = sum_j db_j ~(A_j .. A_3) w_j (A_j .. A_3), accumulated from the left
+        [[nodiscard]] detail::Motor rate(const float t) const {
+            int i;
+            float u, b[3], db[3];
+            locate(t, i, u);
+            basis(u, b, db);
+            detail::Motor w = detail::scaled(logs_[i + 1], db[0]);
+            for (int j = 1; j < 3; ++j) {
+                const detail::Motor& wj = logs_[i + 1 + j];
+                const detail::Motor A = detail::exp(detail::scaled(wj, b[j]));
+                w = detail::mul(detail::mul(detail::reverse(A), w), A);
+                for (int k = 1; k <= 6; ++k) w[k] += db[j] * wj[k];
+            }
+            w[0] = w[7] = 0.0f;
+            return w;
+        }
+
+        void requireBatch(const MultivectorBatch& out, const std::size_t count) const {
+            if (out.alg != alg_) {
+                throw std::invalid_argument("ga::spline::BSpline: batch Algebra differs from the keys");
+            }
+            if (out.count < count) {
+                throw std::invalid_argument("ga::spline::BSpline: batch is smaller than the sample count");
+            }
+        }
+    };
+
+    /**
+     * @brief SQUAD interpolation through rotor / motor keys.
+     *
+     * Passes through every key (at integer t) with C1 continuity:
+     *   squad(u) = slerp(slerp(M_i, M_i+1, u), slerp(S_i, S_i+1, u), 2u(1 - u))
+     * with S_i = M_i exp(-(log(~M_i M_i+1) + log(~M_i M_i-1)) / 4). The inner
+     * control motors and both per-segment logs are precomputed, leaving one
+     * log and three exps per evaluation. velocity() is the product-rule
+     * derivative of the slerp pair within the segment containing t.
+     */
+    class Squad {
+    public:
+        explicit Squad(const std::vector<Multivector>& keys) : alg_(keys.empty() ? nullptr : keys.front().alg) {
+            keys_ = detail::keyMotors(keys);
+            const int n = static_cast<int>(keys_.size());
+            segments_ = std::max(n - 1, 1);
+            if (n == 1) keys_.push_back(keys_.front());
+
+            const int count = static_cast<int>(keys_.size());
+            std::vector<detail::Motor> fwd(count), inner(count);
+            for (int i = 0; i + 1 < count; ++i) fwd[i] = detail::relativeLog(keys_[i], keys_[i + 1]);
+            for (int i = 0; i < count; ++i) {
+                if (i == 0 || i == count - 1) {
+                    inner[i] = keys_[i];
+                    continue;
+                }
+                const detail::Motor back = detail::relativeLog(keys_[i], keys_[i - 1]);
+                detail::Motor d{};
+                for (int k = 1; k <= 6; ++k) d[k] = -0.25f * (fwd[i][k] + back[k]);
+                inner[i] = detail::mul(keys_[i], detail::exp(d));
+            }
+            for (int i = 0; i + 1 < count; ++i) {
+                segs_.push_back({keys_[i], inner[i], fwd[i], detail::relativeLog(inner[i], inner[i + 1])});
+            }
+        }
+
+        explicit Squad(const std::vector<Rotor>& keys) : Squad(detail::rotorValues(keys)) {}
+
+        [[nodiscard]] const Algebra* algebra() const noexcept { return alg_; }
+        [[nodiscard]] float duration() const noexcept { return static_cast<float>(segments_); }
+
+        [[nodiscard]] Multivector evaluate(const float t) const {
+            return detail::toMultivector(at(t), *alg_);
+        }
+
+        [[nodiscard]] Multivector velocity(const float t) const {
+            return detail::toMultivector(rate(t), *alg_);
+        }
+
+        void evaluate(const float* t, const std::size_t count, MultivectorBatch& out) const {
+            requireBatch(out, count);
+            ga::parallel::parallelFor(count, 1024, [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) detail::store(out, i, at(t[i]), 0, 7);
+            });
+        }
+
+        void velocity(const float* t, const std::size_t count, MultivectorBatch& out) const {
+            requireBatch(out, count);
+            ga::parallel::parallelFor(count, 1024, [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) detail::store(out, i, rate(t[i]), 1, 6);
+            });
+        }
+
+    private:
+        struct Segment {
+            detail::Motor key;       ///< M_i
+            detail::Motor inner;     ///< S_i
+            detail::Motor keyLog;    ///< log(~M_i M_i+1)
+            detail::Motor innerLog;  ///< log(~S_i S_i+1)
+        };
+
+        const Algebra* alg_ = nullptr;
+        std::vector<detail::Motor> keys_;
+        std::vector<Segment> segs_;
+        int segments_ = 1;
+
+        void locate(float t, int& i, float& u) const {
+            t = std::clamp(t, 0.0f, static_cast<float>(segments_));
+            i = std::min(static_cast<int>(t), segments_ - 1);
+            u = t - static_cast<float>(i);
+        }
+
+        [[nodiscard]] detail::Motor at(const float t) const {
+            int i;
+            float u;
+            locate(t, i, u);
+            const Segment& s = segs_[i];
+
+            const detail::Motor a = detail::mul(s.key, detail::exp(detail::scaled(s.keyLog, u)));
+            const detail::Motor b = detail::mul(s.inner, detail::exp(detail::scaled(s.innerLog, u)));
+            const float h = 2.0f * u * (1.0f - u);
+            return detail::mul(a, detail::exp(detail::scaled(detail::relativeLog(a, b), h)));
+        }
+
+        // With a = M_i exp(u W), b = S_i exp(u V), R = ~a b and E = exp(h log R):
+        //   R' = R V - W R,  (h L)' = h' L + h L',  ~M M' = ~E W E + ~E E'
+        // where L' and E' are the derivatives of the closed-form log / exp.
+        [[nodiscard]] detail::Motor rate(const float t) const {
+            int i;
+            float u;
+            locate(t, i, u);
+            const Segment& s = segs_[i];
+
+            const detail::Motor a = detail::mul(s.key, detail::exp(detail::scaled(s.keyLog, u)));
+            const detail::Motor b = detail::mul(s.inner, detail::exp(detail::scaled(s.innerLog, u)));
+            detail::Motor R = detail::mul(detail::reverse(a), b);
+            if (R[0] < 0.0f) R = detail::scaled(R, -1.0f);
+            detail::Motor dR = detail::mul(R, s.innerLog);
+            const detail::Motor WR = detail::mul(s.keyLog, R);
+            for (int k = 0; k < 8; ++k) dR[k] -= WR[k];
+
+            detail::Motor dL;
+            const detail::Motor L = detail::log(R, dR, dL);
+            const float h = 2.0f * u * (1.0f - u);
+            const float dh = 2.0f - 4.0f * u;
+            detail::Motor X, dX;
+            for (int k = 0; k < 8; ++k) {
+                X[k] = h * L[k];
+                dX[k] = dh * L[k] + h * dL[k];
+            }
+            detail::Motor dE;
+            const detail::Motor E = detail::exp(X, dX, dE);
+            const detail::Motor Er = detail::reverse(E);
+            detail::Motor w = detail::mul(detail::mul(Er, s.keyLog), E);
+            const detail::Motor g = detail::mul(Er, dE);
+            for (int k = 1; k <= 6; ++k) w[k] += g[k];
+            w[0] = w[7] = 0.0f;
+            return w;
+        }
+
+        void requireBatch(const MultivectorBatch& out, const std::size_t count) const {
+            if (out.alg != alg_) {
+                throw std::invalid_argument("ga::spline::Squad: batch Algebra differs from the keys");
+            }
+            if (out.count < count) {
+                throw std::invalid_argument("ga::spline::Squad: batch is smaller than the sample count");
+            }
+        }
+    };
+
+} // namespace ga::spline
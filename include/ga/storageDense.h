@@ -4,6 +4,7 @@
 #include <cassert>
 #include <algorithm> // For std::fill
 #include <cstring>   // For memset (optional, faster zeroing)
+#include <type_traits> // For std::is_constant_evaluated
 
 namespace ga {
 
@@ -20,7 +21,7 @@ struct DenseStorage {
     // OPTIMIZATION 3: Use uint8_t for dimensions (max 255)
     uint8_t dimensions;
 
-    explicit DenseStorage(const uint8_t dims) : dimensions(dims) {
+    constexpr explicit DenseStorage(const uint8_t dims) : dimensions(dims) {
         assert(dims <= 8 && "DenseStorage: dims too large for fixed storage");
 
         // Fast zeroing of memory.
@@ -29,25 +30,29 @@ struct DenseStorage {
         // how much to wipe for small N.
 
         // OPTIMIZATION 4: Only zero the memory we'll actually use - Zur
-        const size_t used_size = static_cast<size_t>(1) << dims;
-        std::memset(coefficients, 0, used_size * sizeof(float));
+        // memset is not usable in constant evaluation; the member initializer
+        // has already zeroed the array there.
+        if (!std::is_constant_evaluated()) {
+            const size_t used_size = static_cast<size_t>(1) << dims;
+            std::memset(coefficients, 0, used_size * sizeof(float));
+        }
     }
 
     // Non-const access
-    float& operator[](const size_t mask) {
+    constexpr float& operator[](const size_t mask) {
         // Using assert removes the check in Release builds for speed
         assert(mask < (1ULL << dimensions) && "mask out of range");
         return coefficients[mask];
     }
 
     // Const access
-    const float& operator[](const size_t mask) const {
+    constexpr const float& operator[](const size_t mask) const {
         assert(mask < (1ULL << dimensions) && "mask out of range");
         return coefficients[mask];
     }
 
     // Getter for current actual size used
-    [[nodiscard]] size_t size() const {
+    [[nodiscard]] constexpr size_t size() const {
         return static_cast<size_t>(1) << dimensions;
     }
 
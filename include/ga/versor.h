@@ -1,16 +1,27 @@
 #pragma once
 
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <stdexcept>
 
 #include "ga/algebra.h"
 #include "ga/multivector.h"
 #include "ga/ops/geometric.h"
 #include "ga/ops/involutions.h"
+#include "ga/ops/selective.h"
 #include "ga/policies.h"
 
 namespace ga {
 
+/// Sandwich kernel chosen for a Versor by its classification.
+enum class VersorPath : std::uint8_t {
+    Identity,    ///< non-zero scalar: V X V^{-1} = X
+    Reflection,  ///< non-null vector n: vectors map to 2 (x.n) / n^2 n - x in O(n)
+    UnitEven,    ///< even with V ~V = 1 (rotors, motors): V^{-1} = ~V, only X's grades are evaluated
+    General,     ///< anything else: V X V^{-1} with the full inverse
+};
+
 /**
  * @brief Generic versor: an invertible multivector acting by sandwich product.
  *
@@ -20,31 +31,60 @@ namespace ga {
  * In this simple implementation we assume V ~V has a non-zero scalar part
  * and use:
  *      V^{-1} = ~V / (V ~V)_scalar
+ *
+ * The versor is classified on construction (non-zero blades, grades, and the
+ * norm V ~V) and apply() picks the cheapest sandwich for that class; see
+ * VersorPath. The multivector is only reachable through value() and
+ * setValue(), so the classification can never go stale.
  */
 class Versor {
 public:
-    Multivector mv;  ///< underlying multivector (should be invertible)
-
     Versor() = default;
 
-    explicit Versor(const Multivector& v)
-        : mv(v) {}
+    constexpr explicit Versor(const Multivector& v)
+        : mv_(v) { reclassify(); }
 
     /// Convenience: build from an Algebra and an already-constructed multivector.
-    Versor(const Algebra& algebra, const Multivector& v)
-        : mv(v)
+    constexpr Versor(const Algebra& algebra, const Multivector& v)
+        : mv_(v)
     {
         // If v.alg is null, attach algebra; otherwise assume caller ensured consistency.
-        if (!mv.alg) {
-            mv.alg = &algebra;
+        if (!mv_.alg) {
+            mv_.alg = &algebra;
         }
+        reclassify();
     }
 
-    /// @return the associated Algebra (may be nullptr if mv.alg is not set).
-    [[nodiscard]] const Algebra* algebra() const noexcept { return mv.alg; }
+    /// @return the underlying multivector (should be invertible).
+    [[nodiscard]] constexpr const Multivector& value() const noexcept { return mv_; }
+
+    /// Replace the underlying multivector and reclassify it.
+    constexpr void setValue(const Multivector& v) {
+        mv_ = v;
+        reclassify();
+    }
+
+    /// @return the sandwich kernel apply() uses for this versor.
+    [[nodiscard]] constexpr VersorPath path() const noexcept { return path_; }
+
+    /// @return the blades with a non-zero coefficient.
+    [[nodiscard]] constexpr const ops::BladeSet& blades() const noexcept { return blades_; }
+
+    /// @return bit k set if grade k has a non-zero coefficient.
+    [[nodiscard]] constexpr unsigned grades() const noexcept { return grades_; }
+
+    /// @return the scalar part of V ~V.
+    [[nodiscard]] constexpr float norm2() const noexcept { return norm2_; }
+
+    [[nodiscard]] constexpr bool isEven() const noexcept { return grades_ != 0 && (grades_ & ODD_GRADES) == 0; }
+    [[nodiscard]] constexpr bool isOdd() const noexcept { return grades_ != 0 && (grades_ & ~ODD_GRADES) == 0; }
+    [[nodiscard]] constexpr bool isUnit() const noexcept { return absf(norm2_ - 1.0f) <= ga::Policies::epsilon(); }
+
+    /// @return the associated Algebra (may be nullptr if none is attached).
+    [[nodiscard]] constexpr const Algebra* algebra() const noexcept { return mv_.alg; }
 
     /// @return true if this versor has a valid algebra context.
-    [[nodiscard]] bool isValid() const noexcept { return mv.alg != nullptr; }
+    [[nodiscard]] constexpr bool isValid() const noexcept { return mv_.alg != nullptr; }
 
     /**
      * @brief Compute the inverse versor V^{-1}.
@@ -55,39 +95,49 @@ public:
      * If no algebra is attached, or the scalar norm is (near) zero,
      * behavior is undefined (for now we just divide and let the user handle it).
      */
-    [[nodiscard]] Multivector inverse() const;
+    [[nodiscard]] constexpr Multivector inverse() const;
 
     /**
      * @brief Apply the versor to a multivector X:
      *        X' = V X V^{-1}.
      */
-    [[nodiscard]] Multivector apply(const Multivector& X) const;
+    [[nodiscard]] constexpr Multivector apply(const Multivector& X) const;
+
+private:
+    static constexpr unsigned ODD_GRADES = 0b010101010u;
+
+    // std::fabs is not constexpr in C++20
+    static constexpr float absf(const float x) { return x < 0.0f ? -x : x; }
+
+    constexpr void reclassify();
+
+    Multivector mv_;  ///< underlying multivector (should be invertible)
+    ops::BladeSet blades_{};
+    unsigned grades_ = 0;
+    float norm2_ = 0.0f;
+    VersorPath path_ = VersorPath::General;
 };
 
 // ---------------------------------------------------------------------
 // Implementation
 // ---------------------------------------------------------------------
 
-inline Multivector Versor::inverse() const {
-    if (!mv.alg) {
-        throw std::invalid_argument("ga::Versor::inverse: versor has no Algebra (mv.alg is null)");
+constexpr Multivector Versor::inverse() const {
+    if (!mv_.alg) {
+        throw std::invalid_argument("ga::Versor::inverse: versor has no Algebra (no Algebra attached)");
     }
 
     using namespace ga::ops;
 
     // Reverse of the versor
-    const Multivector vrev = reverse(mv);
+    const Multivector vrev = reverse(mv_);
 
     // For a proper versor, V * ~V is (up to metric sign) a scalar.
-    const Multivector norm2_mv = geometricProduct(mv, vrev);
-
-    // Extract scalar part (mask 0)
-    const float s = static_cast<float>(
-        norm2_mv.component(static_cast<BladeMask>(0))
-    );
+    // Only that scalar is needed, so evaluate just the mask-0 output.
+    const float s = static_cast<float>(scalarProduct(mv_, vrev));
 
     const auto eps = ga::Policies::epsilon();
-    if (std::fabs(s) <= eps) {
+    if ((s < 0.0f ? -s : s) <= eps) {  // std::fabs is not constexpr in C++20
         throw std::runtime_error(
             "ga::Versor::inverse: scalar norm (V ~V) is too close to zero"
         );
@@ -97,7 +147,7 @@ inline Multivector Versor::inverse() const {
 
     // Scale the reversed versor
     Multivector inv = vrev;
-    const int dims = mv.alg->dimensions;
+    const int dims = mv_.alg->dimensions;
     const std::size_t N = (1u << dims);
     for (std::size_t i = 0; i < N; ++i) {
         inv.storage[i] *= inv_s;
@@ -107,15 +157,93 @@ inline Multivector Versor::inverse() const {
 }
 
 
-inline Multivector Versor::apply(const Multivector& X) const {
-    if (!mv.alg || !X.alg || mv.alg != X.alg) {
+constexpr Multivector Versor::apply(const Multivector& X) const {
+    if (!mv_.alg || !X.alg || mv_.alg != X.alg) {
         throw std::invalid_argument("ga::Versor::apply: versor and operand must share the same Algebra");
     }
+    if (!std::is_constant_evaluated()) ga::metrics::add(ga::metrics::Counter::Sandwiches);
 
     using namespace ga::ops;
+    const std::size_t N = static_cast<std::size_t>(1) << mv_.alg->dimensions;
+
+    switch (path_) {
+        case VersorPath::Identity:
+            return X;
+
+        case VersorPath::Reflection: {
+            // n x n^{-1} = 2 (x.n) / n^2 n - x, valid when X is a pure vector
+            bool vectorOnly = true;
+            double dot = 0.0;
+            for (std::size_t i = 0; i < N && vectorOnly; ++i) {
+                if (X.storage[i] == 0.0f) continue;
+                const auto m = static_cast<BladeMask>(i);
+                if (Blade::getGrade(m) != 1) {
+                    vectorOnly = false;
+                } else {
+                    const int axis = std::countr_zero(static_cast<unsigned>(m));
+                    dot += static_cast<double>(X.storage[i]) * mv_.storage[i] * mv_.alg->signature.getSign(axis);
+                }
+            }
+            if (!vectorOnly) break;
+
+            const double k = 2.0 * dot / static_cast<double>(norm2_);
+            Multivector out(*mv_.alg);
+            for (std::size_t i = 0; i < N; ++i) {
+                out.storage[i] = static_cast<float>(k * mv_.storage[i] - X.storage[i]);
+            }
+            return out;
+        }
+
+        case VersorPath::UnitEven: {
+            // A versor preserves grades, so only X's grades need the second product
+            unsigned xGrades = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (X.storage[i] != 0.0f) xGrades |= 1u << Blade::getGrade(static_cast<BladeMask>(i));
+            }
+            const Multivector tmp = geometricProduct(mv_, X);
+            return geometricProductGrades(tmp, reverse(mv_), xGrades);
+        }
+
+        case VersorPath::General:
+            break;
+    }
+
     const Multivector invV = inverse();
-    const Multivector tmp  = geometricProduct(mv, X);
+    const Multivector tmp  = geometricProduct(mv_, X);
     return geometricProduct(tmp, invV);
 }
 
+constexpr void Versor::reclassify() {
+    blades_ = {};
+    grades_ = 0;
+    norm2_ = 0.0f;
+    path_ = VersorPath::General;
+    if (!mv_.alg) {
+        return;
+    }
+
+    const std::size_t N = static_cast<std::size_t>(1) << mv_.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (mv_.storage[i] != 0.0f) {
+            const auto m = static_cast<BladeMask>(i);
+            blades_.add(m);
+            grades_ |= 1u << Blade::getGrade(m);
+        }
+    }
+    norm2_ = static_cast<float>(ops::scalarProduct(mv_, ops::reverse(mv_)));
+
+    // Same invertibility threshold as inverse(); anything below it keeps the General path and its error
+    const bool invertible = absf(norm2_) > ga::Policies::epsilon();
+    if (!invertible) {
+        return;
+    }
+    if (grades_ == 0b1u) {
+        path_ = VersorPath::Identity;
+    } else if (grades_ == 0b10u) {
+        path_ = VersorPath::Reflection;
+    } else if (isEven() && isUnit()) {
+        path_ = VersorPath::UnitEven;
+    }
+}
+
 } // namespace ga
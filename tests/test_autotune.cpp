@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/autotune.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/kernels.h"
+#include "ga/ops/wedge.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        m.storage[i] = (i % 4 == 1) ? 0.0f : std::sin(seed + 0.53f * static_cast<float>(i));
+    }
+    return m;
+}
+
+static bool sameBits(const Multivector& a, const Multivector& b) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (std::memcmp(&a.storage[i], &b.storage[i], sizeof(float)) != 0) return false;
+    }
+    return true;
+}
+
+static bool keepOuter(int ga, int gb, int gr) { return gr == ga + gb; }
+
+// Restores the process-wide selection state after each test
+class Autotune : public ::testing::Test {
+protected:
+    std::string path;
+    autotune::Mode savedMode{};
+    std::string savedPath;
+
+    void SetUp() override {
+        savedMode = autotune::mode();
+        savedPath = autotune::cachePath();
+        path = (std::filesystem::temp_directory_path() /
+                ("gasmith_autotune_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".tsv")).string();
+        std::filesystem::remove(path);
+        autotune::setCachePath(path);
+        autotune::reset();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+        autotune::setCachePath(savedPath);
+        autotune::setMode(savedMode);
+        autotune::reset();
+    }
+};
+
+TEST_F(Autotune, KernelsAreBitwiseIdentical) {
+    const Signature sigs[] = {
+        Signature(3, 0, 0, true), Signature(1, 3, 0, true),
+        Signature(3, 0, 1, true), Signature(4, 1, 0, true), Signature(5, 2, 1, true),
+    };
+    for (const Signature& sig : sigs) {
+        Algebra alg(sig);
+        const Multivector A = dense(alg, 0.4f);
+        const Multivector B = dense(alg, 2.1f);
+        const Multivector ref = productDense(A, B, nullptr);
+        const Multivector refOuter = productDense(A, B, keepOuter);
+
+        for (int k = 0; k < autotune::KERNEL_COUNT; ++k) {
+            const auto fn = autotune::kernelFunction(static_cast<autotune::Kernel>(k));
+            EXPECT_TRUE(sameBits(fn(A, B, nullptr), ref)) << autotune::metricKey(sig) << " kernel " << k;
+            EXPECT_TRUE(sameBits(fn(A, B, keepOuter), refOuter)) << autotune::metricKey(sig) << " kernel " << k;
+        }
+    }
+}
+
+TEST_F(Autotune, GeometricProductUsesSelectedKernel) {
+    Algebra alg(Signature(3, 0, 1, true));
+    const Multivector A = dense(alg, 0.8f);
+    const Multivector B = dense(alg, 1.3f);
+    const Multivector ref = productDense(A, B, nullptr);
+
+    for (int k = 0; k < autotune::KERNEL_COUNT; ++k) {
+        autotune::select(alg, static_cast<autotune::Kernel>(k));
+        EXPECT_EQ(autotune::selected(alg), static_cast<autotune::Kernel>(k));
+        EXPECT_EQ(autotune::kernelFor(alg), autotune::kernelFunction(static_cast<autotune::Kernel>(k)));
+        EXPECT_TRUE(sameBits(geometricProduct(A, B), ref));
+        EXPECT_TRUE(sameBits(wedge(A, B), productDense(A, B, keepOuter)));
+    }
+
+    // Mismatched algebras still throw through the dispatch
+    Algebra other(Signature(3, 0, 0, true));
+    EXPECT_THROW(geometricProduct(A, Multivector(other)), std::invalid_argument);
+}
+
+TEST_F(Autotune, CacheIsReadForThisCpuOnly) {
+    {
+        std::ofstream out(path);
+        out << "some other cpu\t3:+++\tdense\n";
+        out << autotune::cpuModel() << "\t3:+++\tbitparallel\n";
+        out << autotune::cpuModel() << "\t4:+++0\tnot-a-kernel\n";
+    }
+    autotune::setCachePath(path);
+    autotune::setMode(autotune::Mode::Cache);
+
+    EXPECT_EQ(autotune::selected(Algebra(Signature(3, 0, 0, true))), autotune::Kernel::BitParallel);
+    // Unknown kernel names and missing entries fall back to the default
+    const Algebra pga(Signature(3, 0, 1, true));
+    EXPECT_EQ(autotune::selected(pga), autotune::defaultKernel(pga));
+
+    // Off ignores the cache
+    autotune::reset();
+    autotune::setMode(autotune::Mode::Off);
+    const Algebra e3(Signature(3, 0, 0, true));
+    EXPECT_EQ(autotune::selected(e3), autotune::defaultKernel(e3));
+}
+
+TEST_F(Autotune, TunePersistsChoice) {
+    {
+        std::ofstream out(path);
+        out << "some other cpu\t4:++++\tsparse\n";
+    }
+    autotune::setMode(autotune::Mode::Cache);
+
+    Algebra alg(Signature(4, 0, 0, true));
+    const autotune::TuneResult r = autotune::tune(alg);
+    for (const double ns : r.nanos) EXPECT_GT(ns, 0.0);
+    EXPECT_EQ(autotune::selected(alg), r.best);
+
+    std::ifstream in(path);
+    std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_NE(contents.find("some other cpu\t4:++++\tsparse\n"), std::string::npos);
+    EXPECT_NE(contents.find(autotune::cpuModel() + "\t4:++++\t" + autotune::kernelName(r.best) + "\n"),
+              std::string::npos);
+
+    // Temporary files are unique per write and none is left behind
+    EXPECT_NE(ga::detail::tempPath(path), ga::detail::tempPath(path));
+    const std::string tmpPrefix = std::filesystem::path(path).filename().string() + ".tmp";
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::path(path).parent_path())) {
+        EXPECT_NE(entry.path().filename().string().rfind(tmpPrefix, 0), 0u) << entry.path();
+    }
+
+    // A fresh lookup in cache mode picks the recorded kernel up again
+    autotune::setCachePath(path);
+    autotune::reset();
+    EXPECT_EQ(autotune::selected(alg), r.best);
+}
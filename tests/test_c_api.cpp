@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/capi.h"
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/linearMap.h"
+#include "ga/versor.h"
+#include "ga/rotor.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/wedge.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/dual.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static float coeff(std::size_t i, std::size_t m) {
+    return std::sin(0.3f * static_cast<float>(i) + 1.7f * static_cast<float>(m)) * 0.5f;
+}
+
+TEST(CApi, AlgebraHandles) {
+    gasmith_algebra* alg = nullptr;
+    ASSERT_EQ(gasmith_algebra_create(3, 0, 1, &alg), GASMITH_OK);
+    EXPECT_EQ(gasmith_algebra_dimensions(alg), 4);
+    EXPECT_EQ(gasmith_algebra_blade_count(alg), 16u);
+    gasmith_algebra_destroy(alg);
+
+    EXPECT_EQ(gasmith_algebra_create(6, 3, 0, &alg), GASMITH_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(alg, nullptr);
+    EXPECT_STRNE(gasmith_last_error(), "");
+    EXPECT_EQ(gasmith_abi_version(), GASMITH_ABI_VERSION);
+}
+
+TEST(CApi, ProductsMatchCppOnStridedLayouts) {
+    gasmith_algebra* h = nullptr;
+    ASSERT_EQ(gasmith_algebra_create(3, 0, 0, &h), GASMITH_OK);
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    const std::size_t n = 700, N = 8;
+
+    // a: numpy-style rows (count, 8); b: structure-of-arrays; out: rows with padding
+    std::vector<float> aData(n * N), outData(n * 10, -1.0f);
+    MultivectorBatch b(alg, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t m = 0; m < N; ++m) {
+            aData[i * N + m] = coeff(i, m);
+            b.at(i, static_cast<BladeMask>(m)) = coeff(i + 11, m);
+        }
+
+    gasmith_array a{aData.data(), static_cast<std::ptrdiff_t>(N * sizeof(float)), sizeof(float)};
+    gasmith_array bv{b.data.data(), sizeof(float), static_cast<std::ptrdiff_t>(n * sizeof(float))};
+    gasmith_array out{outData.data(), static_cast<std::ptrdiff_t>(10 * sizeof(float)), sizeof(float)};
+
+    ASSERT_EQ(gasmith_geometric_product(h, n, &a, &bv, &out), GASMITH_OK);
+    for (std::size_t i = 0; i < n; i += 37) {
+        Multivector A(alg);
+        for (std::size_t m = 0; m < N; ++m) A.storage[m] = aData[i * N + m];
+        const Multivector expected = geometricProduct(A, b.get(i));
+        for (std::size_t m = 0; m < N; ++m)
+            EXPECT_FLOAT_EQ(outData[i * 10 + m], expected.storage[m]);
+        EXPECT_EQ(outData[i * 10 + 8], -1.0f);  // padding untouched
+    }
+
+    // In place: a := a ^ b
+    ASSERT_EQ(gasmith_wedge(h, n, &a, &bv, &a), GASMITH_OK);
+    for (std::size_t i = 0; i < n; i += 53) {
+        Multivector A(alg);
+        for (std::size_t m = 0; m < N; ++m) A.storage[m] = coeff(i, m);
+        const Multivector expected = wedge(A, b.get(i));
+        for (std::size_t m = 0; m < N; ++m)
+            EXPECT_FLOAT_EQ(aData[i * N + m], expected.storage[m]);
+    }
+
+    ASSERT_EQ(gasmith_dual(h, n, &bv, &out), GASMITH_OK);
+    const Multivector d = dual(b.get(5));
+    for (std::size_t m = 0; m < N; ++m) EXPECT_FLOAT_EQ(outData[5 * 10 + m], d.storage[m]);
+
+    gasmith_algebra_destroy(h);
+}
+
+TEST(CApi, SandwichNormalizeAndLinearMap) {
+    gasmith_algebra* h = nullptr;
+    ASSERT_EQ(gasmith_algebra_create(3, 0, 0, &h), GASMITH_OK);
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    const std::size_t n = 300, N = 8;
+
+    // One unnormalised rotor, broadcast with item_stride 0
+    float rotor[8] = {2.0f * std::cos(0.4f), 0, 0, -2.0f * std::sin(0.4f), 0, 0, 0, 0};
+    gasmith_array r{rotor, 0, sizeof(float)};
+    ASSERT_EQ(gasmith_normalize(h, 1, &r, &r), GASMITH_OK);
+    EXPECT_NEAR(rotor[0], std::cos(0.4f), 1e-6);
+
+    std::vector<float> x(n * N), out(n * N);
+    for (std::size_t k = 0; k < x.size(); ++k) x[k] = coeff(k, 0);
+    gasmith_array xv{x.data(), static_cast<std::ptrdiff_t>(N * sizeof(float)), sizeof(float)};
+    gasmith_array ov{out.data(), static_cast<std::ptrdiff_t>(N * sizeof(float)), sizeof(float)};
+
+    ASSERT_EQ(gasmith_sandwich(h, n, &r, &xv, &ov), GASMITH_OK);
+    Multivector Rm(alg);
+    for (std::size_t m = 0; m < N; ++m) Rm.storage[m] = rotor[m];
+    const Rotor R(Rm);
+    for (std::size_t i = 0; i < n; i += 29) {
+        Multivector X(alg);
+        for (std::size_t m = 0; m < N; ++m) X.storage[m] = x[i * N + m];
+        const Multivector expected = R.apply(X);
+        for (std::size_t m = 0; m < N; ++m)
+            EXPECT_NEAR(out[i * N + m], expected.storage[m], 1e-5);
+    }
+
+    // The rotor's matrix applied as an outermorphism agrees with the sandwich
+    const LinearMap L = R.toLinearMap();
+    float mat[9];
+    for (int row = 0; row < 3; ++row)
+        for (int col = 0; col < 3; ++col) mat[row * 3 + col] = L.get(row, col);
+    std::vector<float> out2(n * N);
+    gasmith_array ov2{out2.data(), static_cast<std::ptrdiff_t>(N * sizeof(float)), sizeof(float)};
+    ASSERT_EQ(gasmith_linear_map_apply(h, mat, n, &xv, &ov2), GASMITH_OK);
+    for (std::size_t k = 0; k < out.size(); ++k) EXPECT_NEAR(out2[k], out[k], 1e-5);
+
+    gasmith_algebra_destroy(h);
+}
+
+TEST(CApi, ErrorsBecomeStatusCodes) {
+    gasmith_algebra* h = nullptr;
+    ASSERT_EQ(gasmith_algebra_create(2, 0, 0, &h), GASMITH_OK);
+    float buf[8] = {};
+    gasmith_array a{buf, 4 * sizeof(float), sizeof(float)};
+
+    EXPECT_EQ(gasmith_geometric_product(nullptr, 1, &a, &a, &a), GASMITH_ERROR_NULL_POINTER);
+    EXPECT_EQ(gasmith_reverse(h, 1, &a, nullptr), GASMITH_ERROR_NULL_POINTER);
+
+    gasmith_array misaligned{buf, 3, sizeof(float)};
+    EXPECT_EQ(gasmith_reverse(h, 2, &misaligned, &a), GASMITH_ERROR_INVALID_ARGUMENT);
+
+    gasmith_array broadcastOut{buf, 0, sizeof(float)};
+    EXPECT_EQ(gasmith_reverse(h, 2, &a, &broadcastOut), GASMITH_ERROR_INVALID_ARGUMENT);
+
+    // Zero multivector cannot be normalised or used as a versor
+    EXPECT_EQ(gasmith_normalize(h, 2, &a, &a), GASMITH_ERROR_DOMAIN);
+    EXPECT_EQ(gasmith_sandwich(h, 2, &a, &a, &a), GASMITH_ERROR_DOMAIN);
+    EXPECT_STRNE(gasmith_last_error(), "");
+
+    gasmith_algebra_destroy(h);
+}
+
+// End test file
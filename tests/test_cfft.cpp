@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/field.h"
+#include "ga/cfft.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+using ga::field::MultivectorField;
+
+static MultivectorField smoothField(const Algebra& alg, std::size_t nx, std::size_t ny, std::size_t nz) {
+    MultivectorField F(alg, nx, ny, nz);
+    for (std::size_t m = 0; m < F.bladeCount(); ++m) {
+        float* col = F.column(static_cast<BladeMask>(m));
+        for (std::size_t i = 0; i < F.cells(); ++i) col[i] = std::sin(0.37f * i + 1.1f * m) + 0.2f * std::cos(0.05f * i * m);
+    }
+    return F;
+}
+
+// Direct sum of exp(-I theta) F(x), one geometric product per cell
+static Multivector directTransform(const MultivectorField& F, std::size_t u, std::size_t v, std::size_t w) {
+    const Algebra& alg = *F.alg;
+    const BladeMask I = static_cast<BladeMask>((1u << alg.dimensions) - 1);
+    Multivector sum(alg);
+    for (std::size_t z = 0; z < F.nz; ++z) {
+        for (std::size_t y = 0; y < F.ny; ++y) {
+            for (std::size_t x = 0; x < F.nx; ++x) {
+                const double theta = 2.0 * M_PI * (double(u * x) / F.nx + double(v * y) / F.ny + double(w * z) / F.nz);
+                Multivector kernel(alg);
+                kernel.setComponent(0, static_cast<float>(std::cos(theta)));
+                kernel.setComponent(I, static_cast<float>(-std::sin(theta)));
+                sum = sum + geometricProduct(kernel, F.get(x, y, z));
+            }
+        }
+    }
+    return sum;
+}
+
+TEST(CliffordFFT, MatchesDirectTransform) {
+    Algebra e3(Signature(3, 0, 0, true));
+    Algebra sta(Signature(1, 3, 0, true));   // I not central: the kernel acts from the left
+    Algebra e2(Signature(2, 0, 0, true));
+    struct Case { const Algebra* alg; std::size_t nx, ny, nz; };
+    for (const Case& c : {Case{&e3, 4, 2, 8}, Case{&sta, 8, 4, 2}, Case{&e2, 32, 1, 1}, Case{&e3, 1, 16, 4}}) {
+        const MultivectorField F = smoothField(*c.alg, c.nx, c.ny, c.nz);
+        MultivectorField G = F;
+        cfft::forward(G);
+        for (std::size_t w = 0; w < c.nz; ++w)
+            for (std::size_t v = 0; v < c.ny; ++v)
+                for (std::size_t u = 0; u < c.nx; u += 3) {
+                    const Multivector expect = directTransform(F, u, v, w);
+                    const Multivector got = G.get(u, v, w);
+                    for (std::size_t m = 0; m < F.bladeCount(); ++m) {
+                        EXPECT_NEAR(got.storage[m], expect.storage[m], 2e-4) << "cell " << u << "," << v << "," << w;
+                    }
+                }
+    }
+}
+
+TEST(CliffordFFT, InverseRoundTrips) {
+    Algebra cga(Signature(4, 1, 0, true));
+    const MultivectorField F = smoothField(cga, 16, 8, 32);
+    MultivectorField G = F;
+    cfft::forward(G);
+    cfft::inverse(G);
+    for (std::size_t i = 0; i < F.data.size(); ++i) EXPECT_NEAR(G.data[i], F.data[i], 1e-5);
+
+    // Parseval: sum |F|^2 = sum |F^|^2 / |grid|
+    cfft::forward(G);
+    double a = 0.0, b = 0.0;
+    for (std::size_t i = 0; i < F.data.size(); ++i) {
+        a += double(F.data[i]) * F.data[i];
+        b += double(G.data[i]) * G.data[i];
+    }
+    EXPECT_NEAR(a, b / F.cells(), 1e-4 * a);
+}
+
+TEST(CliffordFFT, PlaneWaveHasTwoPeaks) {
+    // F = e1 cos(2 pi 3 x / 16): spectrum e1 * 8 at u = +-3, everything else zero
+    Algebra e3(Signature(3, 0, 0, true));
+    MultivectorField F(e3, 16, 4, 1);
+    for (std::size_t y = 0; y < 4; ++y)
+        for (std::size_t x = 0; x < 16; ++x) F.at(x, y, 0, 0b001) = std::cos(2.0f * float(M_PI) * 3.0f * x / 16.0f);
+    cfft::forward(F);
+    for (std::size_t y = 0; y < 4; ++y) {
+        for (std::size_t u = 0; u < 16; ++u) {
+            const bool peak = y == 0 && (cfft::frequency(u, 16) == 3 || cfft::frequency(u, 16) == -3);
+            EXPECT_NEAR(F.at(u, y, 0, 0b001), peak ? 32.0f : 0.0f, 1e-4) << u << "," << y;
+            EXPECT_NEAR(F.at(u, y, 0, 0b110), 0.0f, 1e-4);
+        }
+    }
+    EXPECT_EQ(cfft::frequency(8, 16), -8);
+    EXPECT_EQ(cfft::frequency(7, 16), 7);
+    EXPECT_EQ(cfft::frequency(0, 1), 0);
+}
+
+TEST(CliffordFFT, RejectsUnsupportedFields) {
+    Algebra e4(Signature(4, 0, 0, true));   // I^2 = +1
+    Algebra pga(Signature(3, 0, 1, true));  // I^2 = 0
+    Algebra e3(Signature(3, 0, 0, true));
+    MultivectorField a(e4, 4, 4, 4), b(pga, 4, 4, 4), c(e3, 6, 4, 4);
+    EXPECT_THROW(cfft::forward(a), std::invalid_argument);
+    EXPECT_THROW(cfft::forward(b), std::invalid_argument);
+    EXPECT_THROW(cfft::inverse(c), std::invalid_argument);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/basis.h"
+#include "ga/batch.h"
+#include "ga/parallel.h"
+#include "ga/checkpoint.h"
+
+using namespace ga;
+using namespace ga::checkpoint;
+
+// Slowly rotating even-grade field: scalar + bivectors, odd grades stay zero
+static void fillFrame(MultivectorBatch& b, int frame) {
+    const float t = 0.01f * static_cast<float>(frame);
+    for (std::size_t i = 0; i < b.count; ++i) {
+        const float a = 0.001f * static_cast<float>(i) + t;
+        b.at(i, 0b000) = std::cos(a);
+        b.at(i, 0b011) = std::sin(a) * 0.6f;
+        b.at(i, 0b110) = std::sin(a) * 0.8f;
+    }
+}
+
+TEST(Checkpoint, LosslessRoundTripIsExact) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    const std::size_t n = 5000;
+
+    std::stringstream ss;
+    Options opt;
+    opt.chunkSize = 1024;
+    opt.keyframeInterval = 3;
+    Writer w(ss, alg, n, opt);
+
+    std::vector<MultivectorBatch> frames;
+    for (int f = 0; f < 7; ++f) {
+        MultivectorBatch b(alg, n);
+        fillFrame(b, f);
+        w.write(b);
+        frames.push_back(b);
+    }
+
+    Reader r(ss, alg);
+    EXPECT_EQ(r.count(), n);
+    MultivectorBatch out;
+    for (const auto& expected : frames) {
+        ASSERT_TRUE(r.read(out));
+        ASSERT_EQ(out.data.size(), expected.data.size());
+        EXPECT_EQ(std::memcmp(out.data.data(), expected.data.data(), expected.data.size() * sizeof(float)), 0);
+    }
+    EXPECT_FALSE(r.read(out));
+
+    // Zero columns are skipped and deltas compress well
+    EXPECT_LT(w.bytesWritten(), frames.size() * n * 4 * sizeof(float));
+}
+
+TEST(Checkpoint, QuantizedRespectsErrorBound) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    const std::size_t n = 3000;
+
+    std::stringstream ss;
+    Options opt;
+    opt.errorBound = 1e-4f;
+    Writer w(ss, alg, n, opt);
+
+    std::vector<MultivectorBatch> frames;
+    for (int f = 0; f < 5; ++f) {
+        MultivectorBatch b(alg, n);
+        fillFrame(b, f);
+        b.at(7, 0b111) = 12.345f;  // a stray pseudoscalar
+        w.write(b);
+        frames.push_back(b);
+    }
+    EXPECT_LT(w.bytesWritten(), frames.size() * n * 3 * sizeof(float));
+
+    Reader r(ss, alg);
+    EXPECT_FLOAT_EQ(r.errorBound(), 1e-4f);
+    MultivectorBatch out;
+    for (const auto& expected : frames) {
+        ASSERT_TRUE(r.read(out));
+        for (std::size_t k = 0; k < expected.data.size(); ++k) {
+            ASSERT_NEAR(out.data[k], expected.data[k], 1e-4 * 1.001 + 1e-6);
+        }
+    }
+}
+
+TEST(Checkpoint, FailedFrameLeavesStreamUsable) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    const std::size_t n = 2000;
+
+    std::stringstream ss;
+    Options opt;
+    opt.chunkSize = 256;
+    opt.errorBound = 0.125f;  // grid step 0.25: the values below are on the grid
+    Writer w(ss, alg, n, opt);
+
+    auto frame = [&](int f) {
+        MultivectorBatch b(alg, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            b.at(i, 0b000) = 0.25f * static_cast<float>((i + f) % 40);
+            b.at(i, 0b011) = -0.25f * static_cast<float>((3 * i + f) % 17);
+        }
+        return b;
+    };
+
+    const MultivectorBatch first = frame(0), second = frame(1);
+    w.write(first);
+    MultivectorBatch bad = frame(5);
+    bad.at(n - 1, 0b011) = 1e30f;  // only the last chunk fails
+    EXPECT_THROW(w.write(bad), std::range_error);
+    EXPECT_EQ(w.frames(), 1u);
+    w.write(second);
+
+    Reader r(ss, alg);
+    MultivectorBatch out;
+    ASSERT_TRUE(r.read(out));
+    EXPECT_EQ(out.data, first.data);
+    ASSERT_TRUE(r.read(out));
+    EXPECT_EQ(out.data, second.data);
+    EXPECT_FALSE(r.read(out));
+}
+
+TEST(Checkpoint, OutputDoesNotDependOnThreadCount) {
+    Signature sig(4, 0, 0, true);
+    Algebra alg(sig);
+    const std::size_t n = 4096;
+    MultivectorBatch b(alg, n);
+    for (std::size_t k = 0; k < b.data.size(); ++k) {
+        b.data[k] = std::sin(0.37f * static_cast<float>(k));
+    }
+
+    auto encode = [&] {
+        std::stringstream ss;
+        Options opt;
+        opt.chunkSize = 256;
+        Writer w(ss, alg, n, opt);
+        w.write(b);
+        w.write(b);
+        return ss.str();
+    };
+
+    const unsigned saved = parallel::threadCount();
+    parallel::setThreadCount(1);
+    const std::string serial = encode();
+    parallel::setThreadCount(4);
+    const std::string threaded = encode();
+    parallel::setThreadCount(saved);
+    EXPECT_EQ(serial, threaded);
+
+    std::stringstream in(threaded);
+    Reader r(in, alg);
+    MultivectorBatch out;
+    ASSERT_TRUE(r.read(out));
+    ASSERT_TRUE(r.read(out));
+    EXPECT_EQ(out.data, b.data);
+}
+
+TEST(Checkpoint, RejectsCorruptStreams) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    Signature sig2(2, 0, 0, true);
+    Algebra alg2(sig2);
+
+    std::stringstream bad("not a checkpoint stream at all");
+    EXPECT_THROW(Reader(bad, alg), std::runtime_error);
+
+    std::stringstream ss;
+    Writer w(ss, alg, 100);
+    MultivectorBatch b(alg, 100);
+    fillFrame(b, 1);
+    w.write(b);
+    const std::string bytes = ss.str();
+
+    std::stringstream wrongAlg(bytes);
+    EXPECT_THROW(Reader(wrongAlg, alg2), std::invalid_argument);
+
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 5));
+    Reader r(truncated, alg);
+    MultivectorBatch out;
+    EXPECT_THROW(r.read(out), std::runtime_error);
+
+    MultivectorBatch wrongCount(alg, 99);
+    EXPECT_THROW(w.write(wrongCount), std::invalid_argument);
+}
+
+// End test file
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/cliffordMatrix.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static CliffordMatrix filled(const Algebra& alg, std::size_t rows, std::size_t cols, float seed, unsigned grades = ~0u) {
+    CliffordMatrix M(alg, rows, cols);
+    for (std::size_t m = 0; m < M.bladeCount(); ++m) {
+        if (!((grades >> Blade::getGrade(static_cast<BladeMask>(m))) & 1u)) continue;
+        float* p = M.blade(static_cast<BladeMask>(m));
+        for (std::size_t i = 0; i < M.entries(); ++i) p[i] = std::sin(seed + 0.61f * i + 1.7f * m);
+    }
+    return M;
+}
+
+// Object-by-object reference: C_ij = sum_k A_ik B_kj with geometricProduct
+static Multivector referenceEntry(const CliffordMatrix& A, const CliffordMatrix& B, std::size_t i, std::size_t j) {
+    Multivector sum(*A.alg);
+    for (std::size_t k = 0; k < A.cols; ++k) sum = sum + geometricProduct(A.get(i, k), B.get(k, j));
+    return sum;
+}
+
+static void expectEntryNear(const CliffordMatrix& C, std::size_t i, std::size_t j, const Multivector& expect, double tol) {
+    const Multivector got = C.get(i, j);
+    for (std::size_t m = 0; m < C.bladeCount(); ++m) {
+        EXPECT_NEAR(got.storage[m], expect.storage[m], tol) << "entry " << i << "," << j << " blade " << m;
+    }
+}
+
+TEST(CliffordMatrix, StorageIsBladeMajor) {
+    Algebra e3(Signature(3, 0, 0, true));
+    CliffordMatrix M(e3, 3, 5);
+    EXPECT_EQ(M.entries(), 15u);
+    EXPECT_EQ(M.data.size(), 8u * 15u);
+    Multivector v(e3);
+    for (int m = 0; m < 8; ++m) v.setComponent(static_cast<BladeMask>(m), 1.0f + m);
+    M.set(2, 4, v);
+    EXPECT_EQ(M.blade(0b110)[2 * 5 + 4], 7.0f);
+    EXPECT_EQ(M.at(2, 4, 0b001), 2.0f);
+    EXPECT_EQ(M.get(2, 4).component(0b111), 8.0f);
+    EXPECT_THROW((void)M.get(3, 0), std::out_of_range);
+}
+
+TEST(CliffordMatrix, MultiplyMatchesEntryProducts) {
+    Algebra e3(Signature(3, 0, 0, true));
+    Algebra cga(Signature(4, 1, 0, true));
+    Algebra pga(Signature(3, 0, 1, true));
+    struct Case { const Algebra* alg; std::size_t m, k, n; };
+    // Shapes straddle the 32 x 64 x 64 tiles and the 4-row micro-kernel
+    for (const Case& c : {Case{&e3, 7, 13, 5}, Case{&e3, 70, 131, 67}, Case{&cga, 35, 9, 66}, Case{&pga, 6, 70, 3}}) {
+        const CliffordMatrix A = filled(*c.alg, c.m, c.k, 0.3f), B = filled(*c.alg, c.k, c.n, 1.9f);
+        CliffordMatrix C(*c.alg, c.m, c.n);
+        multiply(A, B, C);
+        for (std::size_t i = 0; i < c.m; i += 3) {
+            for (std::size_t j = 0; j < c.n; j += 4) {
+                expectEntryNear(C, i, j, referenceEntry(A, B, i, j), 1e-3 * std::sqrt(double(c.k)));
+            }
+        }
+    }
+}
+
+TEST(CliffordMatrix, AccumulateAndSparseBlades) {
+    Algebra e3(Signature(3, 0, 0, true));
+    // Even-only operands: odd blades of A and B are skipped, and the product stays even
+    const CliffordMatrix A = filled(e3, 9, 11, 0.4f, 0b0101), B = filled(e3, 11, 6, 2.2f, 0b0101);
+    CliffordMatrix C = filled(e3, 9, 6, 5.0f);
+    const CliffordMatrix C0 = C;
+    multiply(A, B, C, true);
+    for (std::size_t i = 0; i < 9; ++i) {
+        for (std::size_t j = 0; j < 6; ++j) {
+            expectEntryNear(C, i, j, C0.get(i, j) + referenceEntry(A, B, i, j), 1e-4);
+        }
+    }
+
+    multiply(A, B, C);
+    for (BladeMask odd : {0b001, 0b010, 0b100, 0b111}) {
+        for (std::size_t i = 0; i < C.entries(); ++i) EXPECT_EQ(C.blade(odd)[i], 0.0f);
+    }
+}
+
+TEST(CliffordMatrix, RejectsMismatchedOperands) {
+    Algebra e3(Signature(3, 0, 0, true));
+    Algebra e2(Signature(2, 0, 0, true));
+    CliffordMatrix A(e3, 4, 5), B(e3, 5, 3), C(e3, 4, 3), wrongShape(e3, 4, 4), other(e2, 5, 3);
+    EXPECT_THROW(multiply(A, other, C), std::invalid_argument);
+    EXPECT_THROW(multiply(A, B, wrongShape), std::invalid_argument);
+    EXPECT_THROW(multiply(A, A, C), std::invalid_argument);
+    CliffordMatrix S(e3, 4, 4);
+    EXPECT_THROW(multiply(S, S, S), std::invalid_argument);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/wedge.h"
+#include "ga/ops/inner.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/dual.h"
+#include "ga/ops/selective.h"
+#include "ga/versor.h"
+#include "ga/rotor.h"
+#include "ga/e2.h"
+#include "ga/e3.h"
+#include "ga/pga.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+// Basis constants are compile-time values
+static_assert(e3::e1.component(0b001) == 1.0);
+static_assert(e3::e123.component(0b111) == 1.0);
+static_assert(e2::e12.component(0b11) == 1.0);
+
+// Products of constants fold at compile time
+static_assert(geometricProduct(e3::e1, e3::e2).component(0b011) == 1.0);
+static_assert(geometricProduct(e3::e12, e3::e12).component(0) == -1.0);
+static_assert(wedge(e3::e1, e3::e23).component(0b111) == 1.0);
+static_assert(leftContraction(e3::e1, e3::e12).component(0b010) == 1.0);
+static_assert(reverse(e3::e12).component(0b011) == -1.0);
+static_assert(dual(e3::e1).component(0b110) != 0.0);
+static_assert(scalarProduct(e3::e12, reverse(e3::e12)) == 1.0);
+static_assert((2.0f * e3::e1 + e3::e2 - e3::e2).component(0b001) == 2.0);
+
+// A quarter turn in the e12 plane baked into the binary: (1 - e12) / sqrt(2)
+constexpr float HALF_SQRT2 = 0.70710678f;
+constexpr Rotor QUARTER_TURN{HALF_SQRT2 * (e3::scalar(1.0f) - e3::e12)};
+constexpr Multivector ROTATED_E1 = QUARTER_TURN.apply(e3::e1);
+static_assert(ROTATED_E1.component(0b010) > 0.999 && ROTATED_E1.component(0b001) < 1e-6);
+
+// Versor inverse is constexpr too
+constexpr Multivector INV_E1 = Versor(2.0f * e3::e1).inverse();
+static_assert(INV_E1.component(0b001) == 0.5);
+
+// PGA helpers
+constexpr Multivector ORIGIN = pga::point(0.0f, 0.0f, 0.0f);
+static_assert(ORIGIN.component(pga::E123) == 1.0);
+static_assert(pga::translator(2.0f, 0.0f, 0.0f).component(pga::E14) == 1.0);
+
+TEST(Constexpr, CompileTimeMatchesRuntime) {
+    // The same expressions evaluated at runtime give identical coefficients
+    Multivector rotated = QUARTER_TURN.apply(e3::e1);
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(rotated.storage[i], ROTATED_E1.storage[i]);
+    }
+
+    Multivector a = e3::e1 + 0.5f * e3::e23;
+    EXPECT_EQ(scalarProduct(a, reverse(a)), geometricProduct(a, reverse(a)).component(0));
+}
+
+// End test file
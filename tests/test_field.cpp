@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/field.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+using ga::field::Boundary;
+using ga::field::MultivectorField;
+using ga::field::Stencil;
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+// Largest |coefficient| outside grade k
+static float offGrade(const Multivector& a, int k) {
+    float worst = 0.0f;
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (Blade::getGrade(static_cast<BladeMask>(i)) != k) worst = std::max(worst, std::fabs(a.storage[i]));
+    }
+    return worst;
+}
+
+// Smooth, non-symmetric test data in every coefficient
+static MultivectorField smoothField(const Algebra& alg, std::size_t nx, std::size_t ny, std::size_t nz) {
+    MultivectorField F(alg, nx, ny, nz);
+    const std::size_t N = F.bladeCount();
+    for (std::size_t m = 0; m < N; ++m) {
+        for (std::size_t z = 0; z < nz; ++z)
+            for (std::size_t y = 0; y < ny; ++y)
+                for (std::size_t x = 0; x < nx; ++x)
+                    F.at(x, y, z, static_cast<BladeMask>(m)) =
+                            std::sin(0.3f * x + 0.5f * y * (1.0f + 0.1f * m) - 0.7f * z + 0.9f * m);
+    }
+    return F;
+}
+
+// Cell value with the boundary rule applied to out-of-grid indices
+static Multivector ghostCell(const MultivectorField& F, long x, long y, long z, Boundary b) {
+    const long n[3] = {static_cast<long>(F.nx), static_cast<long>(F.ny), static_cast<long>(F.nz)};
+    long c[3] = {x, y, z};
+    for (int d = 0; d < 3; ++d) {
+        if (c[d] >= 0 && c[d] < n[d]) continue;
+        if (b == Boundary::Zero) return Multivector(*F.alg);
+        if (b == Boundary::Periodic) c[d] = (c[d] + n[d]) % n[d];
+        else c[d] = c[d] < 0 ? 0 : n[d] - 1;
+    }
+    return F.get(c[0], c[1], c[2]);
+}
+
+// nabla F at one cell, one geometric product per direction
+static Multivector referenceDerivative(const MultivectorField& F, std::size_t x, std::size_t y, std::size_t z,
+                                       const Stencil& s) {
+    Multivector sum(*F.alg);
+    for (int d = 0; d < 3; ++d) {
+        if (s.axes[d] < 0) continue;
+        long p[3] = {long(x), long(y), long(z)}, m[3] = {long(x), long(y), long(z)};
+        ++p[d];
+        --m[d];
+        const Multivector dF = (0.5f / s.spacing[d]) *
+                               (ghostCell(F, p[0], p[1], p[2], s.boundary) + -1.0f * ghostCell(F, m[0], m[1], m[2], s.boundary));
+        Multivector recip(*F.alg);
+        recip.setComponent(Blade::getBasis(s.axes[d]), F.alg->signature.isPos(s.axes[d]) ? 1.0f : -1.0f);
+        sum = sum + geometricProduct(recip, dF);
+    }
+    return sum;
+}
+
+TEST(Field, StorageIsBladeMajor) {
+    Algebra e3(Signature(3, 0, 0, true));
+    MultivectorField F(e3, 5, 4, 3);
+    EXPECT_EQ(F.cells(), 60u);
+    EXPECT_EQ(F.data.size(), 8u * 60u);
+    EXPECT_EQ(F.index(2, 1, 2), (2u * 4u + 1u) * 5u + 2u);
+
+    Multivector v(e3);
+    for (int m = 0; m < 8; ++m) v.setComponent(static_cast<BladeMask>(m), 0.5f + m);
+    F.set(2, 1, 2, v);
+    expectNear(F.get(2, 1, 2), v, 0.0);
+    EXPECT_EQ(F.column(0b101)[F.index(2, 1, 2)], 5.5f);
+    EXPECT_EQ(F.at(2, 1, 2, 0b011), 3.5f);
+    EXPECT_EQ(F.at(0, 0, 0, 0b011), 0.0f);
+
+    F.fill(v);
+    expectNear(F.get(4, 3, 0), v, 0.0);
+
+    EXPECT_THROW((void)F.get(5, 0, 0), std::out_of_range);
+    Algebra e2(Signature(2, 0, 0, true));
+    EXPECT_THROW(F.set(0, 0, 0, Multivector(e2)), std::invalid_argument);
+}
+
+TEST(Field, DerivativeMatchesPerCellProducts) {
+    // Spacetime algebra: e0 timelike, spatial grid along e1, e2, e3
+    Algebra sta(Signature(1, 3, 0, true));
+    Algebra e3(Signature(3, 0, 0, true));
+    struct Case { const Algebra* alg; Stencil s; std::size_t nx, ny, nz; };
+    const Case cases[] = {
+            {&e3, Stencil{{0, 1, 2}, {1.0f, 0.5f, 2.0f}, Boundary::Periodic}, 7, 5, 4},
+            {&e3, Stencil{{0, 1, 2}, {1.0f, 1.0f, 1.0f}, Boundary::Zero}, 6, 3, 5},
+            {&sta, Stencil{{1, 2, 3}, {0.25f, 0.25f, 0.25f}, Boundary::Clamp}, 9, 4, 3},
+            {&sta, Stencil{{1, -1, 3}, {1.0f, 1.0f, 0.5f}, Boundary::Periodic}, 1, 6, 5},
+    };
+    for (const Case& c : cases) {
+        const MultivectorField F = smoothField(*c.alg, c.nx, c.ny, c.nz);
+        MultivectorField out(*c.alg, c.nx, c.ny, c.nz);
+        field::derivative(F, out, c.s);
+        for (std::size_t z = 0; z < c.nz; ++z)
+            for (std::size_t y = 0; y < c.ny; ++y)
+                for (std::size_t x = 0; x < c.nx; ++x)
+                    expectNear(out.get(x, y, z), referenceDerivative(F, x, y, z, c.s), 1e-5);
+    }
+}
+
+TEST(Field, DivergenceAndCurlSplitTheDerivative) {
+    Algebra e3(Signature(3, 0, 0, true));
+    const MultivectorField F = smoothField(e3, 8, 6, 5);
+    MultivectorField d(e3, 8, 6, 5), div(e3, 8, 6, 5), curl(e3, 8, 6, 5);
+    field::derivative(F, d);
+    field::divergence(F, div);
+    field::curl(F, curl);
+    for (std::size_t i = 0; i < d.data.size(); ++i) EXPECT_NEAR(d.data[i], div.data[i] + curl.data[i], 1e-6);
+
+    // Vector input: the divergence is a scalar field and the curl a bivector field
+    Stencil vectors;
+    vectors.grades = 1u << 1;
+    field::divergence(F, div, vectors);
+    field::curl(F, curl, vectors);
+    for (std::size_t z = 0; z < 5; ++z) {
+        for (std::size_t y = 0; y < 6; ++y) {
+            for (std::size_t x = 0; x < 8; ++x) {
+                EXPECT_EQ(offGrade(div.get(x, y, z), 0), 0.0f);
+                EXPECT_EQ(offGrade(curl.get(x, y, z), 2), 0.0f);
+            }
+        }
+    }
+
+    // div(x e1 + y e2 + z e3) = 3 and curl = 0 away from the boundary
+    MultivectorField X(e3, 6, 6, 6);
+    for (std::size_t z = 0; z < 6; ++z)
+        for (std::size_t y = 0; y < 6; ++y)
+            for (std::size_t x = 0; x < 6; ++x) {
+                X.at(x, y, z, 0b001) = float(x);
+                X.at(x, y, z, 0b010) = float(y);
+                X.at(x, y, z, 0b100) = float(z);
+            }
+    MultivectorField dX(e3, 6, 6, 6);
+    field::derivative(X, dX, Stencil{{0, 1, 2}, {1.0f, 1.0f, 1.0f}, Boundary::Clamp});
+    Multivector three(e3);
+    three.setComponent(0, 3.0f);
+    expectNear(dX.get(2, 3, 4), three, 1e-6);
+}
+
+TEST(Field, LaplacianOfPlaneWaves) {
+    // Periodic plane wave: the 3-point stencil has eigenvalue (2 cos(k h) - 2) / h^2 per axis
+    Algebra sta(Signature(1, 3, 0, true));
+    const std::size_t n = 16;
+    const float h = 0.5f, kx = 2.0f * 3.14159265f / (n * h), ky = 2.0f * kx;
+    MultivectorField F(sta, n, n, 2);
+    for (std::size_t z = 0; z < 2; ++z)
+        for (std::size_t y = 0; y < n; ++y)
+            for (std::size_t x = 0; x < n; ++x) F.at(x, y, z, 0b0110) = std::cos(kx * h * x + ky * h * y);
+
+    MultivectorField L(sta, n, n, 2);
+    const Stencil s{{1, 2, 3}, {h, h, h}, Boundary::Periodic};
+    field::laplacian(F, L, s);
+    // Spatial axes square to -1 in this signature, so nabla^2 = -(d_x^2 + d_y^2 + d_z^2)
+    const float lambda = -((2.0f * std::cos(kx * h) - 2.0f) + (2.0f * std::cos(ky * h) - 2.0f)) / (h * h);
+    for (std::size_t y = 0; y < n; ++y) {
+        for (std::size_t x = 0; x < n; ++x) {
+            EXPECT_NEAR(L.at(x, y, 1, 0b0110), lambda * F.at(x, y, 1, 0b0110), 1e-4);
+            EXPECT_EQ(L.at(x, y, 1, 0b0011), 0.0f);
+        }
+    }
+
+    // Zero boundary: a constant field sees the drop to zero only at the faces
+    Algebra e3(Signature(3, 0, 0, true));
+    MultivectorField C(e3, 4, 4, 4), LC(e3, 4, 4, 4);
+    Multivector one(e3);
+    one.setComponent(0, 1.0f);
+    C.fill(one);
+    field::laplacian(C, LC, Stencil{{0, 1, 2}, {1.0f, 1.0f, 1.0f}, Boundary::Zero});
+    EXPECT_FLOAT_EQ(LC.at(1, 2, 1, 0), 0.0f);
+    EXPECT_FLOAT_EQ(LC.at(0, 2, 1, 0), -1.0f);
+    EXPECT_FLOAT_EQ(LC.at(0, 0, 3, 0), -3.0f);
+    field::laplacian(C, LC, Stencil{{0, 1, 2}, {1.0f, 1.0f, 1.0f}, Boundary::Clamp});
+    EXPECT_FLOAT_EQ(LC.at(0, 0, 3, 0), 0.0f);
+}
+
+TEST(Field, InvalidStencilsThrow) {
+    Algebra e3(Signature(3, 0, 0, true));
+    Algebra pga(Signature(3, 0, 1, true));
+    MultivectorField F(e3, 4, 4, 4), out(e3, 4, 4, 4), small(e3, 4, 4, 2);
+    EXPECT_THROW(field::derivative(F, small), std::invalid_argument);
+    EXPECT_THROW(field::derivative(F, F), std::invalid_argument);
+    EXPECT_THROW(field::laplacian(F, out, Stencil{{0, 1, 3}}), std::invalid_argument);
+    EXPECT_THROW(field::curl(F, out, Stencil{{0, 1, 2}, {1.0f, 0.0f, 1.0f}}), std::invalid_argument);
+
+    // The projective axis e3 (index 3 here) has no reciprocal vector
+    MultivectorField P(pga, 4, 4, 4), Pout(pga, 4, 4, 4);
+    EXPECT_THROW(field::divergence(P, Pout, Stencil{{0, 1, 3}}), std::invalid_argument);
+    EXPECT_NO_THROW(field::divergence(P, Pout, Stencil{{0, 1, 2}}));
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/frame.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/inner.h"
+#include "ga/ops/wedge.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector vec(const Algebra& alg, float seed) {
+    Multivector v(alg);
+    for (int k = 0; k < alg.dimensions; ++k) v.setComponent(Blade::getBasis(k), std::sin(seed * (k + 1) + 1.7f * k) + (k == 0 ? 1.5f : 0.0f));
+    return v;
+}
+
+static double dot(const Multivector& a, const Multivector& b) {
+    return inner(a, b).component(0);
+}
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+TEST(Frame, ReciprocalFrameIsDual) {
+    const Signature sigs[] = {Signature(3, 0, 0, true), Signature(1, 3, 0, true), Signature(4, 1, 0, true)};
+    for (const Signature& sig : sigs) {
+        Algebra alg(sig);
+        std::vector<Multivector> vs;
+        for (int i = 0; i < alg.dimensions; ++i) vs.push_back(vec(alg, 0.9f * i));
+        const Frame F(alg, vs);
+
+        ASSERT_EQ(F.size(), alg.dimensions);
+        for (int i = 0; i < F.size(); ++i) {
+            for (int j = 0; j < F.size(); ++j) {
+                EXPECT_NEAR(dot(F.reciprocal(i), F.vector(j)), i == j ? 1.0 : 0.0, 1e-4);
+                EXPECT_NEAR(F.gram(i, j), dot(vs[i], vs[j]), 1e-5);
+            }
+        }
+
+        // Reciprocal of the reciprocal is the frame itself
+        const Frame R = F.reciprocalFrame();
+        for (int i = 0; i < F.size(); ++i) expectNear(R.reciprocal(i), vs[i], 1e-4);
+    }
+}
+
+TEST(Frame, PseudoscalarAndVolume) {
+    Algebra alg(Signature(3, 0, 0, true));
+    const Multivector a = vec(alg, 0.1f), b = vec(alg, 1.2f), c = vec(alg, 2.6f);
+    const Frame F(alg, {a, b, c});
+
+    const Multivector I = wedge(wedge(a, b), c);
+    expectNear(F.pseudoscalar(), I, 1e-5);
+    EXPECT_NEAR(F.volume(), std::fabs(I.component(0b111)), 1e-5);
+    EXPECT_NEAR(F.gramDeterminant(), I.component(0b111) * I.component(0b111), 1e-4);
+
+    // Partial frame: a plane in E3
+    const Frame P(alg, {a, b});
+    expectNear(P.pseudoscalar(), wedge(a, b), 1e-5);
+}
+
+TEST(Frame, ComponentsRoundTrip) {
+    Algebra alg(Signature(1, 3, 0, true));
+    const Frame F(alg, {vec(alg, 0.3f), vec(alg, 1.1f), vec(alg, 2.0f), vec(alg, 3.3f)});
+    const Multivector v = vec(alg, 5.0f);
+
+    expectNear(F.fromContravariant(F.contravariant(v)), v, 1e-4);
+    expectNear(F.fromCovariant(F.covariant(v)), v, 1e-4);
+
+    // In a partial frame, vectors in the span round-trip
+    Algebra e3(Signature(3, 0, 0, true));
+    const Multivector a = vec(e3, 0.4f), b = vec(e3, 1.9f);
+    const Frame P(e3, {a, b});
+    const Multivector w = 0.7f * a + -1.3f * b;
+    const std::vector<float> c = P.contravariant(w);
+    EXPECT_NEAR(c[0], 0.7f, 1e-5);
+    EXPECT_NEAR(c[1], -1.3f, 1e-5);
+    expectNear(P.fromContravariant(c), w, 1e-5);
+}
+
+TEST(Frame, RejectsDegenerateFrames) {
+    Algebra e3(Signature(3, 0, 0, true));
+    const Multivector a = vec(e3, 0.4f);
+    EXPECT_THROW(Frame(e3, {a, 2.0f * a}), std::runtime_error);
+    EXPECT_THROW(Frame(e3, std::vector<Multivector>{}), std::invalid_argument);
+
+    // Indexed accessors reject indices outside the frame
+    const Frame F(e3, {a});
+    EXPECT_THROW((void)F.gram(0, 1), std::out_of_range);
+    EXPECT_THROW((void)F.gram(-1, 0), std::out_of_range);
+    EXPECT_THROW((void)F.vector(1), std::out_of_range);
+
+    Algebra pga(Signature(3, 0, 1, true));
+    Multivector e4(pga);
+    e4.setComponent(0b1000, 1.0f);
+    EXPECT_THROW(Frame(pga, {e4}), std::runtime_error);
+}
+
+TEST(FrameBatch, MatchesSingleFrames) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t count = 500;
+    const int k = 3;
+    FrameBatch frames(alg, k, count);
+    MultivectorBatch vs(alg, count);
+    for (std::size_t e = 0; e < count; ++e) {
+        for (int i = 0; i < k; ++i) frames.setVector(e, i, vec(alg, 0.013f * static_cast<float>(e) + 1.3f * i));
+        vs.set(e, vec(alg, 4.0f + 0.01f * static_cast<float>(e)));
+    }
+
+    const FrameBatch recip = frames.reciprocal();
+    std::vector<float> contra, co;
+    recip.project(vs, contra);
+    frames.project(vs, co);
+
+    for (std::size_t e = 0; e < count; e += 37) {
+        const Frame F = frames.get(e);
+        const std::vector<float> c = F.contravariant(vs.get(e));
+        const std::vector<float> d = F.covariant(vs.get(e));
+        for (int i = 0; i < k; ++i) {
+            expectNear(recip.vector(e, i), F.reciprocal(i), 1e-4);
+            EXPECT_NEAR(contra[i * count + e], c[i], 1e-4);
+            EXPECT_NEAR(co[i * count + e], d[i], 1e-5);
+        }
+    }
+
+    // k is checked before the storage is sized, so a negative k cannot wrap into a huge allocation
+    EXPECT_THROW(FrameBatch(alg, 0, 4), std::invalid_argument);
+    EXPECT_THROW(FrameBatch(alg, -1, std::size_t{1} << 40), std::invalid_argument);
+    EXPECT_THROW(FrameBatch(alg, alg.dimensions + 1, 4), std::invalid_argument);
+
+    FrameBatch bad(alg, 2, 2);
+    bad.setVector(0, 0, vec(alg, 0.5f));
+    bad.setVector(0, 1, vec(alg, 1.5f));
+    EXPECT_THROW((void)bad.reciprocal(), std::runtime_error);
+}
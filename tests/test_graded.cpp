@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/wedge.h"
+#include "ga/ops/inner.h"
+#include "ga/graded.h"
+
+using namespace ga;
+using namespace ga::graded;
+
+using E3 = StaticAlgebra<3>;
+using PGA = StaticAlgebra<3, 0, 1>;
+using STA = StaticAlgebra<1, 3>;
+
+// Result grades are inferred at compile time
+static_assert(std::is_same_v<decltype(Vector<E3>{} ^ Vector<E3>{}), Bivector<E3>>);
+static_assert(std::is_same_v<decltype(Vector<E3>{} * Vector<E3>{}), Graded<E3, grade(0) | grade(2)>>);
+static_assert(std::is_same_v<decltype(Vector<E3>{} << Bivector<E3>{}), Vector<E3>>);
+static_assert(std::is_same_v<decltype(Trivector<E3>{} ^ Vector<E3>{}), Graded<E3, 0>>);
+static_assert(std::is_same_v<decltype(Even<E3>{} * Even<E3>{}), Even<E3>>);
+static_assert(Vector<E3>::size == 3 && Even<PGA>::size == 8);
+
+// Terms that vanish in the metric are dropped: in Cl(0,0,1) e1 e1 = 0, so vector * vector is empty
+using Null1 = StaticAlgebra<0, 0, 1>;
+static_assert(std::is_same_v<decltype(Vector<Null1>{} * Vector<Null1>{}), Graded<Null1, 0>>);
+
+// Products of constants evaluate at compile time
+constexpr auto e1 = basis<E3, 0b001>();
+constexpr auto e2 = basis<E3, 0b010>();
+constexpr auto e12 = e1 * e2;
+static_assert(e12.component(0b011) == 1.0f && e12.component(0) == 0.0f);
+static_assert((e2 * e1).component(0b011) == -1.0f);
+static_assert((e12 * e12).component(0) == -1.0f);
+static_assert((~e12).component(0b011) == -1.0f);
+
+template <class G>
+static G fill(float seed) {
+    G g;
+    for (std::size_t k = 0; k < G::size; ++k) g.c[k] = std::sin(seed + 0.9f * static_cast<float>(k));
+    return g;
+}
+
+template <class G>
+static void expectMatches(const G& g, const Multivector& m) {
+    const std::size_t N = static_cast<std::size_t>(1) << m.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        EXPECT_NEAR(g.component(static_cast<BladeMask>(i)), m.storage[i], 1e-5) << "blade " << i;
+    }
+}
+
+TEST(Graded, ProductsMatchRuntimeOps) {
+    const auto a = fill<Even<STA>>(0.2f);
+    const auto b = fill<Graded<STA, grade(1) | grade(3)>>(1.1f);
+    const Multivector A = a.toMultivector();
+    const Multivector B = b.toMultivector();
+
+    expectMatches(a * b, ops::geometricProduct(A, B));
+    expectMatches(a ^ b, ops::wedge(A, B));
+    expectMatches(a & b, ops::inner(A, B));
+    expectMatches(a << b, ops::leftContraction(A, B));
+    expectMatches(a >> b, ops::rightContraction(A, B));
+}
+
+TEST(Graded, DegenerateMetricAndConversions) {
+    const auto m = fill<Even<PGA>>(0.7f);
+    const auto p = fill<Trivector<PGA>>(2.3f);
+    expectMatches(m * p, ops::geometricProduct(m.toMultivector(), p.toMultivector()));
+
+    // Widening conversion and projection round trip
+    const Full<PGA> wide = p;
+    EXPECT_EQ(wide.component(0b0111), p.component(0b0111));
+    const auto back = Trivector<PGA>::fromMultivector(wide.toMultivector());
+    EXPECT_EQ(back.c, p.c);
+    EXPECT_EQ(gradePart<3>(wide).c, p.c);
+
+    Vector<PGA> v;
+    EXPECT_THROW(v.setComponent(0b0011, 1.0f), std::out_of_range);
+}
+
+// End test file
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/hierarchy.h"
+#include "ga/parallel.h"
+#include "ga/pga.h"
+#include "ga/rotor.h"
+#include "ga/spline.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+// Unit motor (or E3 rotor) exp(B) for a bivector with small, seed-dependent coefficients
+static Multivector motor(const Algebra& alg, float seed) {
+    static constexpr BladeMask masks[] = {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100};
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    Multivector B(alg);
+    for (int k = 0; k < 6; ++k) {
+        if (masks[k] < N) B.setComponent(masks[k], 0.4f * std::sin(seed + 1.3f * k));
+    }
+    return spline::motorExp(B);
+}
+
+// Random-looking tree: node i hangs off one of the previous nodes
+static std::vector<std::uint32_t> treeParents(std::size_t n) {
+    std::vector<std::uint32_t> parents(n, TransformHierarchy::NO_PARENT);
+    for (std::size_t i = 1; i < n; ++i) {
+        if (i % 17 != 0) parents[i] = static_cast<std::uint32_t>((i * 7919u) % i);
+    }
+    return parents;
+}
+
+// World transforms by dense products up each chain
+static Multivector chainProduct(const TransformHierarchy& h, std::size_t i) {
+    Multivector W = h.local(i);
+    for (std::uint32_t p = h.parent(i); p != TransformHierarchy::NO_PARENT; p = h.parent(p)) {
+        W = geometricProduct(h.local(p), W);
+    }
+    return W;
+}
+
+TEST(TransformHierarchy, WorldIsProductDownTheTree) {
+    const std::vector<std::uint32_t> parents = treeParents(300);
+    std::vector<Multivector> locals;
+    for (std::size_t i = 0; i < parents.size(); ++i) locals.push_back(motor(pga::algebra, 0.37f * i));
+
+    TransformHierarchy h(pga::algebra, parents, locals);
+    EXPECT_TRUE(h.dirty());
+    EXPECT_EQ(h.update(), 300u);
+    EXPECT_FALSE(h.dirty());
+    for (std::size_t i = 0; i < h.size(); i += 7) expectNear(h.world(i), chainProduct(h, i), 2e-5);
+    EXPECT_EQ(h.depth(0), 0u);
+
+    const Algebra e3(Signature(3, 0, 0, true));
+    TransformHierarchy r(e3);
+    const std::uint32_t root = r.add(TransformHierarchy::NO_PARENT, motor(e3, 0.1f));
+    const std::uint32_t arm = r.add(root, motor(e3, 0.2f));
+    const std::uint32_t hand = r.add(arm, motor(e3, 0.3f));
+    EXPECT_EQ(r.depth(hand), 2u);
+    EXPECT_EQ(r.update(), 3u);
+    expectNear(r.world(hand), chainProduct(r, hand), 1e-6);
+}
+
+TEST(TransformHierarchy, UpdateRecomputesOnlyChangedSubtrees) {
+    // 0 -> {1 -> {3, 4 -> 6}, 2 -> 5}, plus a separate root 7
+    const std::vector<std::uint32_t> parents = {TransformHierarchy::NO_PARENT, 0, 0, 1, 1, 2, 4,
+                                                TransformHierarchy::NO_PARENT};
+    std::vector<Multivector> locals;
+    for (std::size_t i = 0; i < parents.size(); ++i) locals.push_back(motor(pga::algebra, 0.9f * i));
+    TransformHierarchy h(pga::algebra, parents, locals);
+    EXPECT_EQ(h.update(), 8u);
+    EXPECT_EQ(h.update(), 0u);
+
+    h.setLocal(4, motor(pga::algebra, 5.0f));
+    EXPECT_EQ(h.update(), 2u);  // 4 and 6
+
+    h.setLocal(6, motor(pga::algebra, 6.0f));
+    h.setLocal(1, motor(pga::algebra, 7.0f));
+    h.setLocal(6, motor(pga::algebra, 8.0f));
+    EXPECT_EQ(h.update(), 4u);  // 1, 3, 4, 6 once each
+
+    h.setLocal(7, motor(pga::algebra, 9.0f));
+    EXPECT_EQ(h.update(), 1u);
+    for (std::size_t i = 0; i < h.size(); ++i) expectNear(h.world(i), chainProduct(h, i), 1e-5);
+
+    // A wide tree across threads matches a fresh build
+    const unsigned threads = ga::parallel::threadCount();
+    ga::parallel::setThreadCount(4);
+    const std::vector<std::uint32_t> wide = treeParents(5000);
+    std::vector<Multivector> wideLocals;
+    for (std::size_t i = 0; i < wide.size(); ++i) wideLocals.push_back(motor(pga::algebra, 0.11f * i));
+    TransformHierarchy w(pga::algebra, wide, wideLocals);
+    (void)w.update();
+    for (std::size_t i = 0; i < wide.size(); i += 97) {
+        wideLocals[i] = motor(pga::algebra, -0.3f * i);
+        w.setLocal(i, wideLocals[i]);
+    }
+    (void)w.update();
+    TransformHierarchy fresh(pga::algebra, wide, wideLocals);
+    (void)fresh.update();
+    ga::parallel::setThreadCount(threads);
+    for (std::size_t i = 0; i < wide.size(); ++i) {
+        for (int k = 0; k < 8; ++k) ASSERT_EQ(w.worldMotor(i)[k], fresh.worldMotor(i)[k]) << "node " << i;
+    }
+}
+
+TEST(TransformHierarchy, ExportsMatricesAndBatches) {
+    const std::vector<std::uint32_t> parents = {TransformHierarchy::NO_PARENT, 0, 1};
+    const std::vector<Multivector> locals = {geometricProduct(pga::translator(1.0f, -2.0f, 0.5f), motor(pga::algebra, 0.4f)),
+                                             motor(pga::algebra, 1.1f), pga::translator(0.0f, 3.0f, 0.0f)};
+    TransformHierarchy h(pga::algebra, parents, locals);
+    (void)h.update();
+
+    const std::vector<float> mats = h.worldMatrices();
+    ASSERT_EQ(mats.size(), 48u);
+    for (std::size_t n = 0; n < 3; ++n) {
+        const float* M = &mats[16 * n];
+        EXPECT_NEAR(M[12], 0.0f, 1e-6);
+        EXPECT_NEAR(M[15], 1.0f, 1e-5);
+        for (const auto& p : {std::array<float, 3>{0.0f, 0.0f, 0.0f}, std::array<float, 3>{1.5f, -0.5f, 2.0f}}) {
+            const Multivector W = h.world(n);
+            float x, y, z;
+            pga::pointCoordinates(geometricProduct(geometricProduct(W, pga::point(p[0], p[1], p[2])), reverse(W)), x, y, z);
+            const float got[3] = {M[0] * p[0] + M[1] * p[1] + M[2] * p[2] + M[3],
+                                  M[4] * p[0] + M[5] * p[1] + M[6] * p[2] + M[7],
+                                  M[8] * p[0] + M[9] * p[1] + M[10] * p[2] + M[11]};
+            EXPECT_NEAR(got[0], x, 1e-5);
+            EXPECT_NEAR(got[1], y, 1e-5);
+            EXPECT_NEAR(got[2], z, 1e-5);
+        }
+    }
+
+    // E3: the upper 3 x 3 block is the rotation of vectors
+    const Algebra e3(Signature(3, 0, 0, true));
+    TransformHierarchy r(e3);
+    (void)r.add(TransformHierarchy::NO_PARENT, motor(e3, 2.0f));
+    (void)r.update();
+    float M[16];
+    r.worldMatrix(0, M);
+    const Rotor R(r.world(0));
+    for (int col = 0; col < 3; ++col) {
+        Multivector e(e3);
+        e.setComponent(Blade::getBasis(col), 1.0f);
+        const Multivector v = R.apply(e);
+        for (int row = 0; row < 3; ++row) EXPECT_NEAR(M[row * 4 + col], v.component(Blade::getBasis(row)), 1e-6);
+        EXPECT_EQ(M[col * 4 + 3], 0.0f);
+    }
+
+    MultivectorBatch batch(pga::algebra, 3);
+    h.worldTransforms(batch);
+    for (std::size_t n = 0; n < 3; ++n) expectNear(batch.get(n), h.world(n), 0.0);
+    MultivectorBatch wrong(pga::algebra, 2);
+    EXPECT_THROW(h.worldTransforms(wrong), std::invalid_argument);
+}
+
+TEST(TransformHierarchy, RejectsInvalidInput) {
+    EXPECT_THROW(TransformHierarchy(Algebra(Signature(4, 1, 0, true))), std::invalid_argument);
+    TransformHierarchy h(pga::algebra);
+    EXPECT_THROW((void)h.add(0, motor(pga::algebra, 0.0f)), std::invalid_argument);
+    (void)h.add(TransformHierarchy::NO_PARENT, motor(pga::algebra, 0.0f));
+    EXPECT_THROW((void)h.add(1, motor(pga::algebra, 0.0f)), std::invalid_argument);
+    EXPECT_THROW(h.setLocal(1, motor(pga::algebra, 0.0f)), std::out_of_range);
+    const Algebra e3(Signature(3, 0, 0, true));
+    EXPECT_THROW(h.setLocal(0, motor(e3, 0.0f)), std::invalid_argument);
+    EXPECT_THROW(TransformHierarchy(pga::algebra, {TransformHierarchy::NO_PARENT}, {}), std::invalid_argument);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/linearMap.h"
+#include "ga/parallel.h"
+
+using namespace ga;
+
+// A fixed, non-orthogonal map with non-trivial minors
+static LinearMap makeMap(const Algebra& alg) {
+    LinearMap L(alg);
+    const int dims = alg.dimensions;
+    for (int r = 0; r < dims; ++r)
+        for (int c = 0; c < dims; ++c)
+            L.set(r, c, 0.3f * static_cast<float>(r + 1) - 0.2f * static_cast<float>(c) + (r == c ? 1.0f : 0.0f));
+    return L;
+}
+
+// A multivector with every coefficient of one grade set
+static Multivector gradeInput(const Algebra& alg, int grade) {
+    Multivector A(alg);
+    for (BladeMask m : gradeBlades(alg.dimensions, grade))
+        A.setComponent(m, 0.5f + 0.25f * static_cast<float>(m));
+    return A;
+}
+
+// -----------------------------------------------------------------------------
+// Compound (grade-k) outermorphism
+// -----------------------------------------------------------------------------
+
+TEST(LinearMap, CompoundMatchesOutermorphismEveryGrade) {
+    for (int dims : {3, 4, 5}) {
+        Signature sig(dims, 0, 0, true);
+        Algebra alg(sig);
+        LinearMap L = makeMap(alg);
+
+        for (int k = 0; k <= dims; ++k) {
+            Multivector A = gradeInput(alg, k);
+            Multivector full = L.apply(A);
+            Multivector fast = L.compound(k).apply(A);
+
+            const std::size_t N = (1u << dims);
+            for (std::size_t i = 0; i < N; ++i) {
+                EXPECT_NEAR(fast.component(static_cast<BladeMask>(i)),
+                            full.component(static_cast<BladeMask>(i)), 1e-4)
+                    << "dims=" << dims << " grade=" << k << " blade=" << i;
+            }
+        }
+    }
+}
+
+TEST(LinearMap, PseudoscalarScalesByDeterminant) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    LinearMap L(alg);
+    L.set(0, 0, 2.0f);
+    L.set(1, 1, 3.0f);
+    L.set(2, 2, 0.5f);
+    L.set(0, 1, 7.0f); // upper triangular: det unchanged
+
+    CompoundMap top = L.compound(3);
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_NEAR(top.m[0], 3.0f, 1e-6);
+}
+
+TEST(LinearMap, GradeBatchMatchesSingle) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    LinearMap L = makeMap(alg);
+    CompoundMap normals = L.compound(2);
+
+    const unsigned threads = ga::parallel::threadCount();
+    ga::parallel::setThreadCount(4);
+    // Not a multiple of the tile size; the larger batch spans several threads
+    for (const std::size_t n : {std::size_t{131}, std::size_t{64 * 48 + 5}}) {
+        MultivectorBatch in(alg, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            Multivector A(alg);
+            A.setComponent(0b011, 0.01f * static_cast<float>(i % 200));
+            A.setComponent(0b101, 1.0f - 0.02f * static_cast<float>(i % 200));
+            A.setComponent(0b110, 0.5f);
+            A.setComponent(0b001, 9.0f); // other grades are left alone
+            in.set(i, A);
+        }
+
+        MultivectorBatch out = in;
+        normals.apply(out, out); // in place
+
+        for (std::size_t i = 0; i < n; ++i) {
+            Multivector expect = normals.apply(in.get(i));
+            for (BladeMask m : normals.masks)
+                EXPECT_NEAR(out.at(i, m), expect.component(m), 1e-5);
+            EXPECT_EQ(out.at(i, 0b001), 9.0f);
+        }
+    }
+    ga::parallel::setThreadCount(threads);
+}
+
+TEST(LinearMap, CompoundRejectsBadGrade) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    LinearMap L(alg);
+    EXPECT_THROW(L.compound(4), std::out_of_range);
+    EXPECT_THROW(L.compound(-1), std::out_of_range);
+}
+
+// End test file
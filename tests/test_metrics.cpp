@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/autotune.h"
+#include "ga/metrics.h"
+#include "ga/productMatrix.h"
+#include "ga/rotor.h"
+#include "ga/versor.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/inner.h"
+#include "ga/ops/reflect.h"
+#include "ga/ops/wedge.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) m.storage[i] = std::sin(seed + 0.37f * static_cast<float>(i));
+    return m;
+}
+
+// Enable recording for one test and restore the previous state afterwards
+struct MetricsOn {
+    bool previous = metrics::enabled();
+    MetricsOn() {
+        metrics::setEnabled(true);
+        metrics::reset();
+    }
+    ~MetricsOn() { metrics::setEnabled(previous); }
+};
+
+TEST(Metrics, DisabledRecordsNothing) {
+    const bool previous = metrics::enabled();
+    metrics::setEnabled(false);
+    metrics::reset();
+
+    Algebra alg(Signature(3, 0, 0, true));
+    (void)geometricProduct(dense(alg, 0.1f), dense(alg, 0.7f));
+    metrics::add(metrics::Counter::BatchCalls, 5);
+    metrics::record(metrics::Histogram::BatchSize, 100);
+    metrics::peak(metrics::Gauge::BatchBytesPeak, 1000);
+
+    const metrics::Snapshot s = metrics::snapshot();
+    EXPECT_EQ(s[metrics::Counter::Products], 0u);
+    EXPECT_EQ(s[metrics::Counter::BatchCalls], 0u);
+    EXPECT_EQ(s[metrics::Histogram::BatchSize].count, 0u);
+    EXPECT_EQ(s[metrics::Gauge::BatchBytesPeak], 0u);
+    metrics::setEnabled(previous);
+}
+
+TEST(Metrics, CountsProductsPerKernel) {
+    MetricsOn on;
+    Algebra alg(Signature(4, 1, 0, true));
+    autotune::select(alg, autotune::Kernel::Sparse);
+    const Multivector A = dense(alg, 0.3f), B = dense(alg, 1.1f);
+    for (int i = 0; i < 640; ++i) (void)geometricProduct(A, B);
+    autotune::reset();
+
+    const metrics::Snapshot s = metrics::snapshot();
+    EXPECT_EQ(s[metrics::Counter::Products], 640u);
+    EXPECT_EQ(s[metrics::Counter::ProductsSparse], 640u);
+    EXPECT_EQ(s[metrics::Counter::ProductsTable], 0u);
+
+    // One call in SAMPLE_PERIOD is timed
+    const metrics::HistogramData& t = s[metrics::Histogram::ProductNanosSparse];
+    EXPECT_EQ(t.count, 640u / metrics::SAMPLE_PERIOD);
+    EXPECT_GT(t.sum, 0u);
+    EXPECT_GE(t.quantile(0.99), t.quantile(0.5));
+}
+
+static std::uint64_t perOperationTotal(const metrics::Snapshot& s) {
+    std::uint64_t total = 0;
+    for (int c = static_cast<int>(metrics::Counter::ProductsGeometric);
+         c <= static_cast<int>(metrics::Counter::ProductsFiltered); ++c) {
+        total += s.counters[c];
+    }
+    return total;
+}
+
+TEST(Metrics, CountsCallsPerOperation) {
+    MetricsOn on;
+    Algebra alg(Signature(3, 0, 0, true));
+    const Multivector A = dense(alg, 0.3f), B = dense(alg, 1.1f);
+    for (int i = 0; i < 3; ++i) (void)geometricProduct(A, B);
+    for (int i = 0; i < 2; ++i) (void)wedge(A, B);
+    (void)inner(A, B);
+    (void)leftContraction(A, B);
+    (void)rightContraction(A, B);
+    (void)geometricProductFiltered(A, B, +[](int, int, int gradeR) { return gradeR == 0; });
+
+    metrics::Snapshot s = metrics::snapshot();
+    EXPECT_EQ(s[metrics::Counter::ProductsGeometric], 3u);
+    EXPECT_EQ(s[metrics::Counter::ProductsWedge], 2u);
+    EXPECT_EQ(s[metrics::Counter::ProductsInner], 1u);
+    EXPECT_EQ(s[metrics::Counter::ProductsLeftContraction], 1u);
+    EXPECT_EQ(s[metrics::Counter::ProductsRightContraction], 1u);
+    EXPECT_EQ(s[metrics::Counter::ProductsFiltered], 1u);
+    EXPECT_EQ(perOperationTotal(s), s[metrics::Counter::Products]);
+    EXPECT_EQ(s[metrics::Counter::Sandwiches], 0u);
+
+    // Sandwiches count once per call; the products inside them still count as products
+    metrics::reset();
+    Multivector e1(alg), e2(alg);
+    e1.setComponent(0b001, 1.0f);
+    e2.setComponent(0b010, 1.0f);
+    const Rotor R = Rotor::fromPlaneAngle(e1, e2, 0.4f);
+    (void)R.apply(A);
+    (void)Versor(R.value()).apply(A);
+    (void)reflect(A, e2);
+    s = metrics::snapshot();
+    EXPECT_EQ(s[metrics::Counter::Sandwiches], 3u);
+    EXPECT_EQ(perOperationTotal(s), s[metrics::Counter::Products]);
+    EXPECT_STREQ(metrics::name(metrics::Counter::Sandwiches), "sandwiches");
+}
+
+TEST(Metrics, MergesThreadShards) {
+    MetricsOn on;
+    const int threads = 8, adds = 10000;
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; ++i) {
+        pool.emplace_back([&, i] {
+            for (int k = 0; k < adds; ++k) metrics::add(metrics::Counter::ParallelChunks);
+            metrics::record(metrics::Histogram::BatchSize, static_cast<std::uint64_t>(1) << i);
+        });
+    }
+    for (auto& t : pool) t.join();
+
+    // Exited threads' counts are kept
+    const metrics::Snapshot s = metrics::snapshot();
+    EXPECT_EQ(s[metrics::Counter::ParallelChunks], static_cast<std::uint64_t>(threads) * adds);
+    const metrics::HistogramData& h = s[metrics::Histogram::BatchSize];
+    EXPECT_EQ(h.count, static_cast<std::uint64_t>(threads));
+    EXPECT_EQ(h.sum, 255u);
+    for (int i = 0; i < threads; ++i) EXPECT_EQ(h.buckets[i + 1], 1u) << "bucket " << i + 1;
+
+    metrics::reset();
+    EXPECT_EQ(metrics::snapshot()[metrics::Counter::ParallelChunks], 0u);
+}
+
+TEST(Metrics, BatchKernelsAndPeaks) {
+    MetricsOn on;
+    Algebra alg(Signature(3, 0, 0, true));
+    MultivectorBatch in(alg, 1000), out(alg, 1000);
+    const ProductMatrix pm = ProductMatrix::left(dense(alg, 0.5f));
+    pm.apply(in, out);
+    pm.apply(in, out);
+
+    const metrics::Snapshot s = metrics::snapshot();
+    EXPECT_EQ(s[metrics::Counter::BatchCalls], 2u);
+    EXPECT_EQ(s[metrics::Counter::BatchElements], 2000u);
+    EXPECT_EQ(s[metrics::Histogram::BatchSize].buckets[10], 2u);  // 1000 is in [512, 1024)
+    EXPECT_EQ(s[metrics::Gauge::BatchBytesPeak], 8u * 1000u * sizeof(float));
+    EXPECT_GT(s[metrics::Gauge::ScratchBytesPeak], 0u);
+
+    const std::string text = metrics::format(s);
+    EXPECT_NE(text.find("gasmith_batch_calls 2\n"), std::string::npos);
+    EXPECT_NE(text.find("gasmith_batch_size_count 2\n"), std::string::npos);
+}
+
+#if GASMITH_METRICS_SHM
+TEST(Metrics, SharedMemoryExport) {
+    MetricsOn on;
+    const std::string name = metrics::sharedName() + ".test";
+    ASSERT_TRUE(metrics::startSharedExport(name, std::chrono::milliseconds(10)));
+
+    metrics::add(metrics::Counter::AutotuneRuns, 3);
+    ASSERT_TRUE(metrics::publishShared());
+
+    metrics::Snapshot remote;
+    std::uint32_t pid = 0;
+    ASSERT_TRUE(metrics::readShared(name, remote, &pid));
+    EXPECT_EQ(remote[metrics::Counter::AutotuneRuns], 3u);
+    EXPECT_EQ(pid, static_cast<std::uint32_t>(::getpid()));
+
+    // Periodic publishing picks up later changes without an explicit publish
+    metrics::add(metrics::Counter::AutotuneRuns, 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(metrics::readShared(name, remote));
+    EXPECT_EQ(remote[metrics::Counter::AutotuneRuns], 5u);
+
+    metrics::stopSharedExport();
+    EXPECT_FALSE(metrics::readShared(name, remote));
+    EXPECT_FALSE(metrics::publishShared());
+}
+#endif
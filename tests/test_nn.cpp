@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/cliffordMatrix.h"
+#include "ga/nn.h"
+#include "ga/random.h"
+#include "ga/rotor.h"
+#include "ga/ops/geometric.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static CliffordMatrix filled(const Algebra& alg, std::size_t rows, std::size_t cols, float seed) {
+    CliffordMatrix M(alg, rows, cols);
+    for (std::size_t i = 0; i < M.data.size(); ++i) M.data[i] = std::sin(seed + 0.61f * i);
+    return M;
+}
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+// Every entry rotated by R
+static CliffordMatrix rotated(const CliffordMatrix& X, const Rotor& R) {
+    CliffordMatrix Y(*X.alg, X.rows, X.cols);
+    for (std::size_t r = 0; r < X.rows; ++r)
+        for (std::size_t c = 0; c < X.cols; ++c) Y.set(r, c, R.apply(X.get(r, c)));
+    return Y;
+}
+
+TEST(NeuralLayers, LinearAndProductMatchEntryOps) {
+    Algebra e3(Signature(3, 0, 0, true));
+    const CliffordMatrix X = filled(e3, 37, 12, 0.2f), W = filled(e3, 12, 9, 1.3f), b = filled(e3, 1, 9, 2.1f);
+    CliffordMatrix Y(e3, 37, 9);
+    nn::linear(X, W, &b, Y);
+    for (std::size_t s = 0; s < 37; s += 5) {
+        for (std::size_t o = 0; o < 9; ++o) {
+            Multivector expect = b.get(0, o);
+            for (std::size_t i = 0; i < 12; ++i) expect = expect + geometricProduct(X.get(s, i), W.get(i, o));
+            expectNear(Y.get(s, o), expect, 1e-4);
+        }
+    }
+
+    // Elementwise product, also in place
+    const CliffordMatrix A = filled(e3, 30, 11, 0.7f);
+    CliffordMatrix B = filled(e3, 30, 11, 3.3f);
+    const CliffordMatrix B0 = B;
+    nn::product(A, B, B);
+    for (std::size_t s = 0; s < 30; s += 7)
+        for (std::size_t c = 0; c < 11; ++c) expectNear(B.get(s, c), geometricProduct(A.get(s, c), B0.get(s, c)), 1e-5);
+
+    EXPECT_THROW(nn::linear(X, W, &X, Y), std::invalid_argument);
+    CliffordMatrix wrong(e3, 36, 9);
+    EXPECT_THROW(nn::linear(X, W, &b, wrong), std::invalid_argument);
+
+    // A shape or Algebra error leaves the output untouched
+    const CliffordMatrix Y0 = Y;
+    const CliffordMatrix X11 = filled(e3, 37, 11, 0.2f);
+    EXPECT_THROW(nn::linear(X11, W, &b, Y), std::invalid_argument);
+    Algebra e4(Signature(4, 0, 0, true));
+    const CliffordMatrix X4 = filled(e4, 37, 12, 0.2f);
+    EXPECT_THROW(nn::linear(X4, W, &b, Y), std::invalid_argument);
+    EXPECT_EQ(Y.data, Y0.data);
+}
+
+TEST(NeuralLayers, GradeLinearIsEquivariant) {
+    Algebra e3(Signature(3, 0, 0, true));
+    const CliffordMatrix X = filled(e3, 19, 6, 0.4f);
+    nn::GradeWeights W(e3, 6, 5);
+    for (std::size_t i = 0; i < W.w.size(); ++i) W.w[i] = std::cos(0.37f * i);
+
+    CliffordMatrix Y(e3, 19, 5);
+    nn::gradeLinear(X, W, Y);
+    for (std::size_t s = 0; s < 19; s += 4) {
+        for (std::size_t o = 0; o < 5; ++o) {
+            for (BladeMask m = 0; m < 8; ++m) {
+                float expect = 0.0f;
+                for (std::size_t i = 0; i < 6; ++i) expect += X.at(s, i, m) * W.grade(Blade::getGrade(m))[i * 5 + o];
+                EXPECT_NEAR(Y.at(s, o, m), expect, 1e-5);
+            }
+        }
+    }
+
+    // layer(R X ~R) == R layer(X) ~R
+    const Rotor R = random::Stream(7).rotor(e3);
+    CliffordMatrix YR(e3, 19, 5);
+    nn::gradeLinear(rotated(X, R), W, YR);
+    const CliffordMatrix expect = rotated(Y, R);
+    for (std::size_t i = 0; i < YR.data.size(); ++i) EXPECT_NEAR(YR.data[i], expect.data[i], 1e-4);
+}
+
+TEST(NeuralLayers, GateIsGradewiseAndEquivariant) {
+    Algebra cga(Signature(4, 1, 0, true));
+    Algebra e3(Signature(3, 0, 0, true));
+    const CliffordMatrix X = filled(e3, 13, 7, 0.9f);
+    nn::GateParams p(e3, 7);
+    for (std::size_t i = 0; i < p.scale.size(); ++i) {
+        p.scale[i] = 0.5f + 0.1f * i;
+        p.shift[i] = -0.2f * i;
+    }
+    CliffordMatrix Y(e3, 13, 7);
+    nn::gate(X, Y, &p);
+    for (std::size_t s = 0; s < 13; s += 3) {
+        for (std::size_t c = 0; c < 7; ++c) {
+            for (int k = 0; k <= 3; ++k) {
+                float q = 0.0f;
+                for (BladeMask m = 0; m < 8; ++m) {
+                    if (Blade::getGrade(m) == k) q += X.at(s, c, m) * X.at(s, c, m);
+                }
+                q = k == 0 ? X.at(s, c, 0) : std::sqrt(q);
+                const float g = 1.0f / (1.0f + std::exp(-(p.scale[c * 4 + k] * q + p.shift[c * 4 + k])));
+                for (BladeMask m = 0; m < 8; ++m) {
+                    if (Blade::getGrade(m) == k) {
+                        EXPECT_NEAR(Y.at(s, c, m), g * X.at(s, c, m), 1e-6);
+                    }
+                }
+            }
+        }
+    }
+
+    // Default parameters in place; the rotor group of E3 preserves every grade norm
+    CliffordMatrix Z = X;
+    nn::gate(Z, Z);
+    const Rotor R = random::Stream(3).rotor(e3);
+    CliffordMatrix ZR = rotated(X, R);
+    nn::gate(ZR, ZR);
+    const CliffordMatrix expect = rotated(Z, R);
+    for (std::size_t i = 0; i < ZR.data.size(); ++i) EXPECT_NEAR(ZR.data[i], expect.data[i], 1e-5);
+
+    CliffordMatrix C(cga, 13, 7);
+    EXPECT_THROW(nn::gate(C, C, &p), std::invalid_argument);
+}
+
+TEST(NeuralLayers, NormalizeGivesUnitRmsNorm) {
+    Algebra cga(Signature(4, 1, 0, true));
+    CliffordMatrix X = filled(cga, 21, 10, 0.3f);
+    for (std::size_t i = 0; i < X.data.size(); ++i) X.data[i] *= 4.0f + (i % 7);
+    std::vector<float> gain(10);
+    for (std::size_t c = 0; c < 10; ++c) gain[c] = 1.0f + c;
+
+    CliffordMatrix Y(cga, 21, 10);
+    nn::normalize(X, Y);
+    for (std::size_t s = 0; s < 21; ++s) {
+        double sum = 0.0;
+        for (std::size_t c = 0; c < 10; ++c)
+            for (BladeMask m = 0; m < 32; ++m) sum += double(Y.at(s, c, m)) * Y.at(s, c, m);
+        EXPECT_NEAR(sum / 10.0, 1.0, 1e-4);
+    }
+
+    // gain scales channels; in place matches out of place
+    nn::normalize(X, X, gain.data());
+    for (std::size_t s = 0; s < 21; s += 4)
+        for (std::size_t c = 0; c < 10; ++c)
+            for (BladeMask m = 0; m < 32; m += 5) EXPECT_NEAR(X.at(s, c, m), gain[c] * Y.at(s, c, m), 1e-5);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/selective.h"
+#include "ga/pga.h"
+#include "ga/productMatrix.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) m.storage[i] = std::sin(seed + 1.3f * static_cast<float>(i));
+    return m;
+}
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+TEST(ProductMatrix, LeftAndRightMatchGeometricProduct) {
+    const Signature sigs[] = {Signature(3, 0, 0, true), Signature(1, 3, 0, true), Signature(4, 1, 0, true)};
+    for (const Signature& sig : sigs) {
+        Algebra alg(sig);
+        const Multivector F = dense(alg, 0.4f);
+        const Multivector X = dense(alg, 2.1f);
+        expectNear(ProductMatrix::left(F).apply(X), geometricProduct(F, X), 1e-4);
+        expectNear(ProductMatrix::right(F).apply(X), geometricProduct(X, F), 1e-4);
+    }
+}
+
+TEST(ProductMatrix, BatchMatchesPerElement) {
+    Signature sig(4, 1, 0, true);
+    Algebra alg(sig);
+    const Multivector F = dense(alg, 0.9f);
+    const ProductMatrix L = ProductMatrix::left(F);
+
+    const std::size_t n = 1000;  // not a multiple of the tile size
+    MultivectorBatch in(alg, n), out(alg, n);
+    for (std::size_t i = 0; i < n; ++i) in.set(i, dense(alg, 0.01f * static_cast<float>(i)));
+
+    L.apply(in, out);
+    for (std::size_t i = 0; i < n; i += 97) {
+        expectNear(out.get(i), geometricProduct(F, in.get(i)), 1e-4);
+    }
+
+    // In place
+    L.apply(in, in);
+    for (std::size_t i = 0; i < n; i += 97) expectNear(in.get(i), out.get(i), 0.0);
+}
+
+TEST(ProductMatrix, RestrictedMotorActsOnPoints) {
+    const Algebra& alg = pga::algebra;
+
+    Multivector R(alg);
+    R.setComponent(0, std::cos(0.3f));
+    R.setComponent(0b011, -std::sin(0.3f));
+    const Multivector M = geometricProduct(pga::translator(alg, 1.0f, -2.0f, 0.5f), R);
+
+    // (M P) ~M restricted to trivector in / trivector out
+    const BladeSet odd = BladeSet::grades(4, 0b01010u);
+    const BladeSet tri = BladeSet::grades(4, 0b01000u);
+    const ProductMatrix left = ProductMatrix::left(M, tri, odd);
+    const ProductMatrix right = ProductMatrix::right(reverse(M), odd, tri);
+    EXPECT_EQ(left.cols(), 4u);
+    EXPECT_EQ(right.rows(), 4u);
+
+    const std::size_t n = 300;
+    MultivectorBatch pts(alg, n), tmp(alg, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float t = static_cast<float>(i);
+        pts.set(i, pga::point(alg, std::sin(t), std::cos(0.5f * t), 0.01f * t));
+    }
+    left.apply(pts, tmp);
+    right.apply(tmp, tmp);
+
+    for (std::size_t i = 0; i < n; i += 31) {
+        const Multivector expected = geometricProduct(geometricProduct(M, pts.get(i)), reverse(M));
+        float x, y, z, ex, ey, ez;
+        pga::pointCoordinates(expected, ex, ey, ez);
+        Multivector got(alg);
+        for (BladeMask b : right.outputs) got.storage[b] = tmp.at(i, b);
+        pga::pointCoordinates(got, x, y, z);
+        EXPECT_NEAR(x, ex, 1e-5);
+        EXPECT_NEAR(y, ey, 1e-5);
+        EXPECT_NEAR(z, ez, 1e-5);
+    }
+}
+
+// End test file
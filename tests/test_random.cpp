@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/parallel.h"
+#include "ga/random.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/wedge.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static bool sameBatch(const MultivectorBatch& a, const MultivectorBatch& b) {
+    return a.data == b.data;
+}
+
+TEST(Random, PhiloxKnownAnswers) {
+    // Random123 known-answer tests for philox4x32-10
+    const auto zero = random::Philox4x32::block({0, 0, 0, 0}, {0, 0});
+    EXPECT_EQ(zero[0], 0x6627e8d5u);
+    EXPECT_EQ(zero[1], 0xe169c58du);
+    EXPECT_EQ(zero[2], 0xbc57ac4cu);
+    EXPECT_EQ(zero[3], 0x9b00dbd8u);
+
+    const auto ones = random::Philox4x32::block({~0u, ~0u, ~0u, ~0u}, {~0u, ~0u});
+    EXPECT_EQ(ones[0], 0x408f276du);
+    EXPECT_EQ(ones[1], 0x41c83b0eu);
+    EXPECT_EQ(ones[2], 0xa20bc7c6u);
+    EXPECT_EQ(ones[3], 0x6d5451fdu);
+}
+
+TEST(Random, BatchesAreReproducible) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t count = 3001;
+    MultivectorBatch a(alg, count), b(alg, count), c(alg, count);
+
+    random::rotors(a, 42, 7);
+    const unsigned threads = ga::parallel::threadCount();
+    ga::parallel::setThreadCount(1);
+    random::rotors(b, 42, 7);
+    ga::parallel::setThreadCount(threads);
+    EXPECT_TRUE(sameBatch(a, b));  // independent of the thread count
+
+    random::rotors(c, 42, 8);
+    EXPECT_FALSE(sameBatch(a, c));
+
+    random::gaussian(a, 1, 0);
+    random::gaussian(b, 1, 0);
+    EXPECT_TRUE(sameBatch(a, b));
+
+    // Streams: same (seed, id) gives the same sequence
+    random::Stream s1(9, 3), s2(9, 3), s3(9, 4);
+    for (int i = 0; i < 10; ++i) {
+        const std::uint32_t x = s1.next();
+        EXPECT_EQ(x, s2.next());
+        EXPECT_NE(x, s3.next());
+    }
+}
+
+TEST(Random, FillKindsAreIndependent) {
+    // Each fill has its own counter domain, so two fills of one (seed, stream) are uncorrelated
+    Algebra alg(Signature(3, 0, 0, true));
+    const std::size_t count = 4000;
+    MultivectorBatch u(alg, count), g(alg, count), v(alg, count), k(alg, count);
+    random::uniform(u, 5, 2);
+    random::gaussian(g, 5, 2);
+    random::unitVectors(v, 5, 2);
+    random::blades(k, 1, 5, 2);
+
+    auto signAgreement = [&](const float* a, const float* b) {
+        std::size_t same = 0;
+        for (std::size_t i = 0; i < count; ++i) same += (a[i] > 0.0f) == (b[i] > 0.0f);
+        return static_cast<double>(same) / static_cast<double>(count);
+    };
+    for (const BladeMask m : {BladeMask{0b001}, BladeMask{0b010}}) {
+        EXPECT_NEAR(signAgreement(u.column(m), g.column(m)), 0.5, 0.05);
+        EXPECT_NEAR(signAgreement(v.column(m), k.column(m)), 0.5, 0.05);
+        EXPECT_NEAR(signAgreement(g.column(0), v.column(m)), 0.5, 0.05);
+    }
+}
+
+TEST(Random, UniformAndGaussianMoments) {
+    Algebra alg(Signature(3, 0, 0, true));
+    const std::size_t count = 20000;
+    MultivectorBatch u(alg, count), g(alg, count);
+    random::uniform(u, 5, 0, 2.0f, 4.0f, 0b0110u);  // grades 1 and 2
+    random::gaussian(g, 5, 1, 0.5f);
+
+    for (std::size_t m = 0; m < 8; ++m) {
+        const int grade = Blade::getGrade(static_cast<BladeMask>(m));
+        const float* col = u.column(static_cast<BladeMask>(m));
+        double sum = 0.0, lo = 1e9, hi = -1e9;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += col[i];
+            lo = std::min<double>(lo, col[i]);
+            hi = std::max<double>(hi, col[i]);
+        }
+        if (grade == 1 || grade == 2) {
+            EXPECT_NEAR(sum / count, 3.0, 0.02) << "blade " << m;
+            EXPECT_GE(lo, 2.0);
+            EXPECT_LT(hi, 4.0);
+        } else {
+            EXPECT_EQ(sum, 0.0) << "blade " << m;
+        }
+
+        const float* gc = g.column(static_cast<BladeMask>(m));
+        double mean = 0.0, var = 0.0;
+        for (std::size_t i = 0; i < count; ++i) mean += gc[i];
+        mean /= count;
+        for (std::size_t i = 0; i < count; ++i) var += (gc[i] - mean) * (gc[i] - mean);
+        EXPECT_NEAR(mean, 0.0, 0.015) << "blade " << m;
+        EXPECT_NEAR(var / count, 0.25, 0.01) << "blade " << m;
+    }
+}
+
+TEST(Random, UnitVectorsAndBlades) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t count = 2000;
+    MultivectorBatch v(alg, count), B(alg, count);
+    random::unitVectors(v, 11);
+    random::blades(B, 2, 11);
+
+    double mean[5]{};
+    for (std::size_t i = 0; i < count; ++i) {
+        double n2 = 0.0;
+        for (int a = 0; a < 5; ++a) {
+            const float x = v.at(i, Blade::getBasis(a));
+            n2 += x * x;
+            mean[a] += x;
+        }
+        EXPECT_NEAR(n2, 1.0, 1e-5);
+        EXPECT_EQ(v.at(i, Blade::getBasis(4)), 0.0f);  // negative axis left out
+    }
+    for (int a = 0; a < 4; ++a) EXPECT_NEAR(mean[a] / count, 0.0, 0.05);
+
+    for (std::size_t i = 0; i < count; i += 97) {
+        const Multivector b = B.get(i);
+        double n2 = 0.0;
+        for (std::size_t m = 0; m < 32; ++m) {
+            if (Blade::getGrade(static_cast<BladeMask>(m)) == 2) n2 += b.storage[m] * b.storage[m];
+            else EXPECT_EQ(b.storage[m], 0.0f);
+        }
+        EXPECT_NEAR(n2, 1.0, 1e-5);
+        // A 2-blade squares to zero under the wedge
+        const Multivector w = wedge(b, b);
+        for (std::size_t m = 0; m < 32; ++m) EXPECT_NEAR(w.storage[m], 0.0, 1e-5);
+    }
+
+    Algebra neg(Signature(0, 3, 0, true));
+    MultivectorBatch none(neg, 4);
+    EXPECT_THROW(random::unitVectors(none, 1), std::invalid_argument);
+    EXPECT_THROW(random::blades(B, 6, 1), std::invalid_argument);
+}
+
+TEST(Random, RotorsAreHaarUniform) {
+    // E3: unit rotors with uniform quaternion statistics, E[s^2] = 1/4
+    Algebra e3(Signature(3, 0, 0, true));
+    const std::size_t count = 40000;
+    MultivectorBatch R(e3, count);
+    random::rotors(R, 2024);
+    double s2 = 0.0, s = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        double n2 = 0.0;
+        for (const BladeMask m : {0b000, 0b011, 0b101, 0b110}) n2 += R.at(i, m) * R.at(i, m);
+        EXPECT_NEAR(n2, 1.0, 1e-5);
+        s += R.at(i, 0);
+        s2 += R.at(i, 0) * R.at(i, 0);
+    }
+    EXPECT_NEAR(s / count, 0.0, 0.01);
+    EXPECT_NEAR(s2 / count, 0.25, 0.005);
+
+    // CGA: Spin(4) x Spin(1); R e_1 ~R is uniform on the sphere of the positive axes
+    Algebra cga(Signature(4, 1, 0, true));
+    const std::size_t n = 6000;
+    MultivectorBatch C(cga, n);
+    random::rotors(C, 77, 3);
+    Multivector e1(cga);
+    e1.setComponent(Blade::getBasis(0), 1.0f);
+    double second[5]{};
+    for (std::size_t i = 0; i < n; ++i) {
+        const Multivector r = C.get(i);
+        EXPECT_NEAR(geometricProduct(r, reverse(r)).component(0), 1.0, 1e-5);
+        const Multivector x = geometricProduct(geometricProduct(r, e1), reverse(r));
+        for (int a = 0; a < 5; ++a) second[a] += x.component(Blade::getBasis(a)) * x.component(Blade::getBasis(a));
+    }
+    for (int a = 0; a < 4; ++a) EXPECT_NEAR(second[a] / n, 0.25, 0.015) << "axis " << a;
+    EXPECT_NEAR(second[4], 0.0, 1e-6);
+
+    // Sequential stream gives unit rotors too
+    random::Stream stream(5);
+    const Rotor r = stream.rotor(e3);
+    EXPECT_NEAR(geometricProduct(r.value(), reverse(r.value())).component(0), 1.0, 1e-5);
+    const Multivector b = stream.blade(cga, 3);
+    EXPECT_NEAR(wedge(b, b).component(0), 0.0, 1e-6);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/rotor.h"
+#include "ga/reducedBatch.h"
+
+using namespace ga;
+
+static Multivector basisVec(const Algebra& alg, int axis) {
+    Multivector v(alg);
+    v.setComponent(Blade::getBasis(axis), 1.0f);
+    return v;
+}
+
+// -----------------------------------------------------------------------------
+// Scalar conversions
+// -----------------------------------------------------------------------------
+
+TEST(ReducedPrecision, Fp16KnownValues) {
+    EXPECT_EQ(Fp16::fromFloat(1.0f), 0x3c00);
+    EXPECT_EQ(Fp16::fromFloat(-2.0f), 0xc000);
+    EXPECT_EQ(Fp16::fromFloat(65504.0f), 0x7bff);
+    EXPECT_EQ(Fp16::fromFloat(1e6f), 0x7c00);              // overflow -> inf
+    EXPECT_EQ(Fp16::fromFloat(1.0f + 1.0f / 4096.0f), 0x3c00); // tie rounds to even
+    EXPECT_EQ(Fp16::toFloat(0x0001), std::ldexp(1.0f, -24)); // smallest subnormal
+    EXPECT_TRUE(std::isnan(Fp16::toFloat(Fp16::fromFloat(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ReducedPrecision, BFloat16KnownValues) {
+    EXPECT_EQ(BFloat16::fromFloat(1.0f), 0x3f80);
+    EXPECT_EQ(BFloat16::toFloat(0xc000), -2.0f);
+    EXPECT_EQ(BFloat16::fromFloat(1.0f + 1.0f / 256.0f), 0x3f80); // tie rounds to even
+    EXPECT_TRUE(std::isnan(BFloat16::toFloat(BFloat16::fromFloat(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ReducedPrecision, RoundTripWithinUnitRoundoff) {
+    for (int i = -2000; i <= 2000; ++i) {
+        const float x = 0.0137f * static_cast<float>(i) + 0.001f;
+        EXPECT_LE(std::fabs(Fp16::toFloat(Fp16::fromFloat(x)) - x), Fp16::unitRoundoff * std::fabs(x));
+        EXPECT_LE(std::fabs(BFloat16::toFloat(BFloat16::fromFloat(x)) - x), BFloat16::unitRoundoff * std::fabs(x));
+    }
+}
+
+TEST(ReducedPrecision, BlockConversionMatchesScalar) {
+    std::uint16_t packed[37];
+    float src[37], back[37];
+    for (int i = 0; i < 37; ++i) src[i] = 0.37f * static_cast<float>(i - 18);
+    Fp16::narrow(src, packed, 37);
+    Fp16::widen(packed, back, 37);
+    for (int i = 0; i < 37; ++i) {
+        EXPECT_EQ(packed[i], Fp16::fromFloat(src[i]));
+        EXPECT_EQ(back[i], Fp16::toFloat(packed[i]));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Batch kernels
+// -----------------------------------------------------------------------------
+
+template <class Format>
+static void checkRotation() {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    Rotor R = Rotor::fromPlaneAngle(basisVec(alg, 0), basisVec(alg, 1), 0.7f);
+
+    const std::size_t n = 300;
+    MultivectorBatch vectors(alg, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        vectors.at(i, 0b001) = std::sin(0.1f * static_cast<float>(i));
+        vectors.at(i, 0b010) = std::cos(0.3f * static_cast<float>(i));
+        vectors.at(i, 0b100) = 0.5f;
+        vectors.at(i, 0b011) = 2.0f; // a bivector column that must survive untouched
+    }
+
+    ReducedBatch<Format> packed(vectors);
+    ReducedBatch<Format> stored = packed;
+    applyRotor(R, packed, packed);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        Multivector expect = R.apply(stored.get(i));
+        Multivector got = packed.get(i);
+        for (BladeMask m : {BladeMask{0b001}, BladeMask{0b010}, BladeMask{0b100}}) {
+            EXPECT_NEAR(got.component(m), expect.component(m), 2.0f * Format::unitRoundoff);
+        }
+        EXPECT_EQ(got.component(0b011), 2.0);
+    }
+}
+
+TEST(ReducedPrecision, RotateHalfBatch) { checkRotation<Fp16>(); }
+TEST(ReducedPrecision, RotateBFloat16Batch) { checkRotation<BFloat16>(); }
+
+TEST(ReducedPrecision, CompoundOnHalfBatch) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    Rotor R = Rotor::fromPlaneAngle(basisVec(alg, 1), basisVec(alg, 2), 1.1f);
+    CompoundMap normals = R.toLinearMap().compound(2);
+
+    HalfBatch batch(alg, 20);
+    for (std::size_t i = 0; i < 20; ++i) {
+        Multivector B(alg);
+        B.setComponent(0b011, 0.1f * static_cast<float>(i));
+        B.setComponent(0b110, 1.0f);
+        batch.set(i, B);
+    }
+    HalfBatch out(alg, 20);
+    applyCompound(normals, batch, out);
+
+    for (std::size_t i = 0; i < 20; ++i) {
+        Multivector expect = R.apply(batch.get(i));
+        for (BladeMask m : normals.masks)
+            EXPECT_NEAR(out.get(i).component(m), expect.component(m), 4.0f * Fp16::unitRoundoff);
+    }
+}
+
+// End test file
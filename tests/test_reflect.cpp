@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/reflect.h"
+#include "ga/ops/wedge.h"
+#include "ga/pga.h"
+#include "ga/versor.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector vec(const Algebra& alg, float seed) {
+    Multivector v(alg);
+    for (int k = 0; k < alg.dimensions; ++k) v.setComponent(Blade::getBasis(k), std::sin(seed + 1.1f * k));
+    return v;
+}
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+TEST(Reflect, VectorMatchesNegatedSandwich) {
+    const Signature sigs[] = {Signature(3, 0, 0, true), Signature(1, 3, 0, true), Signature(4, 1, 0, true)};
+    for (const Signature& sig : sigs) {
+        Algebra alg(sig);
+        const Multivector n = vec(alg, 0.2f);
+        const Multivector v = vec(alg, 1.7f);
+        // Hyperplane reflection is -n v n^{-1}
+        const Multivector sandwich = -1.0f * geometricProduct(geometricProduct(n, v), Versor(n).inverse());
+        expectNear(reflectVector(v, n), sandwich, 1e-5);
+        expectNear(reflect(v, n), sandwich, 1e-5);
+    }
+
+    // Reflecting twice is the identity
+    Algebra e3(Signature(3, 0, 0, true));
+    const Multivector n = vec(e3, 0.5f), v = vec(e3, 2.5f);
+    expectNear(reflectVector(reflectVector(v, n), n), v, 1e-5);
+}
+
+TEST(Reflect, GeneralGradesFollowOutermorphism) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const Multivector n = vec(alg, 0.9f);
+    const Multivector a = vec(alg, 0.1f), b = vec(alg, 2.2f), c = vec(alg, 3.9f);
+
+    const Multivector ra = reflect(a, n), rb = reflect(b, n), rc = reflect(c, n);
+    expectNear(reflect(wedge(a, b), n), wedge(ra, rb), 1e-4);
+    expectNear(reflect(wedge(wedge(a, b), c), n), wedge(wedge(ra, rb), rc), 1e-4);
+
+    // Even mirrors are a plain sandwich (a rotation by two reflections)
+    const Multivector m = vec(alg, 1.4f);
+    const Multivector R = geometricProduct(m, n);
+    expectNear(reflect(a, R), reflect(reflect(a, n), m), 1e-4);
+}
+
+TEST(Reflect, PgaPlanesAndPoints) {
+    const Algebra& alg = pga::algebra;
+    const Multivector P = pga::point(alg, 1.0f, -2.0f, 0.5f);
+
+    // Plane x = 0 is e1
+    Multivector plane(alg);
+    plane.setComponent(0b0001, 1.0f);
+    float x, y, z;
+    pga::pointCoordinates(reflect(P, plane), x, y, z);
+    EXPECT_NEAR(x, -1.0f, 1e-6);
+    EXPECT_NEAR(y, -2.0f, 1e-6);
+    EXPECT_NEAR(z, 0.5f, 1e-6);
+
+    // Point reflection through (1, 1, 1)
+    pga::pointCoordinates(reflect(P, pga::point(alg, 1.0f, 1.0f, 1.0f)), x, y, z);
+    EXPECT_NEAR(x, 1.0f, 1e-5);
+    EXPECT_NEAR(y, 4.0f, 1e-5);
+    EXPECT_NEAR(z, 1.5f, 1e-5);
+}
+
+TEST(Reflect, BatchesMatchSingle) {
+    Algebra alg(Signature(4, 1, 0, true));
+    const std::size_t count = 700;
+    const Multivector n = vec(alg, 0.6f);
+
+    MultivectorBatch in(alg, count), out(alg, count), mirrors(alg, count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Multivector X = vec(alg, 0.01f * static_cast<float>(i));
+        X.setComponent(0b00011, 0.3f);
+        in.set(i, X);
+        mirrors.set(i, vec(alg, 0.5f + 0.02f * static_cast<float>(i)));
+    }
+
+    reflect(in, n, out);
+    for (std::size_t i = 0; i < count; i += 41) expectNear(out.get(i), reflect(in.get(i), n), 1e-4);
+
+    MultivectorBatch vout = in;
+    reflectVectors(in, n, vout);
+    for (std::size_t i = 0; i < count; i += 41) {
+        Multivector expect = reflectVector(in.get(i), n);
+        expect.setComponent(0b00011, 0.3f);  // non-vector columns untouched
+        expectNear(vout.get(i), expect, 1e-5);
+    }
+
+    const Multivector v = vec(alg, 2.0f);
+    reflectVectors(v, mirrors, out);
+    for (std::size_t i = 0; i < count; i += 41) {
+        const Multivector r = reflectVector(v, mirrors.get(i));
+        for (int k = 0; k < alg.dimensions; ++k) {
+            EXPECT_NEAR(out.at(i, Blade::getBasis(k)), r.storage[Blade::getBasis(k)], 1e-4);
+        }
+    }
+
+    const Multivector X = in.get(5);
+    reflect(X, mirrors, out);
+    for (std::size_t i = 0; i < count; i += 41) expectNear(out.get(i), reflect(X, mirrors.get(i)), 1e-5);
+}
+
+TEST(Reflect, RejectsNullAndMixedMirrors) {
+    Algebra alg(Signature(3, 0, 1, true));
+    Multivector ideal(alg);
+    ideal.setComponent(0b1000, 1.0f);  // e4 squares to zero
+    const Multivector v = vec(alg, 0.3f);
+    EXPECT_THROW(reflectVector(v, ideal), std::runtime_error);
+
+    Multivector mixed = vec(alg, 0.1f);
+    mixed.setComponent(0, 1.0f);
+    EXPECT_THROW(reflect(v, mixed), std::invalid_argument);
+
+    MultivectorBatch mirrors(alg, 4), out(alg, 4);
+    EXPECT_THROW(reflectVectors(v, mirrors, out), std::runtime_error);
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+#include "ga/rotor.h"
+#include "ga/pga.h"
+#include "ga/registration.h"
+
+using namespace ga;
+using namespace ga::ops;
+using namespace ga::registration;
+
+// Simple deterministic point cloud stored as SoA
+struct Cloud {
+    std::vector<float> x, y, z;
+    PointSetView view() const { return {x.data(), y.data(), z.data(), x.size()}; }
+};
+
+static Cloud makeCloud(std::size_t n) {
+    Cloud c;
+    for (std::size_t i = 0; i < n; ++i) {
+        const float t = static_cast<float>(i);
+        c.x.push_back(std::sin(0.7f * t) * 2.0f + 0.1f * t);
+        c.y.push_back(std::cos(1.3f * t) * 1.5f);
+        c.z.push_back(std::sin(0.4f * t + 1.0f) * 3.0f - 0.05f * t);
+    }
+    return c;
+}
+
+static Multivector vec3(const Algebra& alg, float x, float y, float z) {
+    Multivector v(alg);
+    v.setComponent(Blade::getBasis(0), x);
+    v.setComponent(Blade::getBasis(1), y);
+    v.setComponent(Blade::getBasis(2), z);
+    return v;
+}
+
+// Apply a rotor to every point of the cloud through the generic sandwich
+static Cloud rotateCloud(const Rotor& R, const Cloud& c) {
+    Cloud out;
+    for (std::size_t i = 0; i < c.x.size(); ++i) {
+        Multivector p = R.apply(vec3(*R.algebra(), c.x[i], c.y[i], c.z[i]));
+        out.x.push_back(static_cast<float>(p.component(Blade::getBasis(0))));
+        out.y.push_back(static_cast<float>(p.component(Blade::getBasis(1))));
+        out.z.push_back(static_cast<float>(p.component(Blade::getBasis(2))));
+    }
+    return out;
+}
+
+static Cloud moveCloud(const Rotor& M, const Cloud& c) {
+    Cloud out;
+    for (std::size_t i = 0; i < c.x.size(); ++i) {
+        Multivector p = M.apply(pga::point(*M.algebra(), c.x[i], c.y[i], c.z[i]));
+        float x, y, z;
+        pga::pointCoordinates(p, x, y, z);
+        out.x.push_back(x);
+        out.y.push_back(y);
+        out.z.push_back(z);
+    }
+    return out;
+}
+
+TEST(Registration, RecoversE3Rotor) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+
+    Multivector a = vec3(alg, 1.0f, 0.2f, -0.3f);
+    Multivector b = vec3(alg, 0.1f, 1.0f, 0.4f);
+    Rotor truth = Rotor::fromPlaneAngle(a, b, 0.9f);
+
+    Cloud src = makeCloud(37);
+    Cloud dst = rotateCloud(truth, src);
+
+    Rotor R = fitRotor(alg, src.view(), dst.view());
+
+    // Rotors are defined up to sign; compare the action instead
+    Cloud check = rotateCloud(R, src);
+    for (std::size_t i = 0; i < src.x.size(); ++i) {
+        EXPECT_NEAR(check.x[i], dst.x[i], 1e-4);
+        EXPECT_NEAR(check.y[i], dst.y[i], 1e-4);
+        EXPECT_NEAR(check.z[i], dst.z[i], 1e-4);
+    }
+
+    // Result is a unit rotor
+    Multivector n2 = geometricProduct(R.value(), reverse(R.value()));
+    EXPECT_NEAR(n2.component(0), 1.0, 1e-5);
+}
+
+TEST(Registration, RecoversPgaMotor) {
+    const Algebra& alg = pga::algebra;
+
+    Multivector Rmv(alg);
+    Rmv.setComponent(0, std::cos(0.35f));
+    Rmv.setComponent(0b011, -std::sin(0.35f) * 0.6f);
+    Rmv.setComponent(0b110, -std::sin(0.35f) * 0.8f);
+    Multivector Mmv = geometricProduct(pga::translator(alg, 1.5f, -2.0f, 0.25f), Rmv);
+    Rotor truth(Mmv);
+
+    Cloud src = makeCloud(64);
+    Cloud dst = moveCloud(truth, src);
+
+    Rotor M = fitMotor(alg, src.view(), dst.view());
+    Cloud check = moveCloud(M, src);
+    for (std::size_t i = 0; i < src.x.size(); ++i) {
+        EXPECT_NEAR(check.x[i], dst.x[i], 1e-3);
+        EXPECT_NEAR(check.y[i], dst.y[i], 1e-3);
+        EXPECT_NEAR(check.z[i], dst.z[i], 1e-3);
+    }
+}
+
+TEST(Registration, WeightsIgnoreOutliers) {
+    const Algebra& alg = pga::algebra;
+    Cloud src = makeCloud(20);
+    Cloud dst = moveCloud(Rotor(pga::translator(alg, 0.5f, 0.0f, -1.0f)), src);
+
+    std::vector<float> w(src.x.size(), 1.0f);
+    dst.x[3] += 50.0f;
+    w[3] = 0.0f;
+
+    Rotor M = fitMotor(alg, src.view(), dst.view(), w.data());
+    Cloud check = moveCloud(M, src);
+    EXPECT_NEAR(check.x[0], src.x[0] + 0.5f, 1e-4);
+    EXPECT_NEAR(check.z[0], src.z[0] - 1.0f, 1e-4);
+}
+
+TEST(Registration, IcpConvergesFromShuffledTarget) {
+    const Algebra& alg = pga::algebra;
+
+    Multivector Rmv(alg);
+    Rmv.setComponent(0, std::cos(0.05f));
+    Rmv.setComponent(0b011, -std::sin(0.05f));
+    Rotor truth(geometricProduct(pga::translator(alg, 0.05f, -0.03f, 0.02f), Rmv));
+
+    Cloud src = makeCloud(50);
+    Cloud moved = moveCloud(truth, src);
+
+    // Reverse the target order so correspondences must be discovered
+    Cloud dst;
+    for (std::size_t i = moved.x.size(); i-- > 0;) {
+        dst.x.push_back(moved.x[i]);
+        dst.y.push_back(moved.y[i]);
+        dst.z.push_back(moved.z[i]);
+    }
+
+    IcpResult res = icp(alg, src.view(), dst.view());
+    EXPECT_TRUE(res.converged);
+    EXPECT_LT(res.rms, 1e-3f);
+
+    Cloud check = moveCloud(res.motor, src);
+    for (std::size_t i = 0; i < src.x.size(); ++i) {
+        EXPECT_NEAR(check.x[i], moved.x[i], 1e-3);
+        EXPECT_NEAR(check.y[i], moved.y[i], 1e-3);
+        EXPECT_NEAR(check.z[i], moved.z[i], 1e-3);
+    }
+}
+
+TEST(Registration, RejectsWrongAlgebra) {
+    Signature sig(3, 0, 0, true);
+    Algebra alg(sig);
+    Cloud c = makeCloud(8);
+    EXPECT_THROW(fitMotor(alg, c.view(), c.view()), std::invalid_argument);
+    EXPECT_THROW(fitRotor(pga::algebra, c.view(), c.view()), std::invalid_argument);
+}
+
+// End test file
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/tables.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+#include "ga/ops/selective.h"
+#include "ga/versor.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static Multivector dense(const Algebra& alg, float seed) {
+    Multivector m(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        // leave a few zeros so the sparse skips are exercised
+        m.storage[i] = (i % 5 == 3) ? 0.0f : std::sin(seed + 0.77f * static_cast<float>(i));
+    }
+    return m;
+}
+
+static bool sameBits(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+TEST(SelectiveProducts, MatchFullProductBitwise) {
+    const Signature sigs[] = {
+        Signature(3, 0, 0, true), Signature(1, 3, 0, true),
+        Signature(3, 0, 1, true), Signature(4, 1, 0, true), Signature(5, 2, 1, true),
+    };
+    for (const Signature& sig : sigs) {
+        Algebra alg(sig);
+        const Multivector A = dense(alg, 0.3f);
+        const Multivector B = dense(alg, 1.9f);
+        const Multivector full = geometricProduct(A, B);
+
+        const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+        for (std::size_t r = 0; r < N; ++r) {
+            EXPECT_TRUE(sameBits(static_cast<float>(productComponent(A, B, static_cast<BladeMask>(r))), full.storage[r]))
+                << "dims " << alg.dimensions << " blade " << r;
+        }
+
+        // Even grades only: odd outputs stay zero
+        const Multivector even = geometricProductGrades(A, B, 0b101010101u);
+        for (std::size_t r = 0; r < N; ++r) {
+            const bool isEven = Blade::getGrade(static_cast<BladeMask>(r)) % 2 == 0;
+            EXPECT_TRUE(sameBits(even.storage[r], isEven ? full.storage[r] : 0.0f));
+        }
+    }
+}
+
+TEST(SelectiveProducts, BladeSetFromGrades) {
+    const BladeSet vectors = BladeSet::grades(4, 0b10u);
+    int count = 0;
+    for (unsigned m = 0; m < 16; ++m) {
+        count += vectors.contains(static_cast<BladeMask>(m));
+    }
+    EXPECT_EQ(count, 4);
+    EXPECT_TRUE(vectors.contains(0b1000));
+    EXPECT_FALSE(vectors.contains(0b0011));
+
+    BladeSet s;
+    s.add(255);
+    EXPECT_TRUE(s.contains(255));
+    EXPECT_FALSE(s.contains(254));
+}
+
+TEST(SelectiveProducts, TablesAreSharedPerMetric) {
+    Algebra a(Signature(3, 0, 1, true));
+    Algebra b(Signature(3, 0, 1, true));
+    Algebra c(Signature(3, 1, 0, true));
+    EXPECT_EQ(&productTables(a), &productTables(b));
+    EXPECT_NE(&productTables(a), &productTables(c));
+
+    // Null axis removes the pairs that contract e4 e4
+    const ProductTables& t = productTables(a);
+    EXPECT_EQ(t.offsets[1] - t.offsets[0], 8u);
+    EXPECT_EQ(t.productSign(0b1000, 0b1000), 0);
+}
+
+TEST(SelectiveProducts, VersorInverseUsesScalarNorm) {
+    Algebra alg(Signature(3, 0, 0, true));
+    Multivector V = dense(alg, 0.5f);
+    for (std::size_t i = 0; i < 8; ++i)
+        if (Blade::getGrade(static_cast<BladeMask>(i)) % 2) V.storage[i] = 0.0f;
+
+    const Multivector inv = Versor(V).inverse();
+    const Multivector vrev = reverse(V);
+    const float s = static_cast<float>(geometricProduct(V, vrev).component(0));
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(sameBits(inv.storage[i], vrev.storage[i] * (1.0f / s)));
+    }
+}
+
+// End test file
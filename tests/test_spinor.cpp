@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/parallel.h"
+#include "ga/random.h"
+#include "ga/spinor.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+// exp by truncated Taylor series, using the library's geometric product
+static Multivector seriesExp(const Multivector& B) {
+    Multivector sum(*B.alg), term(*B.alg);
+    term.setComponent(0, 1.0f);
+    for (int k = 1; k < 40; ++k) {
+        sum = sum + term;
+        term = (1.0f / static_cast<float>(k)) * geometricProduct(term, B);
+    }
+    return sum;
+}
+
+static unsigned evenGrades(const Algebra& alg) { return alg.dimensions == 3 ? 0b0101u : 0b10101u; }
+
+TEST(Spinor, ExpMatchesSeries) {
+    const Algebra pauli(Signature(3, 0, 0, true));
+    const Algebra dirac(Signature(1, 3, 0, true));
+    random::Stream rng(5);
+    for (const Algebra* alg : {&pauli, &dirac}) {
+        for (int i = 0; i < 6; ++i) {
+            const Multivector B = rng.multivector(*alg, 0b100, -1.2f, 1.2f);
+            expectNear(spinor::exp(B), seriesExp(B), 2e-5);
+        }
+        expectNear(spinor::exp(Multivector(*alg)), seriesExp(Multivector(*alg)), 0.0);
+    }
+
+    // Simple Dirac bivectors: a boost (B^2 > 0) and a rotation (B^2 < 0)
+    Multivector boost(dirac), rot(dirac);
+    boost.setComponent(0b0011, 0.8f);
+    rot.setComponent(0b0110, 0.8f);
+    expectNear(spinor::exp(boost), seriesExp(boost), 1e-6);
+    expectNear(spinor::exp(rot), seriesExp(rot), 1e-6);
+    EXPECT_NEAR(spinor::exp(boost).component(0), std::cosh(0.8), 1e-6);
+    EXPECT_NEAR(spinor::exp(rot).component(0), std::cos(0.8), 1e-6);
+
+    EXPECT_THROW(spinor::exp(Multivector(Algebra(Signature(4, 1, 0, true)))), std::invalid_argument);
+}
+
+TEST(Spinor, EvolveMatchesDenseProducts) {
+    const Algebra pauli(Signature(3, 0, 0, true));
+    const Algebra dirac(Signature(1, 3, 0, true));
+    const unsigned threads = ga::parallel::threadCount();
+    ga::parallel::setThreadCount(4);
+    for (const Algebra* alg : {&pauli, &dirac}) {
+        random::Stream rng(9);
+        const std::size_t n = 1000;
+        spinor::Ensemble e(*alg, n);
+        spinor::Fields f(*alg, n);
+        std::vector<Multivector> psi, field;
+        for (std::size_t i = 0; i < n; ++i) {
+            psi.push_back(rng.multivector(*alg, evenGrades(*alg)));
+            field.push_back(rng.multivector(*alg, 0b100, -2.0f, 2.0f));
+            e.set(i, psi[i]);
+            f.set(i, field[i]);
+        }
+
+        // Uniform field, 5 steps at once
+        const Multivector B = rng.multivector(*alg, 0b100);
+        const float dt = 0.05f;
+        spinor::Ensemble u = e;
+        spinor::evolve(u, B, dt, 5);
+        Multivector R5 = spinor::exp(dt * B);
+        const Multivector R = R5;
+        for (int s = 1; s < 5; ++s) R5 = geometricProduct(R, R5);
+        for (std::size_t i = 0; i < n; i += 37) expectNear(u.get(i), geometricProduct(R5, psi[i]), 2e-5);
+
+        // Per-spinor fields
+        spinor::evolve(e, f, dt);
+        for (std::size_t i = 0; i < n; i += 37) {
+            expectNear(e.get(i), geometricProduct(spinor::exp(dt * field[i]), psi[i]), 2e-5);
+        }
+    }
+    ga::parallel::setThreadCount(threads);
+
+    spinor::Ensemble e(pauli, 4);
+    EXPECT_THROW(spinor::evolve(e, spinor::Fields(pauli, 3), 0.1f), std::invalid_argument);
+    EXPECT_THROW(spinor::evolve(e, Multivector(dirac), 0.1f), std::invalid_argument);
+    EXPECT_THROW(spinor::Ensemble(Algebra(Signature(3, 1, 0, true)), 4), std::invalid_argument);
+}
+
+TEST(Spinor, NormalizeAndObservables) {
+    const Algebra pauli(Signature(3, 0, 0, true));
+    const Algebra dirac(Signature(1, 3, 0, true));
+    for (const Algebra* alg : {&pauli, &dirac}) {
+        random::Stream rng(3);
+        const std::size_t n = 777;
+        spinor::Ensemble e(*alg, n);
+        for (std::size_t i = 0; i < n; ++i) e.set(i, rng.multivector(*alg, evenGrades(*alg)));
+        spinor::normalize(e);
+
+        Multivector A = rng.multivector(*alg, ~0u);
+        Multivector mean(*alg);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Multivector psi = e.get(i);
+            const Multivector rho = geometricProduct(psi, reverse(psi));
+            const double pseudo = alg->dimensions == 4 ? rho.component(0b1111) : 0.0;
+            EXPECT_NEAR(std::hypot(rho.component(0), pseudo), 1.0, 1e-5);
+            mean = mean + (1.0f / n) * geometricProduct(geometricProduct(psi, A), reverse(psi));
+        }
+        expectNear(spinor::expectation(e, A), mean, 1e-4);
+    }
+
+    // Spin precession: exp(-theta/2 e12) turns the spin vector psi e1 ~psi by theta in the e1e2 plane
+    spinor::Ensemble e(pauli, 100);
+    Multivector B(pauli), e1(pauli);
+    B.setComponent(0b011, -0.5f);
+    e1.setComponent(0b001, 1.0f);
+    spinor::evolve(e, B, 0.01f, 70);
+    const Multivector s = spinor::expectation(e, e1);
+    EXPECT_NEAR(s.component(0b001), std::cos(0.7), 1e-5);
+    EXPECT_NEAR(s.component(0b010), std::sin(0.7), 1e-5);
+}
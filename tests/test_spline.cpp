@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/multivector.h"
+#include "ga/batch.h"
+#include "ga/pga.h"
+#include "ga/rotor.h"
+#include "ga/spline.h"
+#include "ga/ops/geometric.h"
+#include "ga/ops/involutions.h"
+
+using namespace ga;
+using namespace ga::ops;
+
+static void expectNear(const Multivector& a, const Multivector& b, double tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) EXPECT_NEAR(a.storage[i], b.storage[i], tol) << "blade " << i;
+}
+
+static Multivector bivector(const Algebra& alg, float seed) {
+    static constexpr BladeMask masks[] = {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100};
+    Multivector B(alg);
+    const std::size_t N = static_cast<std::size_t>(1) << alg.dimensions;
+    for (int k = 0; k < 6; ++k) {
+        if (masks[k] < N) B.setComponent(masks[k], 0.6f * std::sin(seed + 1.3f * k));
+    }
+    return B;
+}
+
+// exp by truncated Taylor series, using the library's geometric product
+static Multivector seriesExp(const Multivector& B) {
+    Multivector sum(*B.alg), term(*B.alg);
+    term.setComponent(0, 1.0f);
+    for (int k = 1; k < 30; ++k) {
+        sum = sum + term;
+        term = (1.0f / static_cast<float>(k)) * geometricProduct(term, B);
+    }
+    return sum;
+}
+
+static std::vector<Multivector> motorKeys(int n) {
+    std::vector<Multivector> keys;
+    for (int i = 0; i < n; ++i) keys.push_back(spline::motorExp(bivector(pga::algebra, 0.7f * i)));
+    return keys;
+}
+
+TEST(Spline, ExpLogMatchSeries) {
+    Algebra e3(Signature(3, 0, 0, true));
+    for (const Algebra* alg : {static_cast<const Algebra*>(&e3), &pga::algebra}) {
+        for (float seed : {0.0f, 1.1f, 2.9f}) {
+            const Multivector B = bivector(*alg, seed);
+            const Multivector M = spline::motorExp(B);
+            expectNear(M, seriesExp(B), 1e-5);
+            expectNear(spline::motorLog(M), B, 1e-5);
+            expectNear(geometricProduct(M, reverse(M)), seriesExp(Multivector(*alg)), 1e-5);
+        }
+    }
+
+    // Pure translation: exp(B) = 1 + B
+    const Multivector T = pga::translator(1.0f, -2.0f, 0.5f);
+    expectNear(spline::motorExp(spline::motorLog(T)), T, 1e-6);
+
+    // Scalar part -1 and just above it: log takes the other cover, exp returns -M
+    Multivector minusOne(pga::algebra);
+    minusOne.setComponent(0, -1.0f);
+    expectNear(spline::motorLog(minusOne), Multivector(pga::algebra), 0.0);
+    Multivector e12(pga::algebra);
+    e12.setComponent(0b0011, 1.0f);
+    const Multivector R = spline::motorExp((-0.5f * (6.2831853f - 0.01f)) * e12);
+    ASSERT_LT(R.component(0), -0.99f);
+    const Multivector L = spline::motorLog(R);
+    EXPECT_NEAR(L.component(0b0011), 0.005, 1e-5);
+    expectNear(spline::motorExp(L), -1.0f * R, 1e-6);
+
+    EXPECT_THROW(spline::motorExp(Multivector(Algebra(Signature(4, 1, 0, true)))), std::invalid_argument);
+}
+
+TEST(Spline, SquadInterpolatesKeys) {
+    const std::vector<Multivector> keys = motorKeys(5);
+    const spline::Squad s(keys);
+    EXPECT_FLOAT_EQ(s.duration(), 4.0f);
+    for (int i = 0; i < 5; ++i) expectNear(s.evaluate(static_cast<float>(i)), keys[i], 1e-5);
+
+    // Out-of-range parameters clamp to the end keys
+    expectNear(s.evaluate(-1.0f), keys.front(), 1e-5);
+    expectNear(s.evaluate(9.0f), keys.back(), 1e-5);
+
+    // Rotor keys: every sample stays a unit rotor
+    Algebra e3(Signature(3, 0, 0, true));
+    std::vector<Rotor> rotors;
+    for (int i = 0; i < 4; ++i) rotors.push_back(Rotor(spline::motorExp(bivector(e3, 0.9f * i))));
+    const spline::Squad r(rotors);
+    for (float t = 0.0f; t <= 3.0f; t += 0.37f) {
+        const Multivector R = r.evaluate(t);
+        EXPECT_NEAR(geometricProduct(R, reverse(R)).component(0), 1.0, 1e-5);
+    }
+}
+
+TEST(Spline, BSplineEndpointsAndUnitMotors) {
+    const std::vector<Multivector> keys = motorKeys(6);
+    const spline::BSpline b(keys);
+    EXPECT_FLOAT_EQ(b.duration(), 7.0f);
+    expectNear(b.evaluate(0.0f), keys.front(), 1e-5);
+    expectNear(b.evaluate(7.0f), keys.back(), 1e-5);
+
+    // Samples are unit motors: M ~M = 1 with no e1234 part
+    for (float t = 0.0f; t <= 7.0f; t += 0.29f) {
+        const Multivector M = b.evaluate(t);
+        const Multivector n = geometricProduct(M, reverse(M));
+        EXPECT_NEAR(n.component(0), 1.0, 1e-5);
+        EXPECT_NEAR(n.component(0b1111), 0.0, 1e-5);
+    }
+
+    // A constant key sequence gives a constant curve
+    const spline::BSpline c(std::vector<Multivector>(4, keys[2]));
+    expectNear(c.evaluate(1.7f), keys[2], 1e-5);
+    expectNear(c.velocity(1.7f), Multivector(pga::algebra), 1e-6);
+}
+
+TEST(Spline, VelocityMatchesFiniteDifference) {
+    const std::vector<Multivector> keys = motorKeys(5);
+    const spline::BSpline b(keys);
+    const spline::Squad s(keys);
+    const float h = 1e-2f;
+    for (float t : {0.4f, 1.5f, 2.25f, 3.8f}) {
+        for (int which = 0; which < 2; ++which) {
+            auto eval = [&](float x) { return which == 0 ? b.evaluate(x) : s.evaluate(x); };
+            // ~M M' by central difference
+            const Multivector dM = (0.5f / h) * (eval(t + h) + -1.0f * eval(t - h));
+            const Multivector expect = geometricProduct(reverse(eval(t)), dM);
+            const Multivector w = which == 0 ? b.velocity(t) : s.velocity(t);
+            for (BladeMask m : {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100}) {
+                EXPECT_NEAR(w.component(m), expect.component(m), 2e-3) << "t " << t << " blade " << int(m);
+            }
+        }
+    }
+
+    // Away from the clamped ends, a single-generator curve moves at the generator
+    const Multivector B = bivector(pga::algebra, 0.4f);
+    std::vector<Multivector> line;
+    for (int i = 0; i < 4; ++i) line.push_back(spline::motorExp(static_cast<float>(i) * B));
+    expectNear(spline::BSpline(line).velocity(2.5f), B, 1e-4);
+    expectNear(spline::Squad(line).velocity(1.5f), B, 1e-5);
+}
+
+TEST(Spline, SquadVelocityIsAnalytic) {
+    const std::vector<Multivector> keys = motorKeys(5);
+    const spline::Squad s(keys);
+    const float end = s.duration();
+    // Richardson-extrapolated differences that stay inside one segment,
+    // one-sided at the clamped ends
+    for (float t : {0.0f, 0.3f, 1.5f, 2.75f, end}) {
+        auto diff = [&](float h) {
+            if (t == 0.0f || t == end) {
+                const float d = t == 0.0f ? h : -h;
+                return (1.0f / (2.0f * d)) *
+                       (-3.0f * s.evaluate(t) + 4.0f * s.evaluate(t + d) + -1.0f * s.evaluate(t + 2.0f * d));
+            }
+            return (0.5f / h) * (s.evaluate(t + h) + -1.0f * s.evaluate(t - h));
+        };
+        const float h = t == 0.0f || t == end ? 0.05f : 0.2f;
+        const Multivector dM = (1.0f / 3.0f) * (4.0f * diff(0.5f * h) + -1.0f * diff(h));
+        const Multivector expect = geometricProduct(reverse(s.evaluate(t)), dM);
+        const Multivector w = s.velocity(t);
+        for (BladeMask m : {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100}) {
+            EXPECT_NEAR(w.component(m), expect.component(m), 5e-5) << "t " << t << " blade " << int(m);
+        }
+    }
+}
+
+TEST(Spline, BatchMatchesSingle) {
+    const std::vector<Multivector> keys = motorKeys(7);
+    const spline::BSpline b(keys);
+    const spline::Squad s(keys);
+    const std::size_t count = 3000;
+    std::vector<float> t(count);
+    for (std::size_t i = 0; i < count; ++i) t[i] = 8.0f * static_cast<float>(i) / static_cast<float>(count - 1);
+
+    MultivectorBatch pos(pga::algebra, count), vel(pga::algebra, count);
+    b.evaluate(t.data(), count, pos);
+    b.velocity(t.data(), count, vel);
+    for (std::size_t i = 0; i < count; i += 97) {
+        expectNear(pos.get(i), b.evaluate(t[i]), 1e-6);
+        expectNear(vel.get(i), b.velocity(t[i]), 1e-6);
+    }
+
+    s.evaluate(t.data(), count, pos);
+    s.velocity(t.data(), count, vel);
+    for (std::size_t i = 0; i < count; i += 97) {
+        expectNear(pos.get(i), s.evaluate(t[i]), 1e-6);
+        expectNear(vel.get(i), s.velocity(t[i]), 1e-6);
+    }
+
+    Algebra e3(Signature(3, 0, 0, true));
+    MultivectorBatch wrong(e3, count);
+    EXPECT_THROW(b.evaluate(t.data(), count, wrong), std::invalid_argument);
+    MultivectorBatch small(pga::algebra, 10);
+    EXPECT_THROW(s.velocity(t.data(), count, small), std::invalid_argument);
+}
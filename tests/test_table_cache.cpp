@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ga/signature.h"
+#include "ga/algebra.h"
+#include "ga/tables.h"
+
+using namespace ga;
+
+namespace {
+
+    // Fresh cache directory and mode for one test; restores the previous settings
+    struct ScopedCache {
+        std::filesystem::path dir;
+        std::string oldDir = tableCacheDirectory();
+        TableCache oldMode = tableCacheMode();
+
+        explicit ScopedCache(const char* name, TableCache mode)
+            : dir(std::filesystem::temp_directory_path() / (std::string("gasmith-") + name)) {
+            std::filesystem::remove_all(dir);
+            setTableCacheDirectory(dir.string());
+            setTableCacheMode(mode);
+        }
+        ~ScopedCache() {
+            setTableCacheDirectory(oldDir);
+            setTableCacheMode(oldMode);
+            std::filesystem::remove_all(dir);
+        }
+    };
+
+    void expectSameTables(const ProductTables& a, const ProductTables& b) {
+        ASSERT_EQ(a.dims, b.dims);
+        const std::size_t N = a.bladeCount();
+        ASSERT_EQ(a.termCount(), b.termCount());
+        EXPECT_EQ(std::memcmp(a.sign, b.sign, N * N), 0);
+        EXPECT_EQ(std::memcmp(a.offsets, b.offsets, (N + 1) * sizeof(std::uint32_t)), 0);
+        EXPECT_EQ(std::memcmp(a.left, b.left, a.termCount()), 0);
+    }
+
+    std::vector<char> readFile(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    void writeFile(const std::string& path, const std::vector<char>& bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // Recompute the payload checksum after an edit, so only the structural checks can reject it
+    void fixChecksum(std::vector<char>& bytes) {
+        constexpr std::size_t header = sizeof(detail::TableFileHeader);
+        const std::uint64_t h = detail::tableChecksum(reinterpret_cast<const unsigned char*>(bytes.data()) + header,
+                                                      bytes.size() - header);
+        std::memcpy(bytes.data() + offsetof(detail::TableFileHeader, checksum), &h, sizeof(h));
+    }
+
+} // namespace
+
+TEST(TableCache, SaveAndLoadRoundTrip) {
+    const ScopedCache cache("roundtrip", TableCache::Cache);
+    const Signature sig(4, 1, 1, true);
+    const ProductTables built(sig);
+    EXPECT_FALSE(built.fromFile());
+
+    const std::string path = tableCachePath(sig);
+    char content[16];
+    std::snprintf(content, sizeof(content), "-%08x-", static_cast<unsigned>(tableContentVersion()));
+    EXPECT_NE(path.find("tables-v" + std::to_string(TABLE_FORMAT_VERSION) + content), std::string::npos);
+    ASSERT_TRUE(saveTables(built, sig, path));
+
+    const auto loaded = loadTables(sig, path);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(loaded->fromFile());
+    expectSameTables(*loaded, built);
+    EXPECT_EQ(loaded->productSign(0b000101, 0b110001), built.productSign(0b000101, 0b110001));
+}
+
+TEST(TableCache, RejectsCorruptOrMismatchedFiles) {
+    const ScopedCache cache("corrupt", TableCache::Cache);
+    const Signature sig(6, 0, 0, true);
+    const std::string path = tableCachePath(sig);
+    EXPECT_EQ(loadTables(sig, path), nullptr);  // missing
+
+    ASSERT_TRUE(saveTables(ProductTables(sig), sig, path));
+    const std::vector<char> good = readFile(path);
+    ASSERT_NE(loadTables(sig, path), nullptr);
+
+    // Another metric of the same dimension must not accept this file
+    EXPECT_EQ(loadTables(Signature(5, 1, 0, true), path), nullptr);
+
+    std::vector<char> bad = good;
+    bad[bad.size() / 2] ^= 0x01;  // payload bit flip: checksum fails
+    writeFile(path, bad);
+    EXPECT_EQ(loadTables(sig, path), nullptr);
+
+    bad = good;
+    bad[4] ^= 0x7f;  // format version
+    writeFile(path, bad);
+    EXPECT_EQ(loadTables(sig, path), nullptr);
+
+    bad = good;
+    bad[offsetof(detail::TableFileHeader, content)] ^= 0x01;  // written by a build with other conventions
+    writeFile(path, bad);
+    EXPECT_EQ(loadTables(sig, path), nullptr);
+
+    // Valid checksum but offsets out of order, or a term index past the last blade
+    const std::size_t N = 64, payload = sizeof(detail::TableFileHeader);
+    bad = good;
+    std::uint32_t o2;
+    std::memcpy(&o2, bad.data() + payload + 2 * sizeof(std::uint32_t), sizeof(o2));
+    const std::uint32_t o1 = o2 + 5;
+    std::memcpy(bad.data() + payload + sizeof(std::uint32_t), &o1, sizeof(o1));
+    fixChecksum(bad);
+    writeFile(path, bad);
+    EXPECT_EQ(loadTables(sig, path), nullptr);
+
+    bad = good;
+    bad[payload + (N + 1) * sizeof(std::uint32_t) + N * N + 10] = static_cast<char>(N);
+    fixChecksum(bad);
+    writeFile(path, bad);
+    EXPECT_EQ(loadTables(sig, path), nullptr);
+
+    bad = good;  // the edit helper itself leaves a valid file valid
+    fixChecksum(bad);
+    writeFile(path, bad);
+    EXPECT_NE(loadTables(sig, path), nullptr);
+
+    bad.assign(good.begin(), good.end() - 1);  // truncated
+    writeFile(path, bad);
+    EXPECT_EQ(loadTables(sig, path), nullptr);
+
+    EXPECT_FALSE(saveTables(ProductTables(sig), Signature(3, 0, 0, true), path));
+    EXPECT_FALSE(saveTables(ProductTables(sig), sig, ""));
+}
+
+TEST(TableCache, ProductTablesMapsAndWritesFiles) {
+    {
+        // cache: an existing file is mapped instead of building
+        const ScopedCache cache("lookup", TableCache::Cache);
+        const Signature sig(1, 5, 0, true);
+        ASSERT_TRUE(saveTables(ProductTables(sig), sig, tableCachePath(sig)));
+        const Algebra alg(sig);
+        const ProductTables& t = productTables(alg);
+        EXPECT_TRUE(t.fromFile());
+        expectSameTables(t, ProductTables(sig));
+    }
+    {
+        // on: a missing file is written after building
+        const ScopedCache cache("write", TableCache::On);
+        const Signature sig(2, 3, 1, true);
+        const Algebra alg(sig);
+        EXPECT_FALSE(productTables(alg).fromFile());
+        const auto written = loadTables(sig, tableCachePath(sig));
+        ASSERT_NE(written, nullptr);
+        expectSameTables(*written, productTables(alg));
+
+        // Below TABLE_CACHE_MIN_DIMS tables are always built
+        const Signature small(2, 2, 1, true);
+        EXPECT_FALSE(productTables(Algebra(small)).fromFile());
+        EXPECT_FALSE(std::filesystem::exists(tableCachePath(small)));
+    }
+}
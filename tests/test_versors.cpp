@@ -118,4 +118,98 @@ TEST(Rotor, RotatesE1ToE2_90Deg) {
     EXPECT_NEAR(rotated.component(Blade::getBasis(2)), 0.0f, 1e-6);
 }
 
+// Reference sandwich V X V^{-1} with the full inverse
+static Multivector genericSandwich(const Versor& V, const Multivector& X) {
+    return geometricProduct(geometricProduct(V.value(), X), V.inverse());
+}
+
+static void expectNear(const Multivector& a, const Multivector& b, float tol) {
+    const std::size_t N = static_cast<std::size_t>(1) << a.alg->dimensions;
+    for (std::size_t i = 0; i < N; ++i) {
+        EXPECT_NEAR(a.component(static_cast<BladeMask>(i)), b.component(static_cast<BladeMask>(i)), tol) << "blade " << i;
+    }
+}
+
+TEST(Versor, ClassificationSelectsPath) {
+    Algebra alg(Signature(3, 0, 0, true));
+    Multivector e1 = basisVec(alg, 0);
+    Multivector e2 = basisVec(alg, 1);
+
+    Multivector s(alg);
+    s.setComponent(0, 2.0f);
+    EXPECT_EQ(Versor(s).path(), VersorPath::Identity);
+
+    const Versor n(e1 + 2.0f * e2);
+    EXPECT_EQ(n.path(), VersorPath::Reflection);
+    EXPECT_TRUE(n.isOdd());
+    EXPECT_EQ(n.grades(), 0b10u);
+    EXPECT_NEAR(n.norm2(), 5.0f, 1e-6);
+    EXPECT_TRUE(n.blades().contains(0b001) && n.blades().contains(0b010) && !n.blades().contains(0b100));
+
+    const Rotor R = Rotor::fromPlaneAngle(e1, e2, 0.7f);
+    const Versor unit(R.value());
+    EXPECT_EQ(unit.path(), VersorPath::UnitEven);
+    EXPECT_TRUE(unit.isEven() && unit.isUnit());
+
+    // Even but not unit, and odd but not a vector, take the general path
+    EXPECT_EQ(Versor(3.0f * R.value()).path(), VersorPath::General);
+    EXPECT_EQ(Versor(geometricProduct(geometricProduct(e1, e2), basisVec(alg, 2) + e1)).path(), VersorPath::General);
+
+    // Non-invertible stays General so apply() still reports the error
+    const Versor zero{Multivector(alg)};
+    EXPECT_EQ(zero.path(), VersorPath::General);
+    EXPECT_THROW((void)zero.apply(e1), std::runtime_error);
+
+    // Replacing the value reclassifies it
+    Versor V(e1);
+    V.setValue(R.value());
+    EXPECT_EQ(V.path(), VersorPath::UnitEven);
+    expectNear(V.apply(e1), genericSandwich(V, e1), 1e-5f);
+    V.setValue(e2);
+    EXPECT_EQ(V.path(), VersorPath::Reflection);
+}
+
+TEST(Versor, SpecializedPathsMatchGenericSandwich) {
+    Algebra e3(Signature(3, 0, 0, true));
+    Multivector x = basisVec(e3, 0) * 0.3f + basisVec(e3, 1) * -1.2f + basisVec(e3, 2) * 2.5f;
+    Multivector mixed = x + geometricProduct(basisVec(e3, 0), basisVec(e3, 2));
+    mixed.setComponent(0, 0.75f);
+
+    const Versor n(basisVec(e3, 0) * 0.6f + basisVec(e3, 2) * -1.1f);
+    ASSERT_EQ(n.path(), VersorPath::Reflection);
+    expectNear(n.apply(x), genericSandwich(n, x), 1e-5f);
+    expectNear(n.apply(mixed), genericSandwich(n, mixed), 1e-5f);
+
+    const Versor R(Rotor::fromPlaneAngle(basisVec(e3, 1), basisVec(e3, 2), 1.1f).value());
+    ASSERT_EQ(R.path(), VersorPath::UnitEven);
+    expectNear(R.apply(x), genericSandwich(R, x), 1e-5f);
+    expectNear(R.apply(mixed), genericSandwich(R, mixed), 1e-5f);
+
+    // Minkowski reflection uses the metric in x.n
+    Algebra sta(Signature(1, 3, 0, true));
+    Multivector t = basisVec(sta, 0) * 2.0f + basisVec(sta, 1) * 0.5f;
+    const Versor m(t);
+    ASSERT_EQ(m.path(), VersorPath::Reflection);
+    Multivector y = basisVec(sta, 0) * 1.5f + basisVec(sta, 1) * -0.25f + basisVec(sta, 3) * 0.8f;
+    expectNear(m.apply(y), genericSandwich(m, y), 1e-5f);
+
+    // PGA motor (rotation then translation) acting on a point
+    Algebra pga(Signature(3, 0, 1, true));
+    Multivector rot(pga);
+    rot.setComponent(0b0000, std::cos(0.4f));
+    rot.setComponent(0b0011, -std::sin(0.4f));
+    Multivector trans(pga);
+    trans.setComponent(0b0000, 1.0f);
+    trans.setComponent(0b1001, -0.5f * 1.5f);
+    trans.setComponent(0b1010, -0.5f * -0.7f);
+    const Versor M(geometricProduct(trans, rot));
+    ASSERT_EQ(M.path(), VersorPath::UnitEven);
+    Multivector P(pga);
+    P.setComponent(0b0111, 1.0f);
+    P.setComponent(0b1110, -0.2f);
+    P.setComponent(0b1101, 1.4f);
+    P.setComponent(0b1011, -0.9f);
+    expectNear(M.apply(P), genericSandwich(M, P), 1e-5f);
+}
+
 // End test file
@@ -0,0 +1,38 @@
+// Print the runtime metrics a GASmith process publishes to shared memory.
+//
+//   GASmith_metrics <pid | /segment-name> [interval-ms]
+//
+// The target process must run with GASMITH_METRICS=shm (or call
+// ga::metrics::startSharedExport). With an interval the tool keeps polling
+// and prints a snapshot each time; otherwise it prints one and exits.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "ga/metrics.h"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <pid | /segment-name> [interval-ms]\n", argv[0]);
+        return 2;
+    }
+    const std::string target = argv[1];
+    const std::string name = target[0] == '/' ? target : "/gasmith." + target;
+    const long interval = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 0;
+
+    for (;;) {
+        ga::metrics::Snapshot s;
+        std::uint32_t pid = 0;
+        if (!ga::metrics::readShared(name, s, &pid)) {
+            std::fprintf(stderr, "%s: no GASmith metrics segment %s\n", argv[0], name.c_str());
+            return 1;
+        }
+        std::printf("# pid %u\n%s", pid, ga::metrics::format(s).c_str());
+        std::fflush(stdout);
+        if (interval <= 0) return 0;
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    }
+}